@@ -0,0 +1,422 @@
+#include "bench_Fixtures.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <loaders/RWBinaryStream.hpp>
+
+namespace Fixtures {
+
+namespace {
+/// GTA III's RenderWare version
+constexpr std::uint32_t kVersion = 0x0800FFFF;
+
+/**
+ * Appends data to a buffer, filling in the size of each section once it
+ * is closed
+ */
+class SectionWriter {
+public:
+    template <class T>
+    void write(const T& value) {
+        write(&value, sizeof(T));
+    }
+
+    void write(const void* data, size_t size) {
+        auto bytes = static_cast<const char*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+    /**
+     * Writes a null terminated string, padded to 4 bytes
+     */
+    void writeString(const std::string& string) {
+        write(string.data(), string.size());
+        buffer.resize(buffer.size() + 4 - string.size() % 4, 0);
+    }
+
+    /**
+     * Starts a RenderWare chunk
+     */
+    void beginChunk(std::uint32_t id) {
+        write(id);
+        open.push_back(buffer.size());
+        write(std::uint32_t{0});
+        write(kVersion);
+    }
+
+    void endChunk() {
+        end(sizeof(std::uint32_t) * 2);
+    }
+
+    /**
+     * Starts an IFP section
+     */
+    void beginSection(const char (&magic)[5]) {
+        write(magic, 4);
+        open.push_back(buffer.size());
+        write(std::uint32_t{0});
+    }
+
+    void endSection() {
+        end(sizeof(std::uint32_t));
+    }
+
+    Buffer release() {
+        return std::move(buffer);
+    }
+
+private:
+    Buffer buffer;
+    /// Where the size of each open section is
+    std::vector<size_t> open;
+
+    void end(size_t headerAfterSize) {
+        const auto sizeOffset = open.back();
+        open.pop_back();
+        auto size = static_cast<std::uint32_t>(buffer.size() - sizeOffset -
+                                               headerAfterSize);
+        std::memcpy(buffer.data() + sizeOffset, &size, sizeof(size));
+    }
+};
+
+struct Frame {
+    glm::mat3 rotation{1.f};
+    glm::vec3 position{};
+    std::int32_t parent = -1;
+    std::uint32_t flags = 0;
+};
+
+void writeGeometry(SectionWriter& out, int gridSize) {
+    const auto rowVerts = gridSize + 1;
+    const auto numVerts = static_cast<std::uint32_t>(rowVerts * rowVerts);
+    const auto numTris = static_cast<std::uint32_t>(gridSize * gridSize * 2);
+
+    out.beginChunk(RW::SID_Geometry);
+    out.beginChunk(RW::SID_Struct);
+    // Positions, texture coordinates and prelighting
+    out.write(std::uint16_t{0x000E});
+    out.write(std::uint8_t{1});
+    out.write(std::uint8_t{0});
+    out.write(numTris);
+    out.write(numVerts);
+    out.write(std::uint32_t{1});
+    // Ambient, specular and diffuse lighting
+    const float lighting[] = {1.f, 1.f, 1.f};
+    out.write(lighting);
+
+    for (auto v = 0u; v < numVerts; ++v) {
+        out.write(glm::u8vec4(v % 256, 128, 64, 255));
+    }
+    for (auto v = 0u; v < numVerts; ++v) {
+        out.write(glm::vec2(v % rowVerts, v / rowVerts) /
+                  static_cast<float>(gridSize));
+    }
+
+    std::vector<std::uint32_t> indices;
+    indices.reserve(numTris * 3);
+    for (auto y = 0; y < gridSize; ++y) {
+        for (auto x = 0; x < gridSize; ++x) {
+            const auto a = static_cast<std::uint16_t>(y * rowVerts + x);
+            const auto b = static_cast<std::uint16_t>(a + 1);
+            const auto c = static_cast<std::uint16_t>(a + rowVerts);
+            const auto d = static_cast<std::uint16_t>(c + 1);
+            out.write(RW::BSGeometryTriangle{a, b, 0, c});
+            out.write(RW::BSGeometryTriangle{b, d, 0, c});
+            indices.insert(indices.end(), {a, b, c, b, d, c});
+        }
+    }
+
+    const auto extent = static_cast<float>(gridSize);
+    out.write(RW::BSGeometryBounds{glm::vec3(extent / 2.f, extent / 2.f, 0.f),
+                                   extent, 1, 0});
+    for (auto v = 0u; v < numVerts; ++v) {
+        out.write(glm::vec3(v % rowVerts, v / rowVerts, (v % 7) * 0.1f));
+    }
+    out.endChunk();
+
+    out.beginChunk(RW::SID_MaterialList);
+    out.beginChunk(RW::SID_Struct);
+    out.write(std::uint32_t{1});
+    out.write(std::int32_t{-1});
+    out.endChunk();
+    out.beginChunk(RW::SID_Material);
+    out.beginChunk(RW::SID_Struct);
+    out.write(RW::BSMaterial{0, RW::BSColor(255), 0, 1, 1.f, 1.f, 1.f});
+    out.endChunk();
+    out.beginChunk(RW::SID_Texture);
+    out.beginChunk(RW::SID_Struct);
+    out.write(RW::BSTexture{0x1106, 0});
+    out.endChunk();
+    out.beginChunk(RW::SID_String);
+    out.writeString("grid");
+    out.endChunk();
+    out.beginChunk(RW::SID_String);
+    out.writeString("");
+    out.endChunk();
+    out.beginChunk(RW::SID_Extension);
+    out.endChunk();
+    out.endChunk();
+    out.beginChunk(RW::SID_Extension);
+    out.endChunk();
+    out.endChunk();
+    out.endChunk();
+
+    out.beginChunk(RW::SID_Extension);
+    out.beginChunk(RW::SID_BinMeshPLG);
+    out.write(std::uint32_t{0});
+    out.write(std::uint32_t{1});
+    out.write(static_cast<std::uint32_t>(indices.size()));
+    out.write(static_cast<std::uint32_t>(indices.size()));
+    out.write(std::uint32_t{0});
+    out.write(indices.data(), indices.size() * sizeof(std::uint32_t));
+    out.endChunk();
+    out.endChunk();
+
+    out.endChunk();
+}
+}  // namespace
+
+Buffer createClump(int geometries, int gridSize) {
+    SectionWriter out;
+    const auto count = static_cast<std::uint32_t>(geometries);
+
+    out.beginChunk(RW::SID_Clump);
+    out.beginChunk(RW::SID_Struct);
+    out.write(count);
+    out.endChunk();
+
+    out.beginChunk(RW::SID_FrameList);
+    out.beginChunk(RW::SID_Struct);
+    out.write(count + 1);
+    out.write(Frame{});
+    for (auto g = 0; g < geometries; ++g) {
+        Frame frame;
+        frame.position = glm::vec3(g * gridSize, 0.f, 0.f);
+        frame.parent = 0;
+        out.write(frame);
+    }
+    out.endChunk();
+    for (auto f = 0; f <= geometries; ++f) {
+        const auto name = "frame" + std::to_string(f);
+        out.beginChunk(RW::SID_Extension);
+        out.beginChunk(RW::SID_NodeName);
+        out.write(name.data(), name.size());
+        out.endChunk();
+        out.endChunk();
+    }
+    out.endChunk();
+
+    out.beginChunk(RW::SID_GeometryList);
+    out.beginChunk(RW::SID_Struct);
+    out.write(count);
+    out.endChunk();
+    for (auto g = 0; g < geometries; ++g) {
+        writeGeometry(out, gridSize);
+    }
+    out.endChunk();
+
+    for (auto g = 0u; g < count; ++g) {
+        out.beginChunk(RW::SID_Atomic);
+        out.beginChunk(RW::SID_Struct);
+        out.write(g + 1);
+        out.write(g);
+        out.write(std::uint32_t{5});
+        out.write(std::uint32_t{0});
+        out.endChunk();
+        out.beginChunk(RW::SID_Extension);
+        out.endChunk();
+        out.endChunk();
+    }
+
+    out.beginChunk(RW::SID_Extension);
+    out.endChunk();
+    out.endChunk();
+    return out.release();
+}
+
+Buffer createTextureDictionary(int textures, int size) {
+    SectionWriter out;
+    const auto pixels = static_cast<std::uint32_t>(size * size);
+
+    out.beginChunk(RW::SID_TextureDictionary);
+    out.beginChunk(RW::SID_Struct);
+    out.write(RW::BSTextureDictionary{static_cast<std::uint16_t>(textures),
+                                      0});
+    out.endChunk();
+
+    for (auto t = 0; t < textures; ++t) {
+        RW::BSTextureNative native{};
+        native.platform = 8;
+        native.filterflags = RW::BSTextureNative::FILTER_LINEAR;
+        native.wrapU = RW::BSTextureNative::WRAP_WRAP;
+        native.wrapV = RW::BSTextureNative::WRAP_WRAP;
+        std::snprintf(native.diffuseName, sizeof(native.diffuseName),
+                      "texture%d", t);
+        native.rasterformat = RW::BSTextureNative::FORMAT_EXT_PAL8 |
+                              RW::BSTextureNative::FORMAT_8888;
+        native.width = static_cast<std::uint16_t>(size);
+        native.height = static_cast<std::uint16_t>(size);
+        native.bpp = 8;
+        native.nummipmaps = 1;
+        native.rastertype = 4;
+
+        out.beginChunk(RW::SID_TextureNative);
+        out.beginChunk(RW::SID_Struct);
+        // The palette takes the place of the data size
+        out.write(&native, sizeof(native) - sizeof(native.datasize));
+        for (auto c = 0u; c < 256; ++c) {
+            out.write(c * 0x010101u | 0xFF000000u);
+        }
+        out.write(pixels);
+        for (auto p = 0u; p < pixels; ++p) {
+            out.write(static_cast<std::uint8_t>(p * 7 + p / size));
+        }
+        out.endChunk();
+        out.beginChunk(RW::SID_Extension);
+        out.endChunk();
+        out.endChunk();
+    }
+
+    out.beginChunk(RW::SID_Extension);
+    out.endChunk();
+    out.endChunk();
+    return out.release();
+}
+
+Buffer createAnimation(int bones, int keyframes) {
+    SectionWriter out;
+
+    out.beginSection("ANPK");
+    out.beginSection("INFO");
+    out.write(std::int32_t{1});
+    out.writeString("bench");
+    out.endSection();
+
+    out.beginSection("NAME");
+    out.writeString("walk");
+    out.endSection();
+
+    out.beginSection("DGAN");
+    out.beginSection("INFO");
+    out.write(static_cast<std::int32_t>(bones));
+    out.writeString("walk");
+    out.endSection();
+    for (auto b = 0; b < bones; ++b) {
+        out.beginSection("CPAN");
+        out.beginSection("ANIM");
+        char name[28]{};
+        std::snprintf(name, sizeof(name), "bone%d", b);
+        out.write(name);
+        out.write(static_cast<std::int32_t>(keyframes));
+        out.write(std::int32_t{0});
+        out.write(static_cast<std::int32_t>(b + 1 < bones ? b + 1 : -1));
+        out.write(static_cast<std::int32_t>(b - 1));
+        out.endSection();
+
+        out.beginSection("KRT0");
+        for (auto k = 0; k < keyframes; ++k) {
+            const auto time = static_cast<float>(k) / 30.f;
+            out.write(glm::angleAxis(time, glm::vec3(0.f, 0.f, 1.f)));
+            out.write(glm::vec3(0.f, 0.f, time * 0.1f));
+            out.write(time);
+        }
+        out.endSection();
+        out.endSection();
+    }
+    out.endSection();
+    out.endSection();
+    return out.release();
+}
+
+Buffer createScript(int instructionsPerWait) {
+    // Opcodes and argument types, see GTA3Module
+    constexpr std::uint16_t kWait = 0x0001;
+    constexpr std::uint16_t kGoto = 0x0002;
+    constexpr std::uint16_t kSetGlobalInt = 0x0004;
+    constexpr std::uint16_t kAddGlobalInt = 0x0008;
+    constexpr std::uint8_t kInt32 = 1;
+    constexpr std::uint8_t kGlobal = 2;
+    constexpr std::uint8_t kInt8 = 4;
+    constexpr std::uint32_t kGlobalsSize = 16;
+
+    SectionWriter out;
+    auto jump = [&](std::uint32_t target) {
+        out.write(kGoto);
+        out.write(kInt32);
+        out.write(target);
+    };
+
+    // Each section is preceded by a jump over it
+    const std::uint32_t models = 8 + kGlobalsSize;
+    const std::uint32_t missions = models + 8 + 8;
+    const std::uint32_t code = missions + 8 + 12;
+    jump(models);
+    out.write(std::uint8_t{0});
+    out.write(std::vector<char>(kGlobalsSize).data(), kGlobalsSize);
+    jump(missions);
+    out.write(std::uint8_t{0});
+    out.write(std::uint32_t{0});
+    out.write(std::uint32_t{0});
+    jump(code);
+    out.write(std::uint8_t{0});
+    out.write(std::uint32_t{0});
+    out.write(std::uint32_t{0});
+    out.write(std::uint32_t{0});
+
+    out.write(kSetGlobalInt);
+    out.write(kGlobal);
+    out.write(std::uint16_t{0});
+    out.write(kInt8);
+    out.write(std::int8_t{0});
+
+    const auto loop = code + 7;
+    for (auto i = 0; i < instructionsPerWait; ++i) {
+        out.write(kAddGlobalInt);
+        out.write(kGlobal);
+        out.write(std::uint16_t{0});
+        out.write(kInt8);
+        out.write(std::int8_t{1});
+    }
+    out.write(kWait);
+    out.write(kInt8);
+    out.write(std::int8_t{0});
+    jump(loop);
+    return out.release();
+}
+
+std::string createIPL(int instances) {
+    std::ostringstream ss;
+    ss << "# Generated\ninst\n";
+    for (auto i = 0; i < instances; ++i) {
+        ss << 1000 + i % 500 << ", model" << i % 500 << ", " << (i % 100) * 10.f
+           << ", " << (i / 100) * 10.f << ", " << i % 7
+           << ", 1, 1, 1, 0, 0, 0.7071068, 0.7071068\n";
+    }
+    ss << "end\n";
+    return ss.str();
+}
+
+std::string createIDE(int objects) {
+    std::ostringstream ss;
+    ss << "# Generated\nobjs\n";
+    for (auto i = 0; i < objects; ++i) {
+        ss << 1000 + i << ", model" << i << ", txd" << i / 10 << ", 1, "
+           << 100 + i % 200 << ", " << i % 4 << "\n";
+    }
+    ss << "end\n";
+    return ss.str();
+}
+
+FileContentsInfo toFile(const Buffer& buffer) {
+    auto data = std::make_unique<char[]>(buffer.size());
+    std::memcpy(data.get(), buffer.data(), buffer.size());
+    return {std::move(data), buffer.size()};
+}
+
+}  // namespace Fixtures
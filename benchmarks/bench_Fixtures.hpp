@@ -0,0 +1,61 @@
+#ifndef _RWBENCH_FIXTURES_HPP_
+#define _RWBENCH_FIXTURES_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <platform/FileHandle.hpp>
+
+/**
+ * Synthetic game files, so the benchmarks run without the game data.
+ *
+ * They are shaped like the files from the game, but the sizes are chosen by
+ * the benchmark.
+ */
+namespace Fixtures {
+
+using Buffer = std::vector<char>;
+
+/**
+ * A clump with a frame and atomic for each geometry. Each geometry is a
+ * grid of quads with texture coordinates and vertex colours but no normals,
+ * like most of the map.
+ */
+Buffer createClump(int geometries, int gridSize);
+
+/**
+ * A texture dictionary of 8 bit palettised textures
+ */
+Buffer createTextureDictionary(int textures, int size);
+
+/**
+ * An animation package with a single animation, with rotation and
+ * translation keyframes for each bone named "bone<N>"
+ */
+Buffer createAnimation(int bones, int keyframes);
+
+/**
+ * A script that adds to a global variable in a loop, waiting after each
+ * set of instructions
+ */
+Buffer createScript(int instructionsPerWait);
+
+/**
+ * An item placement file with inst entries
+ */
+std::string createIPL(int instances);
+
+/**
+ * An item definition file with objs entries
+ */
+std::string createIDE(int objects);
+
+/**
+ * @return A copy of the buffer, as returned by the file index
+ */
+FileContentsInfo toFile(const Buffer& buffer);
+
+}  // namespace Fixtures
+
+#endif
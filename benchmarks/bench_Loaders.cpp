@@ -0,0 +1,280 @@
+#include <benchmark/benchmark.h>
+#include <data/Clump.hpp>
+#include <data/InstanceData.hpp>
+#include <data/ModelData.hpp>
+#include <data/PedData.hpp>
+#include <loaders/LoaderDFF.hpp>
+#include <loaders/LoaderIDE.hpp>
+#include <loaders/LoaderIFP.hpp>
+#include <loaders/LoaderIMG.hpp>
+#include <loaders/LoaderIPL.hpp>
+#include <loaders/LoaderTXD.hpp>
+#include <loaders/RWBinaryStream.hpp>
+#include <platform/FileHandle.hpp>
+#include <platform/FileIndex.hpp>
+#include "bench_Fixtures.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#if RW_BENCH_WITH_DATA
+#include <GameConfig.hpp>
+#endif
+
+namespace {
+/**
+ * Counts the chunks inside the current chunk of parent and all of their
+ * children
+ */
+size_t walkChunks(const RWBStream& parent) {
+    // The stream reads on past the end of a chunk that isn't followed by an
+    // empty one, so stop at the parent's end
+    const auto end = parent.getCursor() + parent.getCurrentChunkSize();
+    auto stream = parent.getInnerStream();
+
+    size_t chunks = 0;
+    for (auto id = stream.getNextChunk(); id != 0;
+         id = stream.getNextChunk()) {
+        if (stream.getCursor() + stream.getCurrentChunkSize() > end) {
+            break;
+        }
+        ++chunks;
+        switch (id) {
+            case RW::SID_Extension:
+            case RW::SID_Texture:
+            case RW::SID_Material:
+            case RW::SID_MaterialList:
+            case RW::SID_FrameList:
+            case RW::SID_Geometry:
+            case RW::SID_Clump:
+            case RW::SID_Atomic:
+            case RW::SID_GeometryList:
+                chunks += walkChunks(stream);
+                break;
+            default:
+                break;
+        }
+    }
+    return chunks;
+}
+
+/**
+ * A directory with a loose file and an archive of the same files
+ */
+struct IndexFixture {
+    static constexpr int kAssets = 256;
+    static constexpr std::uint32_t kAssetSectors = 4;
+
+    rwfs::path root = rwfs::temp_directory_path() / "openrw_bench_index";
+    FileIndex index;
+
+    IndexFixture() {
+        rwfs::create_directories(root / "models");
+
+        const auto clump = Fixtures::createClump(4, 8);
+        std::vector<char> asset(kAssetSectors * 2048);
+        std::memcpy(asset.data(), clump.data(),
+                    std::min(asset.size(), clump.size()));
+
+        std::ofstream((root / "loose.dff").string(), std::ios::binary)
+            .write(asset.data(), asset.size());
+
+        std::ofstream dir((root / "models" / "bench.dir").string(),
+                          std::ios::binary);
+        std::ofstream img((root / "models" / "bench.img").string(),
+                          std::ios::binary);
+        for (auto i = 0; i < kAssets; ++i) {
+            LoaderIMGFile entry{};
+            entry.offset = static_cast<std::uint32_t>(i) * kAssetSectors;
+            entry.size = kAssetSectors;
+            std::snprintf(entry.name, sizeof(entry.name), "asset%d.dff", i);
+            dir.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+            img.write(asset.data(), asset.size());
+        }
+        dir.close();
+        img.close();
+
+        index.indexTree(root);
+        index.indexArchive("models/bench.img");
+    }
+
+    ~IndexFixture() {
+        rwfs::remove_all(root);
+    }
+
+    static IndexFixture& get() {
+        static IndexFixture fixture;
+        return fixture;
+    }
+};
+
+#if RW_BENCH_WITH_DATA
+std::string getGamePath() {
+    GameConfig config;
+    config.loadFile(GameConfig::getDefaultConfigPath() / "openrw.ini");
+    return config.getGameDataPath().string();
+}
+#endif
+}  // namespace
+
+static void BM_RWBStreamWalk(benchmark::State& state) {
+    auto file = Fixtures::createClump(static_cast<int>(state.range(0)), 16);
+    for (auto _ : state) {
+        RWBStream stream(file.data(), file.size());
+        stream.getNextChunk();
+        benchmark::DoNotOptimize(walkChunks(stream));
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(file.size()));
+}
+BENCHMARK(BM_RWBStreamWalk)->Arg(1)->Arg(16)->Arg(128);
+
+static void BM_LoaderDFF(benchmark::State& state) {
+    auto file = Fixtures::toFile(Fixtures::createClump(
+        static_cast<int>(state.range(0)), static_cast<int>(state.range(1))));
+    LoaderDFF loader;
+    for (auto _ : state) {
+        auto clump = loader.loadFromMemory(file);
+        benchmark::DoNotOptimize(clump);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(file.length));
+}
+BENCHMARK(BM_LoaderDFF)
+    ->Args({1, 4})
+    ->Args({16, 16})
+    ->Args({4, 64})
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_TextureLoaderPalette(benchmark::State& state) {
+    auto file = Fixtures::toFile(Fixtures::createTextureDictionary(
+        4, static_cast<int>(state.range(0))));
+    TextureLoader loader;
+    for (auto _ : state) {
+        TextureArchive textures;
+        loader.loadFromMemory(file, textures);
+        benchmark::DoNotOptimize(textures);
+    }
+    state.SetItemsProcessed(state.iterations() * 4 * state.range(0) *
+                            state.range(0));
+}
+BENCHMARK(BM_TextureLoaderPalette)
+    ->Arg(64)
+    ->Arg(256)
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_TextureDecodePalette(benchmark::State& state) {
+    auto file = Fixtures::toFile(Fixtures::createTextureDictionary(
+        4, static_cast<int>(state.range(0))));
+    TextureLoader loader;
+    for (auto _ : state) {
+        std::vector<TextureImage> images;
+        loader.decode(file, images);
+        benchmark::DoNotOptimize(images);
+    }
+    state.SetItemsProcessed(state.iterations() * 4 * state.range(0) *
+                            state.range(0));
+}
+BENCHMARK(BM_TextureDecodePalette)
+    ->Arg(64)
+    ->Arg(256)
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_LoaderIFP(benchmark::State& state) {
+    auto file = Fixtures::createAnimation(static_cast<int>(state.range(0)),
+                                          static_cast<int>(state.range(1)));
+    for (auto _ : state) {
+        LoaderIFP loader;
+        loader.loadFromMemory(file.data());
+        benchmark::DoNotOptimize(loader.animations);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(file.size()));
+
+    LoaderIFP loader;
+    loader.loadFromMemory(file.data());
+    const auto& animation = *loader.animations.begin()->second;
+    state.counters["BytesPerKeyframe"] =
+        static_cast<double>(animation.tracks.getBytes()) /
+        static_cast<double>(animation.getKeyframeCount());
+}
+BENCHMARK(BM_LoaderIFP)->Args({32, 30})->Args({32, 300});
+
+static void BM_LoaderIPL(benchmark::State& state) {
+    const auto text = Fixtures::createIPL(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        std::istringstream stream(text);
+        LoaderIPL loader;
+        loader.load(stream);
+        benchmark::DoNotOptimize(loader.m_instances);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LoaderIPL)->Arg(1000)->Arg(10000);
+
+static void BM_LoaderIDE(benchmark::State& state) {
+    const auto text = Fixtures::createIDE(static_cast<int>(state.range(0)));
+    const PedStatsList stats;
+    for (auto _ : state) {
+        std::istringstream stream(text);
+        LoaderIDE loader;
+        loader.load(stream, stats);
+        benchmark::DoNotOptimize(loader.objects);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LoaderIDE)->Arg(1000)->Arg(10000);
+
+static void BM_FileIndexOpenFile(benchmark::State& state) {
+    auto& index = IndexFixture::get().index;
+    for (auto _ : state) {
+        auto file = index.openFile("loose.dff");
+        benchmark::DoNotOptimize(file.data);
+    }
+}
+BENCHMARK(BM_FileIndexOpenFile);
+
+static void BM_FileIndexOpenArchived(benchmark::State& state) {
+    auto& index = IndexFixture::get().index;
+    int asset = 0;
+    for (auto _ : state) {
+        auto file = index.openFile("asset" + std::to_string(asset) + ".dff");
+        benchmark::DoNotOptimize(file.data);
+        asset = (asset + 37) % IndexFixture::kAssets;
+    }
+}
+BENCHMARK(BM_FileIndexOpenArchived);
+
+#if RW_BENCH_WITH_DATA
+static void BM_GameLoaderDFF(benchmark::State& state) {
+    FileIndex index;
+    index.indexTree(getGamePath());
+    index.indexArchive("models/gta3.img");
+    auto file = index.openFile("landstal.dff");
+    if (!file.data) {
+        state.SkipWithError("landstal.dff not found");
+        return;
+    }
+
+    LoaderDFF loader;
+    for (auto _ : state) {
+        auto clump = loader.loadFromMemory(file);
+        benchmark::DoNotOptimize(clump);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(file.length));
+}
+BENCHMARK(BM_GameLoaderDFF)->Unit(benchmark::kMicrosecond);
+
+static void BM_GameFileIndexOpenArchived(benchmark::State& state) {
+    FileIndex index;
+    index.indexTree(getGamePath());
+    index.indexArchive("models/gta3.img");
+    for (auto _ : state) {
+        auto file = index.openFile("landstal.dff");
+        benchmark::DoNotOptimize(file.data);
+    }
+}
+BENCHMARK(BM_GameFileIndexOpenArchived);
+#endif
@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+#include <core/Logger.hpp>
+#include <data/Clump.hpp>
+#include <engine/Animator.hpp>
+#include <engine/GameData.hpp>
+#include <engine/GameState.hpp>
+#include <engine/GameWorld.hpp>
+#include <loaders/LoaderIFP.hpp>
+#include <script/SCMFile.hpp>
+#include <script/ScriptMachine.hpp>
+#include <script/modules/GTA3Module.hpp>
+#include "bench_Fixtures.hpp"
+
+#include <string>
+
+static void BM_ScriptMachineExecute(benchmark::State& state) {
+    const auto instructions = static_cast<int>(state.range(0));
+    auto data = Fixtures::createScript(instructions);
+
+    // The machine only needs the world to look for the player
+    Logger log;
+    GameData gameData(&log, "");
+    GameWorld world(&log, &gameData);
+    GameState gameState;
+    world.state = &gameState;
+    gameState.world = &world;
+
+    SCMFile file;
+    file.loadFile(data.data(), static_cast<unsigned int>(data.size()));
+    GTA3Module module;
+    ScriptMachine machine(&gameState, &file, &module);
+    gameState.script = &machine;
+    machine.startThread(file.getCodeSection());
+
+    for (auto _ : state) {
+        machine.execute(1.f / 30.f);
+    }
+    // The adds, the wait and the jump back
+    state.SetItemsProcessed(state.iterations() * (instructions + 2));
+}
+BENCHMARK(BM_ScriptMachineExecute)->Arg(10)->Arg(100)->Arg(1000);
+
+static void BM_AnimatorTick(benchmark::State& state) {
+    const auto bones = static_cast<int>(state.range(0));
+
+    LoaderIFP loader;
+    auto data = Fixtures::createAnimation(bones, 60);
+    loader.loadFromMemory(data.data());
+    auto animation = loader.animations.at("walk");
+
+    // A chain of frames, like a ped's skeleton
+    auto root = std::make_shared<ModelFrame>(0);
+    root->setName("root");
+    auto parent = root;
+    for (auto b = 0; b < bones; ++b) {
+        auto frame = std::make_shared<ModelFrame>(b + 1);
+        frame->setName("bone" + std::to_string(b));
+        parent->addChild(frame);
+        parent = frame;
+    }
+    auto clump = std::make_shared<Clump>();
+    clump->setFrame(root);
+
+    Animator animator(clump);
+    animator.playAnimation(0, animation, 1.f, true);
+
+    for (auto _ : state) {
+        animator.tick(1.f / 30.f);
+        benchmark::DoNotOptimize(root->getWorldTransform());
+    }
+    state.SetItemsProcessed(state.iterations() * bones);
+}
+BENCHMARK(BM_AnimatorTick)->Arg(16)->Arg(64);
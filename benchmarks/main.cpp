@@ -0,0 +1,28 @@
+#include <benchmark/benchmark.h>
+#include <GameWindow.hpp>
+
+#include <SDL.h>
+
+#include <iostream>
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    // The loaders upload to GL as they go
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        std::cerr << "Failed to initialize SDL2: " << SDL_GetError()
+                  << std::endl;
+        return 1;
+    }
+    GameWindow window;
+    window.create("Benchmarks", 800, 600, false, false);
+
+    benchmark::RunSpecifiedBenchmarks();
+
+    window.close();
+    SDL_Quit();
+    return 0;
+}
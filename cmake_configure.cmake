@@ -58,6 +58,7 @@ target_compile_definitions(rw_interface
         "GLM_ENABLE_EXPERIMENTAL"
         "$<$<BOOL:${RW_VERBOSE_DEBUG_MESSAGES}>:RW_VERBOSE_DEBUG_MESSAGES>"
         "$<$<BOOL:${ENABLE_PROFILING}>:RW_PROFILER>"
+        "$<$<BOOL:${ENABLE_MEMORY_TRACKING}>:RW_MEMORY_TRACKING>"
     )
 
 if(CMAKE_SYSTEM_NAME STREQUAL "Linux")
@@ -2,10 +2,13 @@ option(RW_VERBOSE_DEBUG_MESSAGES "Print verbose debugging messages" ON)
 
 option(BUILD_TOOLS "Build tools")
 option(BUILD_TESTS "Build test suite")
+option(BUILD_BENCHMARKS "Build micro-benchmarks (requires Google Benchmark)")
 option(BUILD_VIEWER "Build GUI data viewer")
 
 option(ENABLE_SCRIPT_DEBUG "Enable verbose script execution")
 option(ENABLE_PROFILING "Enable detailed profiling metrics")
+option(ENABLE_MEMORY_TRACKING "Count every heap allocation per subsystem (slow)")
+set(SCRIPT_NATIVE_SOURCE "" CACHE FILEPATH "Source generated by scmtranslate to build into the GTA3 script module")
 
 option(TESTS_NODATA "Build tests for no-data testing")
 
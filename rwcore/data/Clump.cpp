@@ -113,6 +113,24 @@ void Clump::recalculateMetrics() {
     }
 }
 
+void Clump::updateMemoryUsage() {
+    size_t frames = 0;
+    std::queue<ModelFrame*> open;
+    if (rootframe_) {
+        open.push(rootframe_.get());
+    }
+    while (!open.empty()) {
+        auto frame = open.front();
+        open.pop();
+        frames++;
+        for (const auto& child : frame->getChildren()) {
+            open.push(child.get());
+        }
+    }
+    memory_.set(sizeof(Clump) + atomics_.size() * sizeof(Atomic) +
+                frames * sizeof(ModelFrame));
+}
+
 Clump* Clump::clone() const {
     // Clone frame hierarchy
     auto newroot = rootframe_->cloneHierarchy();
@@ -14,6 +14,7 @@
 #include <loaders/RWBinaryStream.hpp>
 
 #include <rw/forward.hpp>
+#include <rw/memorystats.hpp>
 
 /**
  * ModelFrame stores transformation hierarchy
@@ -185,6 +186,9 @@ struct Geometry {
     std::vector<Material> materials;
     std::vector<SubGeometry> subgeom;
 
+    /// Vertex and index data, uploaded and kept in subgeom
+    TrackedMemory<MemoryTag::Geometry> memory;
+
     Geometry();
     ~Geometry();
 };
@@ -261,6 +265,7 @@ public:
 
     void addAtomic(const AtomicPtr& atomic) {
         atomics_.push_back(atomic);
+        updateMemoryUsage();
     }
 
     const AtomicList& getAtomics() const {
@@ -269,6 +274,7 @@ public:
 
     void setFrame(const ModelFramePtr& root) {
         rootframe_ = root;
+        updateMemoryUsage();
     }
 
     const ModelFramePtr& getFrame() const {
@@ -284,6 +290,10 @@ private:
     float boundingRadius;
     AtomicList atomics_;
     ModelFramePtr rootframe_;
+    TrackedMemory<MemoryTag::Clumps> memory_;
+
+    /// Accounts for the clump, its atomics and frame hierarchy
+    void updateMemoryUsage();
 };
 
 #endif
@@ -18,3 +18,17 @@ void GeometryBuffer::uploadVertices(GLsizei num, GLsizeiptr size,
     glBindBuffer(GL_ARRAY_BUFFER, vbo);
     glBufferData(GL_ARRAY_BUFFER, size, mem, GL_STATIC_DRAW);
 }
+
+void* GeometryBuffer::mapVertices(GLsizei num, GLsizeiptr size) {
+    uploadVertices(num, size, nullptr);
+    if (size == 0) {
+        return nullptr;
+    }
+    return glMapBufferRange(GL_ARRAY_BUFFER, 0, size,
+                            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+}
+
+bool GeometryBuffer::unmapVertices() {
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    return glUnmapBuffer(GL_ARRAY_BUFFER) == GL_TRUE;
+}
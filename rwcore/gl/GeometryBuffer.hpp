@@ -75,6 +75,26 @@ public:
      */
     void uploadVertices(GLsizei num, GLsizeiptr size, const GLvoid* mem);
 
+    /**
+     * Allocates storage for num vertices and maps it for writing, so they
+     * can be decoded in place. unmapVertices() must be called before the
+     * buffer is drawn.
+     * @return nullptr if the buffer couldn't be mapped
+     */
+    template <class T>
+    T* mapVertices(GLsizei num) {
+        attributes = T::vertex_attributes();
+        return static_cast<T*>(mapVertices(num, num * sizeof(T)));
+    }
+
+    void* mapVertices(GLsizei num, GLsizeiptr size);
+
+    /**
+     * @return false if the contents were lost while mapped and have to be
+     * uploaded again
+     */
+    bool unmapVertices();
+
     const AttributeList& getDataAttributes() const {
         return attributes;
     }
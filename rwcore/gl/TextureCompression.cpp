@@ -0,0 +1,385 @@
+#include "gl/TextureCompression.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace TextureCompression {
+
+namespace {
+constexpr int kBlockPixels = 16;
+constexpr size_t kDXT1BlockSize = 8;
+constexpr size_t kDXT5BlockSize = 16;
+
+using Block = std::uint8_t[kBlockPixels * 4];
+
+/// Copies a 4x4 block, repeating the edge pixels of images that aren't a
+/// multiple of 4 in size
+void fetchBlock(const std::uint8_t* rgba, int width, int height, int bx,
+                int by, Block block) {
+    for (int y = 0; y < 4; ++y) {
+        auto sy = std::min(by * 4 + y, height - 1);
+        for (int x = 0; x < 4; ++x) {
+            auto sx = std::min(bx * 4 + x, width - 1);
+            auto src = rgba + (sy * width + sx) * 4;
+            std::copy(src, src + 4, block + (y * 4 + x) * 4);
+        }
+    }
+}
+
+void storeBlock(const Block block, int width, int height, int bx, int by,
+                std::uint8_t* rgba) {
+    for (int y = 0; y < 4 && by * 4 + y < height; ++y) {
+        for (int x = 0; x < 4 && bx * 4 + x < width; ++x) {
+            auto src = block + (y * 4 + x) * 4;
+            std::copy(src, src + 4,
+                      rgba + ((by * 4 + y) * width + bx * 4 + x) * 4);
+        }
+    }
+}
+
+std::uint16_t packColor(const float* color) {
+    auto quantize = [](float value, int max) {
+        auto scaled = std::lround(value * static_cast<float>(max) / 255.f);
+        return static_cast<std::uint16_t>(
+            std::max<long>(0, std::min<long>(max, scaled)));
+    };
+    return static_cast<std::uint16_t>(quantize(color[0], 31) << 11 |
+                                      quantize(color[1], 63) << 5 |
+                                      quantize(color[2], 31));
+}
+
+void unpackColor(std::uint16_t packed, int* color) {
+    auto r = (packed >> 11) & 0x1F;
+    auto g = (packed >> 5) & 0x3F;
+    auto b = packed & 0x1F;
+    color[0] = (r << 3) | (r >> 2);
+    color[1] = (g << 2) | (g >> 4);
+    color[2] = (b << 3) | (b >> 2);
+}
+
+/// Colours a block can use, the last one is transparent black in three
+/// colour mode
+void colorPalette(std::uint16_t c0, std::uint16_t c1, bool fourColors,
+                  int palette[4][4]) {
+    unpackColor(c0, palette[0]);
+    unpackColor(c1, palette[1]);
+    for (int c = 0; c < 3; ++c) {
+        if (fourColors) {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        } else {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+    }
+    palette[0][3] = palette[1][3] = palette[2][3] = 255;
+    palette[3][3] = fourColors ? 255 : 0;
+}
+
+void writeLE16(std::uint8_t* out, std::uint16_t value) {
+    out[0] = static_cast<std::uint8_t>(value & 0xFF);
+    out[1] = static_cast<std::uint8_t>(value >> 8);
+}
+
+std::uint16_t readLE16(const std::uint8_t* in) {
+    return static_cast<std::uint16_t>(in[0] | in[1] << 8);
+}
+
+/**
+ * Picks the two end colours along the main axis of the block's colours and
+ * maps each pixel to the closest of the four palette entries.
+ */
+void encodeColorBlock(const Block block, std::uint8_t* out) {
+    float mean[3] = {0.f, 0.f, 0.f};
+    for (int i = 0; i < kBlockPixels; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            mean[c] += block[i * 4 + c];
+        }
+    }
+    for (auto& m : mean) {
+        m /= kBlockPixels;
+    }
+
+    // Covariance, then a few power iterations for its main eigenvector
+    float cov[6] = {0.f, 0.f, 0.f, 0.f, 0.f, 0.f};
+    for (int i = 0; i < kBlockPixels; ++i) {
+        auto r = block[i * 4 + 0] - mean[0];
+        auto g = block[i * 4 + 1] - mean[1];
+        auto b = block[i * 4 + 2] - mean[2];
+        cov[0] += r * r;
+        cov[1] += r * g;
+        cov[2] += r * b;
+        cov[3] += g * g;
+        cov[4] += g * b;
+        cov[5] += b * b;
+    }
+
+    float axis[3] = {1.f, 1.f, 1.f};
+    for (int iteration = 0; iteration < 4; ++iteration) {
+        float next[3] = {
+            cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2],
+            cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2],
+            cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2]};
+        auto largest = std::max(
+            {std::abs(next[0]), std::abs(next[1]), std::abs(next[2])});
+        if (largest < 1e-4f) {
+            // Flat block, any axis works
+            break;
+        }
+        for (int c = 0; c < 3; ++c) {
+            axis[c] = next[c] / largest;
+        }
+    }
+
+    int minIndex = 0;
+    int maxIndex = 0;
+    float minProjection = 0.f;
+    float maxProjection = 0.f;
+    for (int i = 0; i < kBlockPixels; ++i) {
+        auto projection = block[i * 4 + 0] * axis[0] +
+                          block[i * 4 + 1] * axis[1] +
+                          block[i * 4 + 2] * axis[2];
+        if (i == 0 || projection < minProjection) {
+            minProjection = projection;
+            minIndex = i;
+        }
+        if (i == 0 || projection > maxProjection) {
+            maxProjection = projection;
+            maxIndex = i;
+        }
+    }
+
+    float endpoints[2][3];
+    for (int c = 0; c < 3; ++c) {
+        endpoints[0][c] = block[maxIndex * 4 + c];
+        endpoints[1][c] = block[minIndex * 4 + c];
+    }
+    auto c0 = packColor(endpoints[0]);
+    auto c1 = packColor(endpoints[1]);
+
+    // c0 > c1 selects four colour mode, which DXT5 always uses
+    if (c0 < c1) {
+        std::swap(c0, c1);
+    }
+    writeLE16(out, c0);
+    writeLE16(out + 2, c1);
+
+    std::uint32_t indices = 0;
+    if (c0 != c1) {
+        int palette[4][4];
+        colorPalette(c0, c1, true, palette);
+        for (int i = 0; i < kBlockPixels; ++i) {
+            int best = 0;
+            int bestError = 0;
+            for (int p = 0; p < 4; ++p) {
+                int error = 0;
+                for (int c = 0; c < 3; ++c) {
+                    auto d = block[i * 4 + c] - palette[p][c];
+                    error += d * d;
+                }
+                if (p == 0 || error < bestError) {
+                    best = p;
+                    bestError = error;
+                }
+            }
+            indices |= static_cast<std::uint32_t>(best) << (i * 2);
+        }
+    }
+    for (int b = 0; b < 4; ++b) {
+        out[4 + b] = static_cast<std::uint8_t>(indices >> (b * 8));
+    }
+}
+
+void decodeColorBlock(const std::uint8_t* in, bool alwaysFourColors,
+                      Block block) {
+    auto c0 = readLE16(in);
+    auto c1 = readLE16(in + 2);
+    int palette[4][4];
+    colorPalette(c0, c1, alwaysFourColors || c0 > c1, palette);
+
+    std::uint32_t indices = static_cast<std::uint32_t>(in[4]) |
+                            static_cast<std::uint32_t>(in[5]) << 8 |
+                            static_cast<std::uint32_t>(in[6]) << 16 |
+                            static_cast<std::uint32_t>(in[7]) << 24;
+    for (int i = 0; i < kBlockPixels; ++i) {
+        auto p = (indices >> (i * 2)) & 0x3;
+        for (int c = 0; c < 4; ++c) {
+            block[i * 4 + c] = static_cast<std::uint8_t>(palette[p][c]);
+        }
+    }
+}
+
+void alphaPalette(int a0, int a1, int palette[8]) {
+    palette[0] = a0;
+    palette[1] = a1;
+    if (a0 > a1) {
+        for (int i = 2; i < 8; ++i) {
+            palette[i] = ((8 - i) * a0 + (i - 1) * a1) / 7;
+        }
+    } else {
+        for (int i = 2; i < 6; ++i) {
+            palette[i] = ((6 - i) * a0 + (i - 1) * a1) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+void encodeAlphaBlock(const Block block, std::uint8_t* out) {
+    int a0 = 0;
+    int a1 = 255;
+    for (int i = 0; i < kBlockPixels; ++i) {
+        a0 = std::max<int>(a0, block[i * 4 + 3]);
+        a1 = std::min<int>(a1, block[i * 4 + 3]);
+    }
+    out[0] = static_cast<std::uint8_t>(a0);
+    out[1] = static_cast<std::uint8_t>(a1);
+
+    std::uint64_t indices = 0;
+    if (a0 != a1) {
+        int palette[8];
+        alphaPalette(a0, a1, palette);
+        for (int i = 0; i < kBlockPixels; ++i) {
+            int best = 0;
+            for (int p = 1; p < 8; ++p) {
+                if (std::abs(block[i * 4 + 3] - palette[p]) <
+                    std::abs(block[i * 4 + 3] - palette[best])) {
+                    best = p;
+                }
+            }
+            indices |= static_cast<std::uint64_t>(best) << (i * 3);
+        }
+    }
+    for (int b = 0; b < 6; ++b) {
+        out[2 + b] = static_cast<std::uint8_t>(indices >> (b * 8));
+    }
+}
+
+void decodeAlphaBlock(const std::uint8_t* in, Block block) {
+    int palette[8];
+    alphaPalette(in[0], in[1], palette);
+
+    std::uint64_t indices = 0;
+    for (int b = 0; b < 6; ++b) {
+        indices |= static_cast<std::uint64_t>(in[2 + b]) << (b * 8);
+    }
+    for (int i = 0; i < kBlockPixels; ++i) {
+        block[i * 4 + 3] =
+            static_cast<std::uint8_t>(palette[(indices >> (i * 3)) & 0x7]);
+    }
+}
+}  // namespace
+
+size_t getLevelSize(Format format, int width, int height) {
+    auto w = static_cast<size_t>(std::max(width, 1));
+    auto h = static_cast<size_t>(std::max(height, 1));
+    switch (format) {
+        case Format::DXT1:
+            return ((w + 3) / 4) * ((h + 3) / 4) * kDXT1BlockSize;
+        case Format::DXT5:
+            return ((w + 3) / 4) * ((h + 3) / 4) * kDXT5BlockSize;
+        case Format::RGBA8:
+        default:
+            return w * h * 4;
+    }
+}
+
+Format chooseFormat(const std::uint8_t* rgba, int width, int height) {
+    for (int i = 0; i < width * height; ++i) {
+        if (rgba[i * 4 + 3] != 255) {
+            return Format::DXT5;
+        }
+    }
+    return Format::DXT1;
+}
+
+std::vector<Level> buildMipChain(const std::uint8_t* rgba, int width,
+                                 int height) {
+    std::vector<Level> levels;
+    levels.emplace_back(rgba, rgba + width * height * 4);
+
+    while (width > 1 || height > 1) {
+        auto nextWidth = std::max(width / 2, 1);
+        auto nextHeight = std::max(height / 2, 1);
+        const auto& source = levels.back();
+        Level next(static_cast<size_t>(nextWidth * nextHeight * 4));
+
+        for (int y = 0; y < nextHeight; ++y) {
+            auto y0 = std::min(y * 2, height - 1);
+            auto y1 = std::min(y * 2 + 1, height - 1);
+            for (int x = 0; x < nextWidth; ++x) {
+                auto x0 = std::min(x * 2, width - 1);
+                auto x1 = std::min(x * 2 + 1, width - 1);
+                for (int c = 0; c < 4; ++c) {
+                    auto sum = source[(y0 * width + x0) * 4 + c] +
+                               source[(y0 * width + x1) * 4 + c] +
+                               source[(y1 * width + x0) * 4 + c] +
+                               source[(y1 * width + x1) * 4 + c];
+                    next[(y * nextWidth + x) * 4 + c] =
+                        static_cast<std::uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+
+        levels.push_back(std::move(next));
+        width = nextWidth;
+        height = nextHeight;
+    }
+
+    return levels;
+}
+
+Level compress(Format format, const std::uint8_t* rgba, int width,
+               int height) {
+    if (format == Format::RGBA8) {
+        return Level(rgba, rgba + width * height * 4);
+    }
+
+    Level out(getLevelSize(format, width, height));
+    auto blockSize = format == Format::DXT1 ? kDXT1BlockSize : kDXT5BlockSize;
+    auto dest = out.data();
+
+    Block block;
+    for (int by = 0; by < (height + 3) / 4; ++by) {
+        for (int bx = 0; bx < (width + 3) / 4; ++bx) {
+            fetchBlock(rgba, width, height, bx, by, block);
+            if (format == Format::DXT5) {
+                encodeAlphaBlock(block, dest);
+                encodeColorBlock(block, dest + 8);
+            } else {
+                encodeColorBlock(block, dest);
+            }
+            dest += blockSize;
+        }
+    }
+
+    return out;
+}
+
+Level decompress(Format format, const std::uint8_t* data, int width,
+                 int height) {
+    if (format == Format::RGBA8) {
+        return Level(data, data + width * height * 4);
+    }
+
+    Level out(getLevelSize(Format::RGBA8, width, height));
+    auto blockSize = format == Format::DXT1 ? kDXT1BlockSize : kDXT5BlockSize;
+
+    Block block;
+    for (int by = 0; by < (height + 3) / 4; ++by) {
+        for (int bx = 0; bx < (width + 3) / 4; ++bx) {
+            if (format == Format::DXT5) {
+                decodeColorBlock(data + 8, true, block);
+                decodeAlphaBlock(data, block);
+            } else {
+                decodeColorBlock(data, false, block);
+            }
+            storeBlock(block, width, height, bx, by, out.data());
+            data += blockSize;
+        }
+    }
+
+    return out;
+}
+
+}  // namespace TextureCompression
@@ -0,0 +1,53 @@
+#ifndef _LIBRW_TEXTURECOMPRESSION_HPP_
+#define _LIBRW_TEXTURECOMPRESSION_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * CPU side encoding and decoding of the S3TC block formats.
+ *
+ * Images are 8 bit RGBA. Both formats store 4x4 pixel blocks: DXT1 in 8
+ * bytes for opaque images and DXT5 in 16 bytes when there is alpha, against
+ * 64 bytes uncompressed. None of this touches GL.
+ */
+namespace TextureCompression {
+
+enum class Format : std::uint8_t {
+    RGBA8 = 0,
+    DXT1 = 1,
+    DXT5 = 2,
+};
+
+using Level = std::vector<std::uint8_t>;
+
+/**
+ * @return Bytes used by one level of the given size
+ */
+size_t getLevelSize(Format format, int width, int height);
+
+/**
+ * @return DXT1 if every pixel is opaque, otherwise DXT5
+ */
+Format chooseFormat(const std::uint8_t* rgba, int width, int height);
+
+/**
+ * Builds every mipmap level down to 1x1 by averaging 2x2 pixels. The first
+ * level is a copy of the input.
+ */
+std::vector<Level> buildMipChain(const std::uint8_t* rgba, int width,
+                                 int height);
+
+Level compress(Format format, const std::uint8_t* rgba, int width,
+               int height);
+
+/**
+ * @return The level decoded to RGBA
+ */
+Level decompress(Format format, const std::uint8_t* data, int width,
+                 int height);
+
+}  // namespace TextureCompression
+
+#endif
@@ -2,18 +2,26 @@
 #define _LIBRW_TEXTUREDATA_HPP_
 #include <gl/gl_core_3_3.h>
 #include <glm/glm.hpp>
+#include <cstddef>
 #include <map>
 
 #include <memory>
 #include <string>
 
+#include <rw/memorystats.hpp>
+
 /**
  * Stores a handle and metadata about a loaded texture.
  */
 class TextureData {
 public:
-    TextureData(GLuint name, const glm::ivec2& dims, bool alpha)
-        : texName(name), size(dims), hasAlpha(alpha) {
+    TextureData(GLuint name, const glm::ivec2& dims, bool alpha,
+                size_t bytes = 0)
+        : texName(name), size(dims), hasAlpha(alpha), gpuBytes(bytes) {
+        // Assume uncompressed RGBA when the size isn't known
+        memory.set(bytes != 0 ? bytes
+                              : static_cast<size_t>(dims.x) *
+                                    static_cast<size_t>(dims.y) * 4);
     }
 
     ~TextureData() {
@@ -32,17 +40,26 @@ public:
         return hasAlpha;
     }
 
+    /**
+     * @return Video memory used by all levels, 0 if not known
+     */
+    size_t getGPUBytes() const {
+        return gpuBytes;
+    }
+
     typedef std::shared_ptr<TextureData> Handle;
 
     static Handle create(GLuint name, const glm::ivec2& size,
-                         bool transparent) {
-        return std::make_shared<TextureData>(name, size, transparent);
+                         bool transparent, size_t bytes = 0) {
+        return std::make_shared<TextureData>(name, size, transparent, bytes);
     }
 
 private:
     GLuint texName;
     glm::ivec2 size;
     bool hasAlpha;
+    size_t gpuBytes;
+    TrackedMemory<MemoryTag::Textures> memory;
 };
 using TextureArchive = std::map<std::string, TextureData::Handle>;
 
@@ -10,6 +10,11 @@
 
 #include <glm/glm.hpp>
 
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define RW_DFF_SSE_NORMALS 1
+#endif
+
 #include "data/Clump.hpp"
 #include "gl/gl_core_3_3.h"
 #include "loaders/RWBinaryStream.hpp"
@@ -173,65 +178,40 @@ GeometryPtr LoaderDFF::readGeometry(const RWBStream &stream) {
     /*unsigned int numFrames = bit_cast<std::uint32_t>(*headerPtr);*/
     headerPtr += sizeof(std::uint32_t);
 
-    std::vector<GeometryVertex> verts;
-    verts.resize(numVerts);
-
     if (geomStream.getChunkVersion() < 0x1003FFFF) {
         headerPtr += sizeof(RW::BSGeometryColor);
     }
 
     /// @todo extract magic numbers.
 
+    // Locate each vertex stream, they are decoded once the buffer exists
+    DFFVertexStreams streams;
+    streams.numVerts = numVerts;
+    streams.numTris = numTris;
+
     if ((geom->flags & 8) == 8) {
-        for (size_t v = 0; v < numVerts; ++v) {
-            verts[v].colour = bit_cast<glm::u8vec4>(*headerPtr);
-            headerPtr += sizeof(glm::u8vec4);
-        }
-    } else {
-        for (size_t v = 0; v < numVerts; ++v) {
-            verts[v].colour = {255, 255, 255, 255};
-        }
+        streams.colours = headerPtr;
+        headerPtr += sizeof(glm::u8vec4) * numVerts;
     }
 
     if ((geom->flags & 4) == 4 || (geom->flags & 128) == 128) {
-        for (size_t v = 0; v < numVerts; ++v) {
-            verts[v].texcoord = bit_cast<glm::vec2>(*headerPtr);
-            headerPtr += sizeof(glm::vec2);
-        }
+        streams.texcoords = headerPtr;
+        headerPtr += sizeof(glm::vec2) * numVerts;
     }
 
-    // Grab indicies data to generate normals (if applicable).
-    auto triangles = std::make_unique<RW::BSGeometryTriangle[]>(numTris);
-    memcpy(triangles.get(), headerPtr, sizeof(RW::BSGeometryTriangle) * numTris);
+    streams.triangles = headerPtr;
     headerPtr += sizeof(RW::BSGeometryTriangle) * numTris;
 
     geom->geometryBounds = bit_cast<RW::BSGeometryBounds>(*headerPtr);
     geom->geometryBounds.radius = std::abs(geom->geometryBounds.radius);
     headerPtr += sizeof(RW::BSGeometryBounds);
 
-    for (size_t v = 0; v < numVerts; ++v) {
-        verts[v].position = bit_cast<glm::vec3>(*headerPtr);
-        headerPtr += sizeof(glm::vec3);
-    }
+    streams.positions = headerPtr;
+    headerPtr += sizeof(glm::vec3) * numVerts;
 
     if ((geom->flags & 16) == 16) {
-        for (size_t v = 0; v < numVerts; ++v) {
-            verts[v].normal = bit_cast<glm::vec3>(*headerPtr);
-            headerPtr += sizeof(glm::vec3);
-        }
-    } else {
-        // Use triangle data to calculate normals for each vert.
-        for (size_t t = 0; t < numTris; ++t) {
-            auto &triangle = triangles[t];
-            auto &A = verts[triangle.first];
-            auto &B = verts[triangle.second];
-            auto &C = verts[triangle.third];
-            auto normal = glm::normalize(
-                glm::cross(C.position - A.position, B.position - A.position));
-            A.normal = normal;
-            B.normal = normal;
-            C.normal = normal;
-        }
+        streams.normals = headerPtr;
+        headerPtr += sizeof(glm::vec3) * numVerts;
     }
 
     // Process the geometry child sections
@@ -252,7 +232,17 @@ GeometryPtr LoaderDFF::readGeometry(const RWBStream &stream) {
     geom->dbuff.setFaceType(geom->facetype == Geometry::Triangles
                                 ? GL_TRIANGLES
                                 : GL_TRIANGLE_STRIP);
-    geom->gbuff.uploadVertices(verts);
+    // Decode straight into the vertex buffer, falling back to a copy if
+    // the buffer can't be mapped
+    auto mapped = geom->gbuff.mapVertices<GeometryVertex>(numVerts);
+    if (mapped) {
+        decodeVertices(streams, mapped);
+    }
+    if (!mapped || !geom->gbuff.unmapVertices()) {
+        std::vector<GeometryVertex> verts(numVerts);
+        decodeVertices(streams, verts.data());
+        geom->gbuff.uploadVertices(verts);
+    }
     geom->dbuff.addGeometry(&geom->gbuff);
 
     glGenBuffers(1, &geom->EBO);
@@ -268,9 +258,134 @@ GeometryPtr LoaderDFF::readGeometry(const RWBStream &stream) {
                         sizeof(uint32_t) * sg.numIndices, sg.indices.data());
     }
 
+    geom->memory.set(numVerts * sizeof(GeometryVertex) +
+                     2 * icount * sizeof(uint32_t));
+
     return geom;
 }
 
+void LoaderDFF::decodeVertices(const DFFVertexStreams &streams,
+                               GeometryVertex *out) {
+    const auto numVerts = streams.numVerts;
+
+    // Normals are generated into scratch memory since out may not be
+    // readable
+    std::vector<glm::vec3> generatedNormals;
+    if (!streams.normals) {
+        std::vector<glm::vec3> positions(numVerts);
+        std::memcpy(positions.data(), streams.positions,
+                    sizeof(glm::vec3) * numVerts);
+        generatedNormals.resize(numVerts);
+        generateNormals(positions.data(), streams.triangles, streams.numTris,
+                        generatedNormals.data());
+    }
+
+    const glm::u8vec4 white{255, 255, 255, 255};
+    for (size_t v = 0; v < numVerts; ++v) {
+        GeometryVertex vertex;
+        std::memcpy(&vertex.position,
+                    streams.positions + sizeof(glm::vec3) * v,
+                    sizeof(glm::vec3));
+        if (streams.normals) {
+            std::memcpy(&vertex.normal,
+                        streams.normals + sizeof(glm::vec3) * v,
+                        sizeof(glm::vec3));
+        } else {
+            vertex.normal = generatedNormals[v];
+        }
+        if (streams.texcoords) {
+            std::memcpy(&vertex.texcoord,
+                        streams.texcoords + sizeof(glm::vec2) * v,
+                        sizeof(glm::vec2));
+        }
+        if (streams.colours) {
+            std::memcpy(&vertex.colour,
+                        streams.colours + sizeof(glm::u8vec4) * v,
+                        sizeof(glm::u8vec4));
+        } else {
+            vertex.colour = white;
+        }
+        out[v] = vertex;
+    }
+}
+
+void LoaderDFF::generateNormals(const glm::vec3 *positions,
+                                const char *triangles, size_t numTris,
+                                glm::vec3 *normals) {
+    auto triangle = [&](size_t t) {
+        return bit_cast<RW::BSGeometryTriangle>(
+            *(triangles + sizeof(RW::BSGeometryTriangle) * t));
+    };
+
+    size_t t = 0;
+#ifdef RW_DFF_SSE_NORMALS
+    // Four face normals at a time, the scatter afterwards keeps the
+    // triangle order so the result matches the scalar path
+    alignas(16) float nx[4], ny[4], nz[4];
+    for (; t + 4 <= numTris; t += 4) {
+        RW::BSGeometryTriangle tris[4];
+        for (size_t i = 0; i < 4; ++i) {
+            tris[i] = triangle(t + i);
+        }
+
+        auto load = [&](std::uint16_t RW::BSGeometryTriangle::*vertex,
+                        float glm::vec3::*axis) {
+            return _mm_setr_ps(positions[tris[0].*vertex].*axis,
+                               positions[tris[1].*vertex].*axis,
+                               positions[tris[2].*vertex].*axis,
+                               positions[tris[3].*vertex].*axis);
+        };
+        using T = RW::BSGeometryTriangle;
+        const auto ax = load(&T::first, &glm::vec3::x);
+        const auto ay = load(&T::first, &glm::vec3::y);
+        const auto az = load(&T::first, &glm::vec3::z);
+
+        // e1 = C - A, e2 = B - A
+        const auto e1x = _mm_sub_ps(load(&T::third, &glm::vec3::x), ax);
+        const auto e1y = _mm_sub_ps(load(&T::third, &glm::vec3::y), ay);
+        const auto e1z = _mm_sub_ps(load(&T::third, &glm::vec3::z), az);
+        const auto e2x = _mm_sub_ps(load(&T::second, &glm::vec3::x), ax);
+        const auto e2y = _mm_sub_ps(load(&T::second, &glm::vec3::y), ay);
+        const auto e2z = _mm_sub_ps(load(&T::second, &glm::vec3::z), az);
+
+        const auto cx =
+            _mm_sub_ps(_mm_mul_ps(e1y, e2z), _mm_mul_ps(e2y, e1z));
+        const auto cy =
+            _mm_sub_ps(_mm_mul_ps(e1z, e2x), _mm_mul_ps(e2z, e1x));
+        const auto cz =
+            _mm_sub_ps(_mm_mul_ps(e1x, e2y), _mm_mul_ps(e2x, e1y));
+
+        const auto lengthSq =
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, cx), _mm_mul_ps(cy, cy)),
+                       _mm_mul_ps(cz, cz));
+        const auto invLength =
+            _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(lengthSq));
+
+        _mm_store_ps(nx, _mm_mul_ps(cx, invLength));
+        _mm_store_ps(ny, _mm_mul_ps(cy, invLength));
+        _mm_store_ps(nz, _mm_mul_ps(cz, invLength));
+
+        for (size_t i = 0; i < 4; ++i) {
+            const glm::vec3 normal{nx[i], ny[i], nz[i]};
+            normals[tris[i].first] = normal;
+            normals[tris[i].second] = normal;
+            normals[tris[i].third] = normal;
+        }
+    }
+#endif
+
+    for (; t < numTris; ++t) {
+        const auto tri = triangle(t);
+        const auto &A = positions[tri.first];
+        const auto &B = positions[tri.second];
+        const auto &C = positions[tri.third];
+        const auto normal = glm::normalize(glm::cross(C - A, B - A));
+        normals[tri.first] = normal;
+        normals[tri.second] = normal;
+        normals[tri.third] = normal;
+    }
+}
+
 void LoaderDFF::readMaterialList(const GeometryPtr &geom, const RWBStream &stream) {
     auto listStream = stream.getInnerStream();
 
@@ -456,6 +571,7 @@ AtomicPtr LoaderDFF::readAtomic(FrameList &framelist,
 }
 
 ClumpPtr LoaderDFF::loadFromMemory(const FileContentsInfo& file) {
+    RW_MEMORY_SCOPE(MemoryTag::Clumps);
     auto model = std::make_shared<Clump>();
 
     RWBStream rootStream(file.data.get(), file.length);
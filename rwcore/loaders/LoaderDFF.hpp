@@ -5,12 +5,28 @@
 #include <gl/TextureData.hpp>
 #include <rw/forward.hpp>
 
+#include <cstddef>
 #include <functional>
 #include <string>
 #include <vector>
 
 class RWBStream;
 
+/**
+ * Vertex data of a geometry as it is laid out in the file. Each pointer
+ * refers to packed, possibly unaligned data in the stream, streams that the
+ * geometry doesn't have are nullptr.
+ */
+struct DFFVertexStreams {
+    size_t numVerts = 0;
+    size_t numTris = 0;
+    const char* colours = nullptr;    ///< glm::u8vec4 per vertex
+    const char* texcoords = nullptr;  ///< glm::vec2 per vertex
+    const char* triangles = nullptr;  ///< RW::BSGeometryTriangle per triangle
+    const char* positions = nullptr;  ///< glm::vec3 per vertex
+    const char* normals = nullptr;    ///< glm::vec3 per vertex
+};
+
 class DFFLoaderException {
     std::string _message;
 
@@ -37,6 +53,22 @@ public:
         texturelookup = tlc;
     }
 
+    /**
+     * Interleaves the vertex streams into out, generating normals from the
+     * triangles if the geometry has none. out is only written to, in order,
+     * so it may point into a mapped GPU buffer.
+     */
+    static void decodeVertices(const DFFVertexStreams& streams,
+                               GeometryVertex* out);
+
+    /**
+     * Assigns the face normal of each triangle to its vertices, when
+     * triangles share a vertex the last one wins.
+     */
+    static void generateNormals(const glm::vec3* positions,
+                                const char* triangles, size_t numTris,
+                                glm::vec3* normals);
+
 private:
     TextureLookupCallback texturelookup;
 
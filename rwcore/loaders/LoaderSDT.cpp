@@ -4,8 +4,22 @@
 #include <cstdio>
 #include <string>
 
+#ifdef RW_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "rw/debug.hpp"
 
+LoaderSDT::~LoaderSDT() {
+    unmapArchive();
+}
+
 bool LoaderSDT::load(const rwfs::path& sdtPath, const rwfs::path& rawPath) {
     const auto sdtName = sdtPath.string();
     const auto rawName = rawPath.string();
@@ -27,6 +41,11 @@ bool LoaderSDT::load(const rwfs::path& sdtPath, const rwfs::path& rawPath) {
 
         fclose(fp);
         m_archive = rawName;
+
+        unmapArchive();
+        if (!mapArchive()) {
+            RW_ERROR("Error mapping " << rawName << ", reading files instead");
+        }
         return true;
     } else {
         RW_ERROR("Error cannot open " << sdtName);
@@ -51,45 +70,141 @@ std::unique_ptr<char[]> LoaderSDT::loadToMemory(size_t index, bool asWave) {
         return nullptr;
     }
 
-    std::string rawName = m_archive;
+    const char* mapped = getAssetData(index);
 
-    FILE* fp = fopen(rawName.c_str(), "rb");
-    if (fp) {
-        std::unique_ptr<char[]> raw_data;
-        char* sample_data;
-        if (asWave) {
-            raw_data = std::make_unique<char[]>(sizeof(WaveHeader) + assetInfo.size);
-
-            auto header = reinterpret_cast<WaveHeader*>(raw_data.get());
-            memcpy(header->chunkId, "RIFF", 4);
-            header->chunkSize = sizeof(WaveHeader) - 8 + assetInfo.size;
-            memcpy(header->format, "WAVE", 4);
-            memcpy(header->fmt.id, "fmt ", 4);
-            header->fmt.size = sizeof(WaveHeader::fmt) - 8;
-            header->fmt.audioFormat = 1;  // PCM
-            header->fmt.numChannels = 1;  // Mono
-            header->fmt.sampleRate = assetInfo.sampleRate;
-            header->fmt.byteRate = assetInfo.sampleRate * 2;
-            header->fmt.blockAlign = 2;
-            header->fmt.bitsPerSample = 16;
-            memcpy(header->data.id, "data", 4);
-            header->data.size = assetInfo.size;
-
-            sample_data = raw_data.get() + sizeof(WaveHeader);
-        } else {
-            raw_data = std::make_unique<char[]>(assetInfo.size);
-            sample_data = raw_data.get();
+    FILE* fp = nullptr;
+    if (!mapped) {
+        fp = fopen(m_archive.c_str(), "rb");
+        if (!fp) {
+            return nullptr;
         }
+    }
 
-        fseek(fp, assetInfo.offset, SEEK_SET);
-        if (fread(sample_data, 1, assetInfo.size, fp) != assetInfo.size) {
-            RW_ERROR("Error reading asset " << std::to_string(index));
-        }
+    std::unique_ptr<char[]> raw_data;
+    char* sample_data;
+    if (asWave) {
+        raw_data = std::make_unique<char[]>(sizeof(WaveHeader) + assetInfo.size);
+
+        auto header = reinterpret_cast<WaveHeader*>(raw_data.get());
+        memcpy(header->chunkId, "RIFF", 4);
+        header->chunkSize = sizeof(WaveHeader) - 8 + assetInfo.size;
+        memcpy(header->format, "WAVE", 4);
+        memcpy(header->fmt.id, "fmt ", 4);
+        header->fmt.size = sizeof(WaveHeader::fmt) - 8;
+        header->fmt.audioFormat = 1;  // PCM
+        header->fmt.numChannels = 1;  // Mono
+        header->fmt.sampleRate = assetInfo.sampleRate;
+        header->fmt.byteRate = assetInfo.sampleRate * 2;
+        header->fmt.blockAlign = 2;
+        header->fmt.bitsPerSample = 16;
+        memcpy(header->data.id, "data", 4);
+        header->data.size = assetInfo.size;
+
+        sample_data = raw_data.get() + sizeof(WaveHeader);
+    } else {
+        raw_data = std::make_unique<char[]>(assetInfo.size);
+        sample_data = raw_data.get();
+    }
 
-        fclose(fp);
+    if (mapped) {
+        memcpy(sample_data, mapped, assetInfo.size);
         return raw_data;
-    } else
+    }
+
+    fseek(fp, assetInfo.offset, SEEK_SET);
+    if (fread(sample_data, 1, assetInfo.size, fp) != assetInfo.size) {
+        RW_ERROR("Error reading asset " << std::to_string(index));
+    }
+
+    fclose(fp);
+    return raw_data;
+}
+
+const char* LoaderSDT::getAssetData(size_t index) const {
+    if (!m_rawData || index >= m_assets.size()) {
+        return nullptr;
+    }
+    const auto& asset = m_assets[index];
+    if (static_cast<size_t>(asset.offset) + asset.size > m_rawSize) {
         return nullptr;
+    }
+    return m_rawData + asset.offset;
+}
+
+bool LoaderSDT::mapArchive() {
+#ifdef RW_WINDOWS
+    HANDLE file = CreateFileA(m_archive.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    // The mapping keeps the file open
+    HANDLE mapping =
+        CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        return false;
+    }
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    m_rawMapping = mapping;
+    m_rawData = static_cast<const char*>(data);
+    m_rawSize = static_cast<size_t>(size.QuadPart);
+    return true;
+#else
+    int fd = open(m_archive.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    auto size = static_cast<size_t>(info.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps the file open
+    close(fd);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+
+    m_rawData = static_cast<const char*>(data);
+    m_rawSize = size;
+    return true;
+#endif
+}
+
+void LoaderSDT::unmapArchive() {
+    if (!m_rawData) {
+        return;
+    }
+
+#ifdef RW_WINDOWS
+    UnmapViewOfFile(m_rawData);
+    CloseHandle(m_rawMapping);
+    m_rawMapping = nullptr;
+#else
+    munmap(const_cast<char*>(m_rawData), m_rawSize);
+#endif
+
+    m_rawData = nullptr;
+    m_rawSize = 0;
 }
 
 /// Writes the contents of assetname to filename
@@ -59,7 +59,10 @@ public:
     LoaderSDT() = default;
 
     /// Destructor
-    ~LoaderSDT() = default;
+    ~LoaderSDT();
+
+    LoaderSDT(const LoaderSDT&) = delete;
+    LoaderSDT& operator=(const LoaderSDT&) = delete;
 
     /// Load the structure of the archive
     bool load(const rwfs::path& sdtPath, const rwfs::path& rawPath);
@@ -68,6 +71,11 @@ public:
     /// Warning: Returns nullptr if by any reason it can't load the file
     std::unique_ptr<char[]> loadToMemory(size_t index, bool asWave = true);
 
+    /// Get the raw samples of a file in the archive without copying them,
+    /// they stay valid as long as the loader.
+    /// Warning: Returns nullptr if the archive couldn't be memory mapped
+    const char* getAssetData(size_t index) const;
+
     /// Writes the contents of index to filename
     bool saveAsset(size_t index, const std::string& filename,
                    bool asWave = true);
@@ -88,6 +96,17 @@ private:
     uint32_t m_assetCount{0};  ///< Number of assets in the current archive
     std::string m_archive;  ///< Path to the archive being used (no extension)
     std::vector<LoaderSDTFile> m_assets;  ///< Asset info of the archive
+
+    const char* m_rawData{nullptr};  ///< The archive mapped into memory
+    size_t m_rawSize{0};
+#ifdef RW_WINDOWS
+    void* m_rawMapping{nullptr};  ///< Handle of the file mapping
+#endif
+
+    /// Map the archive for the lifetime of the loader, so loading a file
+    /// doesn't need to open it again
+    bool mapArchive();
+    void unmapArchive();
 };
 
 #endif  // LoaderSDT_h__
@@ -10,6 +10,7 @@
 #include "gl/gl_core_3_3.h"
 #include "loaders/RWBinaryStream.hpp"
 #include "platform/FileHandle.hpp"
+#include "rw/memorystats.hpp"
 #include "rw/debug.hpp"
 
 GLuint gErrorTextureData[] = {0xFFFF00FF, 0xFF000000, 0xFF000000, 0xFFFF00FF};
@@ -51,6 +52,54 @@ void processPalette(uint32_t* fullColor, RW::BinaryStreamSection& rootSection) {
     }
 }
 
+static
+void setSamplingParameters(uint16_t filterflags, uint8_t wrapU,
+                           uint8_t wrapV) {
+    GLenum texFilter = GL_LINEAR;
+    switch (filterflags & 0xFF) {
+        default:
+        case RW::BSTextureNative::FILTER_LINEAR:
+            texFilter = GL_LINEAR;
+            break;
+        case RW::BSTextureNative::FILTER_NEAREST:
+            texFilter = GL_NEAREST;
+            break;
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                    GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, texFilter);
+
+    GLenum texwrap = GL_REPEAT;
+    switch (wrapU) {
+        default:
+        case RW::BSTextureNative::WRAP_WRAP:
+            texwrap = GL_REPEAT;
+            break;
+        case RW::BSTextureNative::WRAP_CLAMP:
+            texwrap = GL_CLAMP_TO_EDGE;
+            break;
+        case RW::BSTextureNative::WRAP_MIRROR:
+            texwrap = GL_MIRRORED_REPEAT;
+            break;
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, texwrap);
+
+    switch (wrapV) {
+        default:
+        case RW::BSTextureNative::WRAP_WRAP:
+            texwrap = GL_REPEAT;
+            break;
+        case RW::BSTextureNative::WRAP_CLAMP:
+            texwrap = GL_CLAMP_TO_EDGE;
+            break;
+        case RW::BSTextureNative::WRAP_MIRROR:
+            texwrap = GL_MIRRORED_REPEAT;
+            break;
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, texwrap);
+}
+
 static
 TextureData::Handle createTexture(RW::BSTextureNative& texNative,
                                   RW::BinaryStreamSection& rootSection) {
@@ -122,49 +171,8 @@ TextureData::Handle createTexture(RW::BSTextureNative& texNative,
         return getErrorTexture();
     }
 
-    GLenum texFilter = GL_LINEAR;
-    switch (texNative.filterflags & 0xFF) {
-        default:
-        case RW::BSTextureNative::FILTER_LINEAR:
-            texFilter = GL_LINEAR;
-            break;
-        case RW::BSTextureNative::FILTER_NEAREST:
-            texFilter = GL_NEAREST;
-            break;
-    }
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
-                    GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, texFilter);
-
-    GLenum texwrap = GL_REPEAT;
-    switch (texNative.wrapU) {
-        default:
-        case RW::BSTextureNative::WRAP_WRAP:
-            texwrap = GL_REPEAT;
-            break;
-        case RW::BSTextureNative::WRAP_CLAMP:
-            texwrap = GL_CLAMP_TO_EDGE;
-            break;
-        case RW::BSTextureNative::WRAP_MIRROR:
-            texwrap = GL_MIRRORED_REPEAT;
-            break;
-    }
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, texwrap);
-
-    switch (texNative.wrapV) {
-        default:
-        case RW::BSTextureNative::WRAP_WRAP:
-            texwrap = GL_REPEAT;
-            break;
-        case RW::BSTextureNative::WRAP_CLAMP:
-            texwrap = GL_CLAMP_TO_EDGE;
-            break;
-        case RW::BSTextureNative::WRAP_MIRROR:
-            texwrap = GL_MIRRORED_REPEAT;
-            break;
-    }
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, texwrap);
+    setSamplingParameters(texNative.filterflags, texNative.wrapU,
+                          texNative.wrapV);
 
     glGenerateMipmap(GL_TEXTURE_2D);
 
@@ -174,6 +182,7 @@ TextureData::Handle createTexture(RW::BSTextureNative& texNative,
 
 bool TextureLoader::loadFromMemory(const FileContentsInfo& file,
                                    TextureArchive& inTextures) {
+    RW_MEMORY_SCOPE(MemoryTag::Textures);
     auto data = file.data.get();
     RW::BinaryStreamSection root(data);
     /*auto texDict =*/root.readStructure<RW::BSTextureDictionary>();
@@ -198,3 +207,185 @@ bool TextureLoader::loadFromMemory(const FileContentsInfo& file,
 
     return true;
 }
+
+static
+void decodeTexture(RW::BSTextureNative& texNative,
+                   RW::BinaryStreamSection& rootSection, TextureImage& image) {
+    image.filterflags = texNative.filterflags;
+    image.wrapU = texNative.wrapU;
+    image.wrapV = texNative.wrapV;
+    image.format = TextureCompression::Format::RGBA8;
+    image.transparent =
+        !((texNative.rasterformat & RW::BSTextureNative::FORMAT_888) ==
+          RW::BSTextureNative::FORMAT_888);
+
+    bool isPal8 =
+        (texNative.rasterformat & RW::BSTextureNative::FORMAT_EXT_PAL8) ==
+        RW::BSTextureNative::FORMAT_EXT_PAL8;
+    bool isFulc = texNative.rasterformat == RW::BSTextureNative::FORMAT_1555 ||
+                  texNative.rasterformat == RW::BSTextureNative::FORMAT_8888 ||
+                  texNative.rasterformat == RW::BSTextureNative::FORMAT_888;
+
+    if (texNative.platform != 8 || !(isPal8 || isFulc)) {
+        RW_ERROR("Unsupported texture " << image.name);
+        image.width = 2;
+        image.height = 2;
+        image.transparent = false;
+        auto errorData = reinterpret_cast<const uint8_t*>(gErrorTextureData);
+        image.levels = {TextureCompression::Level(
+            errorData, errorData + sizeof(gErrorTextureData))};
+        return;
+    }
+
+    image.width = texNative.width;
+    image.height = texNative.height;
+    const size_t pixels = size_t(image.width) * size_t(image.height);
+    TextureCompression::Level rgba(pixels * 4);
+
+    if (isPal8) {
+        // Palette entries are already in RGBA byte order
+        processPalette(reinterpret_cast<uint32_t*>(rgba.data()), rootSection);
+    } else {
+        auto coldata = reinterpret_cast<const uint8_t*>(
+            rootSection.raw() + sizeof(RW::BSTextureNative) +
+            sizeof(uint32_t));
+        switch (texNative.rasterformat) {
+            case RW::BSTextureNative::FORMAT_1555:
+                for (size_t i = 0; i < pixels; ++i) {
+                    uint16_t c = uint16_t(coldata[i * 2] |
+                                          (coldata[i * 2 + 1] << 8));
+                    for (size_t channel = 0; channel < 3; ++channel) {
+                        uint8_t v = (c >> (channel * 5)) & 0x1F;
+                        rgba[i * 4 + channel] = uint8_t((v << 3) | (v >> 2));
+                    }
+                    rgba[i * 4 + 3] = (c & 0x8000) ? 255 : 0;
+                }
+                break;
+            case RW::BSTextureNative::FORMAT_8888:
+            case RW::BSTextureNative::FORMAT_888:
+                if (texNative.rasterformat ==
+                    RW::BSTextureNative::FORMAT_8888) {
+                    coldata += 8;
+                }
+                for (size_t i = 0; i < pixels; ++i) {
+                    rgba[i * 4 + 0] = coldata[i * 4 + 2];
+                    rgba[i * 4 + 1] = coldata[i * 4 + 1];
+                    rgba[i * 4 + 2] = coldata[i * 4 + 0];
+                    // The fourth byte of 888 is padding
+                    rgba[i * 4 + 3] = image.transparent ? coldata[i * 4 + 3]
+                                                        : 255;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    image.levels = {std::move(rgba)};
+}
+
+bool TextureLoader::decode(const FileContentsInfo& file,
+                           std::vector<TextureImage>& images) {
+    auto data = file.data.get();
+    RW::BinaryStreamSection root(data);
+    /*auto texDict =*/root.readStructure<RW::BSTextureDictionary>();
+
+    size_t rootI = 0;
+    while (root.hasMoreData(rootI)) {
+        auto rootSection = root.getNextChildSection(rootI);
+
+        if (rootSection.header.id != RW::SID_TextureNative) continue;
+
+        RW::BSTextureNative texNative =
+            rootSection.readStructure<RW::BSTextureNative>();
+
+        TextureImage image;
+        image.name = std::string(texNative.diffuseName);
+        std::transform(image.name.begin(), image.name.end(),
+                       image.name.begin(), ::tolower);
+
+        decodeTexture(texNative, rootSection, image);
+
+        images.push_back(std::move(image));
+    }
+
+    return true;
+}
+
+void TextureLoader::compress(TextureImage& image) {
+    if (image.format != TextureCompression::Format::RGBA8 ||
+        image.levels.empty()) {
+        return;
+    }
+
+    auto chain = TextureCompression::buildMipChain(
+        image.levels[0].data(), image.width, image.height);
+    auto format = TextureCompression::chooseFormat(image.levels[0].data(),
+                                                   image.width, image.height);
+
+    int width = image.width;
+    int height = image.height;
+    image.levels.clear();
+    for (const auto& level : chain) {
+        image.levels.push_back(
+            TextureCompression::compress(format, level.data(), width, height));
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+    }
+    image.format = format;
+}
+
+TextureData::Handle TextureLoader::upload(const TextureImage& image) {
+    if (image.levels.empty()) {
+        return getErrorTexture();
+    }
+
+    GLuint textureName = 0;
+    glGenTextures(1, &textureName);
+    glBindTexture(GL_TEXTURE_2D, textureName);
+
+    size_t bytes = 0;
+    int width = image.width;
+    int height = image.height;
+    for (size_t i = 0; i < image.levels.size(); ++i) {
+        const auto& level = image.levels[i];
+        auto levelIndex = static_cast<GLint>(i);
+        switch (image.format) {
+            case TextureCompression::Format::RGBA8:
+                glTexImage2D(GL_TEXTURE_2D, levelIndex, GL_RGBA, width, height,
+                             0, GL_RGBA, GL_UNSIGNED_BYTE, level.data());
+                break;
+            case TextureCompression::Format::DXT1:
+            case TextureCompression::Format::DXT5:
+                glCompressedTexImage2D(
+                    GL_TEXTURE_2D, levelIndex,
+                    image.format == TextureCompression::Format::DXT1
+                        ? GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+                        : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,
+                    width, height, 0, static_cast<GLsizei>(level.size()),
+                    level.data());
+                break;
+        }
+        bytes += level.size();
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+    }
+
+    setSamplingParameters(image.filterflags, image.wrapU, image.wrapV);
+
+    if (image.levels.size() > 1) {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL,
+                        static_cast<GLint>(image.levels.size() - 1));
+    } else {
+        // Leave the size to be estimated, as the driver builds the mipmaps
+        glGenerateMipmap(GL_TEXTURE_2D);
+        bytes = 0;
+    }
+
+    return TextureData::create(textureName, {image.width, image.height},
+                               image.transparent, bytes);
+}
+
+bool TextureLoader::isCompressionSupported() {
+    return ogl_ext_EXT_texture_compression_s3tc != 0;
+}
@@ -1,12 +1,53 @@
 #ifndef _LIBRW_TEXTURELOADER_HPP_
 #define _LIBRW_TEXTURELOADER_HPP_
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gl/TextureCompression.hpp>
 #include <gl/TextureData.hpp>
 #include <rw/forward.hpp>
 
+/**
+ * Pixels of a texture decoded on the CPU, as RGBA8 or in a block
+ * compressed format with its mipmap chain.
+ */
+struct TextureImage {
+    std::string name;
+    TextureCompression::Format format = TextureCompression::Format::RGBA8;
+    int width = 0;
+    int height = 0;
+    bool transparent = false;
+    /// Sampling flags from the TXD
+    std::uint16_t filterflags = 0;
+    std::uint8_t wrapU = 0;
+    std::uint8_t wrapV = 0;
+    /// Data of each level, largest first
+    std::vector<TextureCompression::Level> levels;
+};
+
 class TextureLoader {
 public:
     bool loadFromMemory(const FileContentsInfo& file, TextureArchive& inTextures);
+
+    /**
+     * Decodes every texture in a TXD to RGBA8 without using GL
+     */
+    bool decode(const FileContentsInfo& file, std::vector<TextureImage>& images);
+
+    /**
+     * Converts an RGBA8 image to DXT1, or DXT5 if it has alpha, and
+     * generates its mipmaps
+     */
+    static void compress(TextureImage& image);
+
+    static TextureData::Handle upload(const TextureImage& image);
+
+    /**
+     * @return true if the driver can use compressed images
+     */
+    static bool isCompressionSupported();
 };
 
 #endif
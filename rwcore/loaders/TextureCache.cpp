@@ -0,0 +1,193 @@
+#include "loaders/TextureCache.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#include "platform/FileHandle.hpp"
+#include "rw/debug.hpp"
+
+namespace {
+const char kMagic[4] = {'R', 'W', 'T', 'C'};
+
+/// Largest texture accepted from a cache file
+constexpr std::uint32_t kMaxDimension = 4096;
+constexpr std::uint32_t kMaxLevels = 13;
+constexpr std::uint32_t kMaxNameLength = 32;
+
+template <class T>
+void writeValue(std::ofstream& out, T value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <class T>
+bool readValue(std::ifstream& in, T& value) {
+    return bool(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+}  // namespace
+
+TextureCache::TextureCache(const rwfs::path& directory)
+    : directory(directory) {
+    rwfs::error_code ec;
+    rwfs::create_directories(directory, ec);
+    if (ec) {
+        RW_ERROR("Failed to create texture cache " << directory.string());
+    }
+}
+
+bool TextureCache::load(const std::string& name, const FileContentsInfo& file,
+                        std::vector<TextureImage>& images) {
+    auto checksum = computeChecksum(file.data.get(), file.length);
+    auto path = getPath(name);
+
+    std::vector<TextureImage> cached;
+    if (read(path, checksum, cached)) {
+        std::move(cached.begin(), cached.end(), std::back_inserter(images));
+        return true;
+    }
+
+    TextureLoader loader;
+    std::vector<TextureImage> decoded;
+    if (!loader.decode(file, decoded)) {
+        return false;
+    }
+
+    for (auto& image : decoded) {
+        TextureLoader::compress(image);
+    }
+
+    if (!write(path, checksum, decoded)) {
+        RW_ERROR("Failed to write texture cache " << path.string());
+    }
+
+    std::move(decoded.begin(), decoded.end(), std::back_inserter(images));
+    return true;
+}
+
+rwfs::path TextureCache::getPath(const std::string& name) const {
+    auto fileName = name;
+    std::replace(fileName.begin(), fileName.end(), '/', '_');
+    std::replace(fileName.begin(), fileName.end(), '\\', '_');
+    return directory / (fileName + ".rwtc");
+}
+
+bool TextureCache::read(const rwfs::path& path, std::uint32_t checksum,
+                        std::vector<TextureImage>& images) {
+    std::ifstream in(path.string(), std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    char magic[4];
+    std::uint32_t version = 0;
+    std::uint32_t storedChecksum = 0;
+    std::uint32_t count = 0;
+    if (!in.read(magic, sizeof(magic)) ||
+        !std::equal(magic, magic + sizeof(magic), kMagic) ||
+        !readValue(in, version) || version != kVersion ||
+        !readValue(in, storedChecksum) || storedChecksum != checksum ||
+        !readValue(in, count)) {
+        return false;
+    }
+
+    std::vector<TextureImage> result(count);
+    for (auto& image : result) {
+        std::uint32_t nameLength = 0;
+        std::uint8_t format = 0;
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        std::uint8_t transparent = 0;
+        std::uint32_t levelCount = 0;
+        if (!readValue(in, nameLength) || nameLength > kMaxNameLength) {
+            return false;
+        }
+        image.name.resize(nameLength);
+        if (!in.read(&image.name[0], nameLength) || !readValue(in, format) ||
+            format > std::uint8_t(TextureCompression::Format::DXT5) ||
+            !readValue(in, width) || !readValue(in, height) ||
+            width == 0 || width > kMaxDimension || height == 0 ||
+            height > kMaxDimension || !readValue(in, transparent) ||
+            !readValue(in, image.filterflags) || !readValue(in, image.wrapU) ||
+            !readValue(in, image.wrapV) || !readValue(in, levelCount) ||
+            levelCount == 0 || levelCount > kMaxLevels) {
+            return false;
+        }
+        image.format = static_cast<TextureCompression::Format>(format);
+        image.width = static_cast<int>(width);
+        image.height = static_cast<int>(height);
+        image.transparent = transparent != 0;
+
+        int levelWidth = image.width;
+        int levelHeight = image.height;
+        image.levels.resize(levelCount);
+        for (auto& level : image.levels) {
+            std::uint32_t size = 0;
+            if (!readValue(in, size) ||
+                size != TextureCompression::getLevelSize(
+                            image.format, levelWidth, levelHeight)) {
+                return false;
+            }
+            level.resize(size);
+            if (!in.read(reinterpret_cast<char*>(level.data()), size)) {
+                return false;
+            }
+            levelWidth = std::max(levelWidth / 2, 1);
+            levelHeight = std::max(levelHeight / 2, 1);
+        }
+    }
+
+    std::move(result.begin(), result.end(), std::back_inserter(images));
+    return true;
+}
+
+bool TextureCache::write(const rwfs::path& path, std::uint32_t checksum,
+                         const std::vector<TextureImage>& images) {
+    // Written to the side first so a partial file is never read back
+    auto partial = path;
+    partial += ".tmp";
+    {
+        std::ofstream out(partial.string(), std::ios::binary);
+        if (!out) {
+            return false;
+        }
+
+        out.write(kMagic, sizeof(kMagic));
+        writeValue(out, kVersion);
+        writeValue(out, checksum);
+        writeValue(out, std::uint32_t(images.size()));
+        for (const auto& image : images) {
+            writeValue(out, std::uint32_t(image.name.size()));
+            out.write(image.name.data(), image.name.size());
+            writeValue(out, std::uint8_t(image.format));
+            writeValue(out, std::uint32_t(image.width));
+            writeValue(out, std::uint32_t(image.height));
+            writeValue(out, std::uint8_t(image.transparent ? 1 : 0));
+            writeValue(out, image.filterflags);
+            writeValue(out, image.wrapU);
+            writeValue(out, image.wrapV);
+            writeValue(out, std::uint32_t(image.levels.size()));
+            for (const auto& level : image.levels) {
+                writeValue(out, std::uint32_t(level.size()));
+                out.write(reinterpret_cast<const char*>(level.data()),
+                          level.size());
+            }
+        }
+
+        if (!out) {
+            return false;
+        }
+    }
+
+    rwfs::error_code ec;
+    rwfs::rename(partial, path, ec);
+    return !ec;
+}
+
+std::uint32_t TextureCache::computeChecksum(const char* data, size_t length) {
+    std::uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<std::uint8_t>(data[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
@@ -0,0 +1,53 @@
+#ifndef _LIBRW_TEXTURECACHE_HPP_
+#define _LIBRW_TEXTURECACHE_HPP_
+
+#include <loaders/LoaderTXD.hpp>
+#include <rw/filesystem.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Stores compressed copies of texture dictionaries on disk.
+ *
+ * Each TXD is transcoded once, the first time it's loaded, and written to
+ * its own file along with a checksum of the original data. Later loads read
+ * the blocks and mipmaps straight back, unless the TXD has changed.
+ */
+class TextureCache {
+public:
+    static constexpr std::uint32_t kVersion = 1;
+
+    explicit TextureCache(const rwfs::path& directory);
+
+    /**
+     * Reads the textures of a TXD from the cache, transcoding and storing
+     * them first if needed
+     * @param name Name of the TXD, e.g. generic.txd
+     */
+    bool load(const std::string& name, const FileContentsInfo& file,
+              std::vector<TextureImage>& images);
+
+    rwfs::path getPath(const std::string& name) const;
+
+    /**
+     * @return false if the file is missing, damaged or for different data
+     */
+    static bool read(const rwfs::path& path, std::uint32_t checksum,
+                     std::vector<TextureImage>& images);
+
+    static bool write(const rwfs::path& path, std::uint32_t checksum,
+                      const std::vector<TextureImage>& images);
+
+    /**
+     * @return FNV-1a hash of the data
+     */
+    static std::uint32_t computeChecksum(const char* data, size_t length);
+
+private:
+    rwfs::path directory;
+};
+
+#endif
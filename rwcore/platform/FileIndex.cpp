@@ -132,3 +132,21 @@ FileContentsInfo FileIndex::openFile(const std::string &filePath) {
 
     return {std::move(data), length};
 }
+
+std::vector<std::string> FileIndex::listFiles(
+    const std::string &extension) const {
+    std::vector<std::string> files;
+    for (const auto &entry : indexedData_) {
+        const auto &name = entry.first;
+        // Files are indexed by both their path and bare name
+        if (name.find('/') != std::string::npos ||
+            name.size() < extension.size() ||
+            name.compare(name.size() - extension.size(), extension.size(),
+                         extension) != 0) {
+            continue;
+        }
+        files.push_back(name);
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
@@ -4,7 +4,9 @@
 #include "rw/filesystem.hpp"
 #include "rw/forward.hpp"
 
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 class FileIndex {
 public:
@@ -56,6 +58,13 @@ public:
      */
     FileContentsInfo openFile(const std::string &filePath);
 
+    /**
+     * @brief listFiles lists the names of indexed files by extension
+     * @param extension lower case extension including the dot, e.g. ".txd"
+     * @return sorted file names, without directories
+     */
+    std::vector<std::string> listFiles(const std::string &extension) const;
+
 private:
     /**
      * @brief Type of the indexed data.
@@ -0,0 +1,98 @@
+#include "rw/arena.hpp"
+
+#include <algorithm>
+
+#include "rw/debug.hpp"
+
+LinearArena::LinearArena(size_t blockSize) : blockSize(blockSize) {
+}
+
+void* LinearArena::allocate(size_t bytes, size_t alignment) {
+    if (blocks.empty()) {
+        addBlock(bytes + alignment);
+    }
+
+    for (;;) {
+        auto& block = blocks[current];
+        auto base = reinterpret_cast<std::uintptr_t>(block.data.get());
+        auto aligned = (base + offset + alignment - 1) & ~(alignment - 1);
+        auto start = static_cast<size_t>(aligned - base);
+        if (start + bytes <= block.size) {
+            offset = start + bytes;
+            live++;
+            peakBytes = std::max(peakBytes, getUsedBytes());
+            return block.data.get() + start;
+        }
+
+        // Move on to the next block, making one if there are no more
+        previousBytes += offset;
+        offset = 0;
+        current++;
+        if (current == blocks.size()) {
+            addBlock(bytes + alignment);
+        }
+    }
+}
+
+void LinearArena::deallocate(void* ptr, size_t bytes) {
+    if (!ptr) {
+        return;
+    }
+    RW_CHECK(live > 0, "Freeing more than was allocated from the arena");
+    if (--live == 0) {
+        rewind();
+        return;
+    }
+
+    // Give the memory back if nothing was allocated after it
+    auto data = static_cast<unsigned char*>(ptr);
+    auto base = blocks[current].data.get();
+    if (data >= base && data + bytes == base + offset) {
+        offset = static_cast<size_t>(data - base);
+    }
+}
+
+void LinearArena::reset() {
+    RW_CHECK(live == 0, "Resetting an arena that is still in use");
+    if (live != 0) {
+        return;
+    }
+
+    if (blocks.size() > 1) {
+        auto total = getCapacity();
+        blocks.clear();
+        addBlock(total);
+    }
+    rewind();
+}
+
+size_t LinearArena::getUsedBytes() const {
+    return previousBytes + offset;
+}
+
+size_t LinearArena::getCapacity() const {
+    size_t capacity = 0;
+    for (const auto& block : blocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+void LinearArena::addBlock(size_t minimum) {
+    auto size = std::max(blockSize, minimum);
+    blocks.push_back({std::unique_ptr<unsigned char[]>(new unsigned char[size]),
+                      size});
+    blockAllocations++;
+}
+
+void LinearArena::rewind() {
+    current = 0;
+    offset = 0;
+    previousBytes = 0;
+}
+
+LinearArena& getTransientArena(ArenaScope scope) {
+    static thread_local LinearArena frame;
+    static thread_local LinearArena tick;
+    return scope == ArenaScope::Frame ? frame : tick;
+}
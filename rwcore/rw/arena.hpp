@@ -0,0 +1,146 @@
+#ifndef _LIBRW_ARENA_HPP_
+#define _LIBRW_ARENA_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * Hands out memory by bumping a pointer through large blocks.
+ *
+ * Freeing only gives memory back when it was the last allocation made, and
+ * the whole arena rewinds once nothing is allocated from it. reset() is
+ * called at frame or tick boundaries and merges the blocks used so far into
+ * one, so a steady state frame doesn't touch the heap at all.
+ */
+class LinearArena {
+public:
+    static constexpr size_t kDefaultBlockSize = 256 * 1024;
+
+    explicit LinearArena(size_t blockSize = kDefaultBlockSize);
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    void* allocate(size_t bytes, size_t alignment);
+    void deallocate(void* ptr, size_t bytes);
+
+    /**
+     * Rewinds the arena, merging its blocks if it had to grow. Does nothing
+     * if an allocation is still alive.
+     */
+    void reset();
+
+    /// Allocations that haven't been freed
+    size_t getLiveAllocations() const {
+        return live;
+    }
+
+    /// Bytes handed out since the last rewind
+    size_t getUsedBytes() const;
+
+    /// The most used between two resets
+    size_t getPeakBytes() const {
+        return peakBytes;
+    }
+
+    size_t getCapacity() const;
+
+    /// Blocks taken from the heap over the arena's lifetime
+    size_t getBlockAllocations() const {
+        return blockAllocations;
+    }
+
+private:
+    struct Block {
+        std::unique_ptr<unsigned char[]> data;
+        size_t size;
+    };
+
+    void addBlock(size_t minimum);
+    void rewind();
+
+    size_t blockSize;
+    std::vector<Block> blocks;
+    size_t current = 0;
+    size_t offset = 0;
+    /// Bytes used in the blocks before current
+    size_t previousBytes = 0;
+    size_t live = 0;
+    size_t peakBytes = 0;
+    size_t blockAllocations = 0;
+};
+
+/**
+ * How long memory from a transient arena lives for.
+ */
+enum class ArenaScope : std::uint8_t {
+    /// Reset when a new frame starts
+    Frame,
+    /// Reset before each world step
+    Tick,
+};
+
+/**
+ * @return The calling thread's arena for the scope
+ */
+LinearArena& getTransientArena(ArenaScope scope);
+
+/**
+ * STL allocator drawing from the calling thread's transient arena. Only
+ * use it for containers that don't outlive the scope.
+ */
+template <class T, ArenaScope Scope>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    template <class U>
+    struct rebind {
+        using other = ArenaAllocator<U, Scope>;
+    };
+
+    ArenaAllocator() noexcept : arena(&getTransientArena(Scope)) {
+    }
+
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U, Scope>& other) noexcept
+        : arena(other.getArena()) {
+    }
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        arena->deallocate(ptr, n * sizeof(T));
+    }
+
+    LinearArena* getArena() const noexcept {
+        return arena;
+    }
+
+private:
+    LinearArena* arena;
+};
+
+template <class T, class U, ArenaScope Scope>
+bool operator==(const ArenaAllocator<T, Scope>& a,
+                const ArenaAllocator<U, Scope>& b) noexcept {
+    return a.getArena() == b.getArena();
+}
+
+template <class T, class U, ArenaScope Scope>
+bool operator!=(const ArenaAllocator<T, Scope>& a,
+                const ArenaAllocator<U, Scope>& b) noexcept {
+    return !(a == b);
+}
+
+template <class T>
+using FrameVector = std::vector<T, ArenaAllocator<T, ArenaScope::Frame>>;
+
+template <class T>
+using TickVector = std::vector<T, ArenaAllocator<T, ArenaScope::Tick>>;
+
+#endif
@@ -0,0 +1,213 @@
+#include "rw/memorystats.hpp"
+
+#include <iomanip>
+#include <new>
+#include <ostream>
+
+#ifdef RW_MEMORY_TRACKING
+#include <cstddef>
+#include <cstdlib>
+#endif
+
+namespace {
+constexpr const char* kTagNames[MemoryStats::kTagCount] = {
+    "Clumps", "Geometry", "Textures", "Animations",
+    "Collision", "Sound", "Script", "Other",
+};
+
+thread_local MemoryTag currentTag = MemoryTag::Other;
+
+void printBytes(std::ostream& out, size_t bytes) {
+    out << std::fixed << std::setprecision(2) << std::setw(10)
+        << static_cast<double>(bytes) / (1024. * 1024.) << " MiB";
+}
+}  // namespace
+
+MemoryStats& MemoryStats::get() {
+    // Never destroyed, the allocator may still be called during static
+    // destruction
+    alignas(MemoryStats) static unsigned char storage[sizeof(MemoryStats)];
+    static MemoryStats* stats = new (storage) MemoryStats;
+    return *stats;
+}
+
+bool MemoryStats::isHeapTracked() {
+#ifdef RW_MEMORY_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char* MemoryStats::getTagName(MemoryTag tag) {
+    auto index = static_cast<size_t>(tag);
+    return index < kTagCount ? kTagNames[index] : "Unknown";
+}
+
+void MemoryStats::Counter::add(size_t size) {
+    auto now = bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    auto peak = peakBytes.load(std::memory_order_relaxed);
+    while (now > peak &&
+           !peakBytes.compare_exchange_weak(peak, now,
+                                            std::memory_order_relaxed)) {
+    }
+}
+
+void MemoryStats::Counter::remove(size_t size) {
+    bytes.fetch_sub(size, std::memory_order_relaxed);
+    allocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+MemoryStats::Usage MemoryStats::Counter::load() const {
+    Usage usage;
+    usage.bytes = bytes.load(std::memory_order_relaxed);
+    usage.allocations = allocations.load(std::memory_order_relaxed);
+    usage.peakBytes = peakBytes.load(std::memory_order_relaxed);
+    return usage;
+}
+
+void MemoryStats::add(MemoryTag tag, size_t bytes) {
+    tracked[static_cast<size_t>(tag)].add(bytes);
+}
+
+void MemoryStats::remove(MemoryTag tag, size_t bytes) {
+    tracked[static_cast<size_t>(tag)].remove(bytes);
+}
+
+void MemoryStats::addHeap(MemoryTag tag, size_t bytes) {
+    heap[static_cast<size_t>(tag)].add(bytes);
+    heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MemoryStats::removeHeap(MemoryTag tag, size_t bytes) {
+    heap[static_cast<size_t>(tag)].remove(bytes);
+}
+
+MemoryStats::Usage MemoryStats::getUsage(MemoryTag tag) const {
+    return tracked[static_cast<size_t>(tag)].load();
+}
+
+MemoryStats::Usage MemoryStats::getHeapUsage(MemoryTag tag) const {
+    return heap[static_cast<size_t>(tag)].load();
+}
+
+size_t MemoryStats::getTotalBytes() const {
+    size_t total = 0;
+    for (const auto& counter : tracked) {
+        total += counter.bytes.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void MemoryStats::dump(std::ostream& out) const {
+    auto flags = out.flags();
+    auto precision = out.precision();
+
+    for (size_t i = 0; i < kTagCount; ++i) {
+        auto tag = static_cast<MemoryTag>(i);
+        auto usage = getUsage(tag);
+        out << std::left << std::setw(12) << getTagName(tag) << std::right;
+        printBytes(out, usage.bytes);
+        out << " in " << std::setw(7) << usage.allocations << " (peak ";
+        printBytes(out, usage.peakBytes);
+        out << ")";
+        if (isHeapTracked()) {
+            out << "  heap ";
+            printBytes(out, getHeapUsage(tag).bytes);
+        }
+        out << "\n";
+    }
+    out << std::left << std::setw(12) << "Total" << std::right;
+    printBytes(out, getTotalBytes());
+    out << "\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+MemoryScope::MemoryScope(MemoryTag tag) : previous(currentTag) {
+    currentTag = tag;
+}
+
+MemoryScope::~MemoryScope() {
+    currentTag = previous;
+}
+
+MemoryTag MemoryScope::current() {
+    return currentTag;
+}
+
+#ifdef RW_MEMORY_TRACKING
+namespace {
+/// Stored in front of every allocation, padded to keep the alignment
+struct alignas(alignof(std::max_align_t)) AllocationHeader {
+    size_t size;
+    MemoryTag tag;
+};
+
+void* trackedAlloc(size_t size) {
+    auto block = std::malloc(sizeof(AllocationHeader) + size);
+    if (!block) {
+        return nullptr;
+    }
+    auto header = static_cast<AllocationHeader*>(block);
+    header->size = size;
+    header->tag = currentTag;
+    MemoryStats::get().addHeap(header->tag, size);
+    return header + 1;
+}
+
+void trackedFree(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+    auto header = static_cast<AllocationHeader*>(ptr) - 1;
+    MemoryStats::get().removeHeap(header->tag, header->size);
+    std::free(header);
+}
+}  // namespace
+
+void* operator new(size_t size) {
+    if (auto ptr = trackedAlloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return trackedAlloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return trackedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    trackedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    trackedFree(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    trackedFree(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    trackedFree(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    trackedFree(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    trackedFree(ptr);
+}
+#endif
@@ -0,0 +1,179 @@
+#ifndef _LIBRW_MEMORYSTATS_HPP_
+#define _LIBRW_MEMORYSTATS_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+/**
+ * Subsystems that memory is accounted against.
+ */
+enum class MemoryTag : std::uint8_t {
+    Clumps,
+    Geometry,
+    Textures,
+    Animations,
+    Collision,
+    Sound,
+    Script,
+    /// Heap allocations made outside of any MemoryScope
+    Other,
+    Count
+};
+
+/**
+ * Per subsystem memory counters.
+ *
+ * Assets report the size of the data they own through TrackedMemory, so the
+ * counters follow the lifetime of whatever container holds them. Builds with
+ * RW_MEMORY_TRACKING also replace the global allocator and count every heap
+ * allocation against the tag of the innermost MemoryScope.
+ */
+class MemoryStats {
+public:
+    static constexpr size_t kTagCount = static_cast<size_t>(MemoryTag::Count);
+
+    struct Usage {
+        size_t bytes = 0;
+        size_t allocations = 0;
+        size_t peakBytes = 0;
+    };
+
+    static MemoryStats& get();
+
+    /**
+     * @return true if the tracking allocator is compiled in
+     */
+    static bool isHeapTracked();
+
+    static const char* getTagName(MemoryTag tag);
+
+    void add(MemoryTag tag, size_t bytes);
+    void remove(MemoryTag tag, size_t bytes);
+
+    /**
+     * @return Bytes reported through TrackedMemory for the tag
+     */
+    Usage getUsage(MemoryTag tag) const;
+
+    /**
+     * @return Bytes counted by the tracking allocator for the tag
+     */
+    Usage getHeapUsage(MemoryTag tag) const;
+
+    size_t getTotalBytes() const;
+
+    /**
+     * @return Heap allocations made since startup, 0 without the tracking
+     * allocator. The difference between two frames is the frame's count.
+     */
+    size_t getHeapAllocationCount() const {
+        return heapAllocationCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Writes one line per tag, followed by the total
+     */
+    void dump(std::ostream& out) const;
+
+    void addHeap(MemoryTag tag, size_t bytes);
+    void removeHeap(MemoryTag tag, size_t bytes);
+
+private:
+    struct Counter {
+        std::atomic<size_t> bytes{0};
+        std::atomic<size_t> allocations{0};
+        std::atomic<size_t> peakBytes{0};
+
+        void add(size_t size);
+        void remove(size_t size);
+        Usage load() const;
+    };
+
+    std::array<Counter, kTagCount> tracked;
+    std::array<Counter, kTagCount> heap;
+    std::atomic<size_t> heapAllocationCount{0};
+};
+
+/**
+ * Reports the bytes owned by an object against a tag for as long as it
+ * lives. Copies count again, moves hand the bytes over.
+ */
+template <MemoryTag Tag>
+class TrackedMemory {
+public:
+    TrackedMemory() = default;
+
+    TrackedMemory(const TrackedMemory& other) {
+        set(other.bytes_);
+    }
+
+    TrackedMemory(TrackedMemory&& other) noexcept : bytes_(other.bytes_) {
+        other.bytes_ = 0;
+    }
+
+    TrackedMemory& operator=(const TrackedMemory& other) {
+        set(other.bytes_);
+        return *this;
+    }
+
+    TrackedMemory& operator=(TrackedMemory&& other) noexcept {
+        if (this != &other) {
+            set(0);
+            bytes_ = other.bytes_;
+            other.bytes_ = 0;
+        }
+        return *this;
+    }
+
+    ~TrackedMemory() {
+        set(0);
+    }
+
+    void set(size_t bytes) {
+        if (bytes_ != 0) {
+            MemoryStats::get().remove(Tag, bytes_);
+        }
+        bytes_ = bytes;
+        if (bytes_ != 0) {
+            MemoryStats::get().add(Tag, bytes_);
+        }
+    }
+
+    size_t get() const {
+        return bytes_;
+    }
+
+private:
+    size_t bytes_ = 0;
+};
+
+/**
+ * Counts heap allocations made on this thread against a tag until it goes
+ * out of scope. Only has an effect with RW_MEMORY_TRACKING.
+ */
+class MemoryScope {
+public:
+    explicit MemoryScope(MemoryTag tag);
+    ~MemoryScope();
+
+    MemoryScope(const MemoryScope&) = delete;
+    MemoryScope& operator=(const MemoryScope&) = delete;
+
+    static MemoryTag current();
+
+private:
+    MemoryTag previous;
+};
+
+#ifdef RW_MEMORY_TRACKING
+#define RW_MEMORY_SCOPE_CONCAT(a, b) a##b
+#define RW_MEMORY_SCOPE_NAME(line) RW_MEMORY_SCOPE_CONCAT(_rw_memory_scope_, line)
+#define RW_MEMORY_SCOPE(tag) MemoryScope RW_MEMORY_SCOPE_NAME(__LINE__)(tag)
+#else
+#define RW_MEMORY_SCOPE(tag)
+#endif
+
+#endif
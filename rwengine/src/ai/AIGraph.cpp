@@ -97,7 +97,7 @@ glm::ivec2 worldToGrid(const glm::vec2& world) {
 
 void AIGraph::gatherExternalNodesNear(const glm::vec3& center,
                                       const float radius,
-                                      std::vector<AIGraphNode*>& nodes,
+                                      TickVector<AIGraphNode*>& nodes,
                                       AIGraphNode::NodeType type) {
     // the bounds end up covering more than might fit
     auto planecoords = glm::vec2(center);
@@ -7,6 +7,7 @@
 
 #include "ai/AIGraphNode.hpp"
 
+#include <rw/arena.hpp>
 #include <rw/types.hpp>
 
 struct AIGraphNode;
@@ -34,7 +35,7 @@ public:
                          PathData& path);
 
     void gatherExternalNodesNear(const glm::vec3& center, const float radius,
-                                 std::vector<AIGraphNode*>& nodes, AIGraphNode::NodeType type);
+                                 TickVector<AIGraphNode*>& nodes, AIGraphNode::NodeType type);
 };
 
 #endif
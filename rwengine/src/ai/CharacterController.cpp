@@ -1,6 +1,7 @@
 #include "ai/CharacterController.hpp"
 
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <utility>
 
@@ -24,38 +25,39 @@
 constexpr float kCloseDoorIdleTime = 2.f;
 
 bool CharacterController::updateActivity() {
-    if (_currentActivity && character->isAlive()) {
-        return _currentActivity->update(character, this);
+    auto activity = getCurrentActivity();
+    if (activity && character->isAlive()) {
+        return activity->update(character, this);
     }
 
     return false;
 }
 
-void CharacterController::setActivity(std::unique_ptr<Activity> activity) {
-    _currentActivity = std::move(activity);
-}
-
 void CharacterController::skipActivity() {
     // Some activities can't be cancelled, such as the final phase of entering a
     // vehicle
     // or jumping.
     if (getCurrentActivity() != nullptr &&
         getCurrentActivity()->canSkip(character, this))
-        setActivity(nullptr);
+        currentSlot().reset();
 }
 
-void CharacterController::setNextActivity(std::unique_ptr<Activity> activity) {
-    if (_currentActivity == nullptr) {
-        setActivity(std::move(activity));
-        _nextActivity = nullptr;
-    } else {
-        _nextActivity.swap(activity);
-    }
+void CharacterController::reset() {
+    _activities[0].reset();
+    _activities[1].reset();
+    _currentSlot = 0;
+    m_closeDoorTimer = 0.f;
+    m_lane = 0;
+    currentGoal = None;
+    leader = nullptr;
+    targetNode = nullptr;
+    lastTargetNode = nullptr;
+    nextTargetNode = nullptr;
 }
 
-bool CharacterController::isCurrentActivity(const std::string &activity) const {
+bool CharacterController::isCurrentActivity(const char *activity) const {
     if (getCurrentActivity() == nullptr) return false;
-    return getCurrentActivity()->name() == activity;
+    return std::strcmp(getCurrentActivity()->name(), activity) == 0;
 }
 
 void CharacterController::update(float dt) {
@@ -73,7 +75,7 @@ void CharacterController::update(float dt) {
             character->getCurrentVehicle()->setThrottle(d.x);
         }
 
-        if (_currentActivity == nullptr) {
+        if (getCurrentActivity() == nullptr) {
             // If character is idle in vehicle, try to close the door.
             auto v = character->getCurrentVehicle();
             auto entryDoor = v->getSeatEntryDoor(character->getCurrentSeat());
@@ -96,11 +98,9 @@ void CharacterController::update(float dt) {
 
     if (updateActivity()) {
         character->activityFinished();
-        _currentActivity = nullptr;
-        if (_nextActivity) {
-            setActivity(std::move(_nextActivity));
-            _nextActivity = nullptr;
-        }
+        currentSlot().reset();
+        // Promote the next activity, if any, by swapping slot roles
+        _currentSlot ^= 1;
     }
 }
 
@@ -543,8 +543,8 @@ bool Activities::EnterVehicle::update(CharacterObject *character,
                 currentOccupant->controller->skipActivity();
             }
 
-            currentOccupant->controller->setNextActivity(
-                std::make_unique<Activities::ExitVehicle>(true));
+            currentOccupant->controller
+                ->setNextActivity<Activities::ExitVehicle>(true);
         } else {
             character->playCycle(cycle_enter);
             character->enterVehicle(vehicle, seat);
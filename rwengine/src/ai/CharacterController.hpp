@@ -2,8 +2,10 @@
 #define _RWENGINE_CHARACTERCONTROLLER_HPP_
 #include <glm/glm.hpp>
 
-#include <memory>
-#include <string>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 struct AIGraphNode;
 class CharacterObject;
@@ -22,7 +24,7 @@ public:
     struct Activity {
         virtual ~Activity() = default;
 
-        virtual std::string name() const = 0;
+        virtual const char* name() const = 0;
 
         /**
          * @brief canSkip
@@ -36,6 +38,53 @@ public:
                             CharacterController* controller) = 0;
     };
 
+    /**
+     * In-place storage for a single Activity, so that assigning activities
+     * doesn't allocate.
+     */
+    class ActivitySlot {
+    public:
+        static constexpr std::size_t kCapacity = 64;
+
+        ActivitySlot() = default;
+        ActivitySlot(const ActivitySlot&) = delete;
+        ActivitySlot& operator=(const ActivitySlot&) = delete;
+
+        ~ActivitySlot() {
+            reset();
+        }
+
+        template <class T, class... Args>
+        T* emplace(Args&&... args) {
+            static_assert(std::is_base_of<Activity, T>::value,
+                          "T must be an Activity");
+            static_assert(sizeof(T) <= kCapacity,
+                          "Activity is too large for ActivitySlot");
+            static_assert(alignof(T) <= alignof(std::max_align_t),
+                          "Activity is over-aligned for ActivitySlot");
+            reset();
+            auto activity = new (&storage) T(std::forward<Args>(args)...);
+            _activity = activity;
+            return activity;
+        }
+
+        void reset() {
+            if (_activity) {
+                _activity->~Activity();
+                _activity = nullptr;
+            }
+        }
+
+        Activity* get() const {
+            return _activity;
+        }
+
+    private:
+        typename std::aligned_storage<kCapacity,
+                                      alignof(std::max_align_t)>::type storage;
+        Activity* _activity = nullptr;
+    };
+
     /**
      * Available AI goals.
      */
@@ -64,11 +113,21 @@ protected:
      */
     CharacterObject* character = nullptr;
 
-    std::unique_ptr<Activity> _currentActivity = nullptr;
-    std::unique_ptr<Activity> _nextActivity = nullptr;
+    /**
+     * Storage for the current and next Activity, the roles of the two
+     * slots swap when the current activity finishes.
+     */
+    ActivitySlot _activities[2];
+    int _currentSlot = 0;
+
+    ActivitySlot& currentSlot() {
+        return _activities[_currentSlot];
+    }
+    ActivitySlot& nextSlot() {
+        return _activities[_currentSlot ^ 1];
+    }
 
     bool updateActivity();
-    void setActivity(std::unique_ptr<Activity> activity);
 
     float m_closeDoorTimer{0.f};
 
@@ -95,7 +154,7 @@ public:
      * @return Activity pointer.
      */
     Activity* getCurrentActivity() const {
-        return _currentActivity.get();
+        return _activities[_currentSlot].get();
     }
 
     /**
@@ -104,7 +163,7 @@ public:
      * @return Activity pointer.
      */
     Activity* getNextActivity() const {
-        return _nextActivity.get();
+        return _activities[_currentSlot ^ 1].get();
     }
 
     /**
@@ -113,18 +172,32 @@ public:
     void skipActivity();
 
     /**
-     * @brief setNextActivity Sets the next Activity with a parameter.
-     * @param activity
-     * @param position
+     * Clears the activities, goal and path state so the controller can be
+     * reused for a recycled character.
+     */
+    void reset();
+
+    /**
+     * @brief setNextActivity Constructs the next Activity in place, it
+     * becomes the current activity immediately if the character is idle.
+     * @param args Arguments for the Activity constructor
      */
-    void setNextActivity(std::unique_ptr<Activity> activity);
+    template <class T, class... Args>
+    void setNextActivity(Args&&... args) {
+        if (getCurrentActivity() == nullptr) {
+            currentSlot().emplace<T>(std::forward<Args>(args)...);
+            nextSlot().reset();
+        } else {
+            nextSlot().emplace<T>(std::forward<Args>(args)...);
+        }
+    }
 
     /**
      * @brief IsCurrentActivity
      * @param activity Name of activity to check for
      * @return if the given activity is the current activity
      */
-    bool isCurrentActivity(const std::string& activity) const;
+    bool isCurrentActivity(const char* activity) const;
 
     /**
      * @brief update Updates the controller.
@@ -188,7 +261,7 @@ public:
 
 #define DECL_ACTIVITY(activity_name)                     \
     static constexpr auto ActivityName = #activity_name; \
-    std::string name() const override {                  \
+    const char* name() const override {                  \
         return ActivityName;                             \
     }
 
@@ -35,13 +35,13 @@ void DefaultAIController::update(float dt) {
                 if (leader->getCurrentVehicle() !=
                     getCharacter()->getCurrentVehicle()) {
                     skipActivity();
-                    setNextActivity(std::make_unique<Activities::ExitVehicle>());
+                    setNextActivity<Activities::ExitVehicle>();
                 }
                 // else we're already in the right spot.
             } else {
                 if (leader->getCurrentVehicle()) {
-                    setNextActivity(std::make_unique<Activities::EnterVehicle>(
-                        leader->getCurrentVehicle(), 1));
+                    setNextActivity<Activities::EnterVehicle>(
+                        leader->getCurrentVehicle(), 1);
                 } else {
                     glm::vec3 dir =
                         leader->getPosition() - getCharacter()->getPosition();
@@ -52,7 +52,7 @@ void DefaultAIController::update(float dt) {
                                 leader->getPosition() +
                                 (glm::normalize(-dir) * followRadius * 0.7f);
                             skipActivity();
-                            setNextActivity(std::make_unique<Activities::GoTo>(gotoPos));
+                            setNextActivity<Activities::GoTo>(gotoPos);
                         }
                     }
                 }
@@ -65,16 +65,15 @@ void DefaultAIController::update(float dt) {
                 if (glm::length(targetDistance) <= 0.1f) {
                     // Assign the next target node
                     auto lastTarget = targetNode;
-                    std::random_device rd;
-                    std::default_random_engine re(rd());
+                    auto& random = getCharacter()->engine->randomEngine;
                     std::uniform_int_distribution<> d(
                         0, lastTarget->connections.size() - 1);
-                    targetNode = lastTarget->connections.at(d(re));
-                    setNextActivity(std::make_unique<Activities::GoTo>(
-                        targetNode->position));
+                    targetNode = lastTarget->connections.at(d(random));
+                    setNextActivity<Activities::GoTo>(
+                        targetNode->position);
                 } else if (getCurrentActivity() == nullptr) {
-                    setNextActivity(std::make_unique<Activities::GoTo>(
-                        targetNode->position));
+                    setNextActivity<Activities::GoTo>(
+                        targetNode->position);
                 }
             } else {
                 // We need to pick an initial node
@@ -111,7 +110,7 @@ void DefaultAIController::update(float dt) {
                     getCharacter()->controller->skipActivity();
                 }
 
-                setNextActivity(std::make_unique<Activities::ExitVehicle>());
+                setNextActivity<Activities::ExitVehicle>();
                 break;
             }
 
@@ -173,8 +172,8 @@ void DefaultAIController::update(float dt) {
                         }
                     }
 
-                    setNextActivity(std::make_unique<Activities::DriveTo>(
-                        targetNode, false));
+                    setNextActivity<Activities::DriveTo>(
+                        targetNode, false);
                 }
             }
             else {
@@ -208,8 +207,8 @@ void DefaultAIController::update(float dt) {
 		
                 // Set the next activity
                 if (targetNode) {
-                    setNextActivity(std::make_unique<Activities::DriveTo>(
-                        targetNode, false));
+                    setNextActivity<Activities::DriveTo>(
+                        targetNode, false);
                 }
             }
         } break;
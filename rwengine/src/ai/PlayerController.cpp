@@ -27,7 +27,7 @@ void PlayerController::updateCameraDirection(const glm::quat& rot) {
 
 void PlayerController::updateMovementDirection(const glm::vec3& dir,
                                                const glm::vec3& rawdirection) {
-    if (_currentActivity == nullptr) {
+    if (getCurrentActivity() == nullptr) {
         direction = dir;
         setMoveDirection(rawdirection);
     }
@@ -35,7 +35,7 @@ void PlayerController::updateMovementDirection(const glm::vec3& dir,
 
 void PlayerController::exitVehicle() {
     if (character->getCurrentVehicle()) {
-        setNextActivity(std::make_unique<Activities::ExitVehicle>());
+        setNextActivity<Activities::ExitVehicle>();
     }
 }
 
@@ -56,8 +56,7 @@ void PlayerController::enterNearestVehicle() {
         }
 
         if (nearest) {
-            setNextActivity(
-                std::make_unique<Activities::EnterVehicle>(nearest, 0));
+            setNextActivity<Activities::EnterVehicle>(nearest, 0);
         }
     }
 }
@@ -328,7 +327,7 @@ glm::vec3 PlayerController::getTargetPosition() {
 
 void PlayerController::jump() {
     if (!character->isInWater()) {
-        setNextActivity(std::make_unique<Activities::Jump>());
+        setNextActivity<Activities::Jump>();
     }
 }
 
@@ -29,9 +29,9 @@ TrafficDirector::TrafficDirector(AIGraph* g, GameWorld* w)
     , world(w) {
 }
 
-std::vector<AIGraphNode*> TrafficDirector::findAvailableNodes(
+TickVector<AIGraphNode*> TrafficDirector::findAvailableNodes(
     AIGraphNode::NodeType type, const ViewCamera& camera, float radius) {
-    std::vector<AIGraphNode*> available;
+    TickVector<AIGraphNode*> available;
     available.reserve(20);
 
     graph->gatherExternalNodesNear(camera.position, radius, available, type);
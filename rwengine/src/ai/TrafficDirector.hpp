@@ -5,6 +5,8 @@
 
 #include <vector>
 
+#include <rw/arena.hpp>
+
 class AIGraph;
 class GameObject;
 class GameWorld;
@@ -14,9 +16,9 @@ class TrafficDirector {
 public:
     TrafficDirector(AIGraph* graph, GameWorld* world);
 
-    std::vector<AIGraphNode*> findAvailableNodes(AIGraphNode::NodeType type,
-                                                 const ViewCamera& camera,
-                                                 float radius);
+    TickVector<AIGraphNode*> findAvailableNodes(AIGraphNode::NodeType type,
+                                                const ViewCamera& camera,
+                                                float radius);
 
     void setDensity(AIGraphNode::NodeType type, float density);
 
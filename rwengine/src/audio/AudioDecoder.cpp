@@ -0,0 +1,354 @@
+#include "audio/AudioDecoder.hpp"
+
+#include <algorithm>
+
+#include <rw/types.hpp>
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+#include <libavutil/avutil.h>
+#include <libavutil/opt.h>
+#include <libswresample/swresample.h>
+}
+
+// Rename some functions for older libavcodec/ffmpeg versions (e.g. Ubuntu
+// Trusty)
+#if LIBAVCODEC_VERSION_INT < AV_VERSION_INT(55, 28, 1)
+#define av_frame_alloc avcodec_alloc_frame
+#define av_frame_free avcodec_free_frame
+#endif
+
+namespace {
+constexpr AVSampleFormat kOutputFMT = AV_SAMPLE_FMT_S16;
+}  // namespace
+
+struct AudioDecoder::Context {
+    AVFormatContext* formatContext = nullptr;
+    AVCodecContext* codecContext = nullptr;
+    AVFrame* frame = nullptr;
+    int streamIndex = -1;
+
+#if LIBAVCODEC_VERSION_INT < AV_VERSION_INT(57, 37, 100)
+    /// Packet read from the file and the part of it not decoded yet
+    AVPacket readingPacket;
+    AVPacket decodingPacket;
+    bool hasPacket = false;
+#else
+    AVFrame* resampled = nullptr;
+    SwrContext* swr = nullptr;
+    /// Set once the end of the file was sent to the decoder
+    bool draining = false;
+#endif
+
+    ~Context() {
+#if LIBAVCODEC_VERSION_INT < AV_VERSION_INT(57, 37, 100)
+        if (hasPacket) {
+            av_free_packet(&readingPacket);
+        }
+#else
+        av_frame_free(&resampled);
+        swr_free(&swr);
+#endif
+        av_frame_free(&frame);
+
+        if (codecContext) {
+            avcodec_close(codecContext);
+#if LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(57, 5, 0)
+            avcodec_free_context(&codecContext);
+#endif
+        }
+
+        if (formatContext) {
+            avformat_close_input(&formatContext);
+        }
+    }
+};
+
+AudioDecoder::AudioDecoder() = default;
+
+AudioDecoder::~AudioDecoder() = default;
+
+bool AudioDecoder::open(const rwfs::path& filePath) {
+    close();
+    context = std::make_unique<Context>();
+    auto& c = *context;
+
+    // Allocate audio frame
+    c.frame = av_frame_alloc();
+    if (!c.frame) {
+        RW_ERROR("Error allocating the audio frame");
+        close();
+        return false;
+    }
+
+    if (avformat_open_input(&c.formatContext, filePath.string().c_str(),
+                            nullptr, nullptr) != 0) {
+        RW_ERROR("Error opening audio file (" << filePath << ")");
+        close();
+        return false;
+    }
+
+    if (avformat_find_stream_info(c.formatContext, nullptr) < 0) {
+        RW_ERROR("Error finding audio stream info");
+        close();
+        return false;
+    }
+
+    // Find the audio stream
+    c.streamIndex = av_find_best_stream(c.formatContext, AVMEDIA_TYPE_AUDIO,
+                                        -1, -1, nullptr, 0);
+    if (c.streamIndex < 0) {
+        RW_ERROR("Could not find any audio stream in the file " << filePath);
+        close();
+        return false;
+    }
+
+    AVStream* audioStream = c.formatContext->streams[c.streamIndex];
+    AVCodec* codec = avcodec_find_decoder(audioStream->codecpar->codec_id);
+
+#if LIBAVCODEC_VERSION_INT < AV_VERSION_INT(57, 5, 0)
+    c.codecContext = audioStream->codec;
+    c.codecContext->codec = codec;
+
+    // Open the codec
+    if (avcodec_open2(c.codecContext, c.codecContext->codec, nullptr) != 0) {
+        RW_ERROR("Couldn't open the audio codec context");
+        close();
+        return false;
+    }
+#else
+    // Initialize codec context for the decoder.
+    c.codecContext = avcodec_alloc_context3(codec);
+    if (!c.codecContext) {
+        RW_ERROR("Couldn't allocate a decoding context.");
+        close();
+        return false;
+    }
+
+    // Fill the codecCtx with the parameters of the codec used in the read file.
+    if (avcodec_parameters_to_context(c.codecContext, audioStream->codecpar) !=
+        0) {
+        RW_ERROR("Couldn't find parametrs for context");
+        close();
+        return false;
+    }
+
+    // Initialize the decoder.
+    if (avcodec_open2(c.codecContext, codec, nullptr) != 0) {
+        RW_ERROR("Couldn't open the audio codec context");
+        close();
+        return false;
+    }
+
+    c.resampled = av_frame_alloc();
+#endif
+
+#if LIBAVCODEC_VERSION_INT < AV_VERSION_INT(57, 37, 100)
+    av_init_packet(&c.readingPacket);
+    c.decodingPacket.size = 0;
+#endif
+
+    sampleRate = static_cast<size_t>(c.codecContext->sample_rate);
+    return true;
+}
+
+void AudioDecoder::close() {
+    context.reset();
+    sampleRate = 0;
+    pending.clear();
+    pendingOffset = 0;
+}
+
+bool AudioDecoder::isOpen() const {
+    return context != nullptr;
+}
+
+size_t AudioDecoder::decode(std::vector<int16_t>& out, size_t maxSamples) {
+    if (!context) {
+        return 0;
+    }
+
+    size_t written = 0;
+    while (written < maxSamples) {
+        if (pendingOffset == pending.size()) {
+            pending.clear();
+            pendingOffset = 0;
+            if (!decodeFrame()) {
+                break;
+            }
+            continue;
+        }
+
+        auto count =
+            std::min(maxSamples - written, pending.size() - pendingOffset);
+        auto first = pending.data() + pendingOffset;
+        out.insert(out.end(), first, first + count);
+        pendingOffset += count;
+        written += count;
+    }
+
+    return written;
+}
+
+bool AudioDecoder::seek(float seconds) {
+    if (!context) {
+        return false;
+    }
+    auto& c = *context;
+
+    // Lands on the closest packet before the requested time
+    AVStream* audioStream = c.formatContext->streams[c.streamIndex];
+    auto timestamp = static_cast<int64_t>(static_cast<double>(seconds) /
+                                          av_q2d(audioStream->time_base));
+    if (av_seek_frame(c.formatContext, c.streamIndex, timestamp,
+                      AVSEEK_FLAG_BACKWARD) < 0) {
+        RW_ERROR("Error seeking audio stream to " << seconds);
+        return false;
+    }
+    avcodec_flush_buffers(c.codecContext);
+
+#if LIBAVCODEC_VERSION_INT < AV_VERSION_INT(57, 37, 100)
+    if (c.hasPacket) {
+        av_free_packet(&c.readingPacket);
+        c.hasPacket = false;
+    }
+    c.decodingPacket.size = 0;
+#else
+    c.draining = false;
+#endif
+
+    pending.clear();
+    pendingOffset = 0;
+    return true;
+}
+
+bool AudioDecoder::decodeFrame() {
+    auto& c = *context;
+
+#if LIBAVCODEC_VERSION_INT < AV_VERSION_INT(57, 37, 100)
+
+    while (true) {
+        if (c.decodingPacket.size > 0) {
+            // Decode audio packet
+            int gotFrame = 0;
+            int len = avcodec_decode_audio4(c.codecContext, c.frame, &gotFrame,
+                                            &c.decodingPacket);
+            if (len < 0) {
+                c.decodingPacket.size = 0;
+                c.decodingPacket.data = nullptr;
+                continue;
+            }
+
+            c.decodingPacket.size -= len;
+            c.decodingPacket.data += len;
+
+            if (gotFrame) {
+                // Interleave left/right channels
+                for (size_t i = 0; i < static_cast<size_t>(c.frame->nb_samples);
+                     i++) {
+                    for (size_t channel = 0; channel < kChannels; channel++) {
+                        pending.push_back(reinterpret_cast<int16_t*>(
+                            c.frame->data[channel])[i]);
+                    }
+                }
+                return true;
+            }
+            continue;
+        }
+
+        if (c.hasPacket) {
+            av_free_packet(&c.readingPacket);
+            c.hasPacket = false;
+        }
+        if (av_read_frame(c.formatContext, &c.readingPacket) != 0) {
+            return false;
+        }
+        c.hasPacket = true;
+        if (c.readingPacket.stream_index == c.streamIndex) {
+            c.decodingPacket = c.readingPacket;
+        }
+    }
+
+#else
+
+    while (true) {
+        int receiveFrame = avcodec_receive_frame(c.codecContext, c.frame);
+        if (receiveFrame == 0) {
+            break;
+        }
+        if (receiveFrame != AVERROR(EAGAIN)) {
+            // End of file, or the decoder failed
+            return false;
+        }
+
+        // The decoder needs more input
+        AVPacket readingPacket;
+        av_init_packet(&readingPacket);
+        readingPacket.data = nullptr;
+        readingPacket.size = 0;
+
+        if (av_read_frame(c.formatContext, &readingPacket) != 0) {
+            if (c.draining) {
+                return false;
+            }
+            // Flush out the frames still held by the decoder
+            avcodec_send_packet(c.codecContext, nullptr);
+            c.draining = true;
+            continue;
+        }
+
+        if (readingPacket.stream_index == c.streamIndex) {
+            avcodec_send_packet(c.codecContext, &readingPacket);
+        }
+        av_packet_unref(&readingPacket);
+    }
+
+    AVFrame* frame = c.frame;
+    if (!c.swr) {
+        if (frame->channels == 1 || frame->channel_layout == 0) {
+            frame->channel_layout = av_get_default_channel_layout(1);
+        }
+        c.swr = swr_alloc_set_opts(
+            nullptr,
+            AV_CH_LAYOUT_STEREO,                          // output channel layout
+            kOutputFMT,                                   // output format
+            frame->sample_rate,                           // output sample rate
+            frame->channel_layout,                        // input channel layout
+            static_cast<AVSampleFormat>(frame->format),  // input format
+            frame->sample_rate,                           // input sample rate
+            0, nullptr);
+        if (!c.swr) {
+            RW_ERROR("Resampler has not been successfully allocated.");
+            return false;
+        }
+        swr_init(c.swr);
+        if (!swr_is_initialized(c.swr)) {
+            RW_ERROR("Resampler has not been properly initialized.");
+            return false;
+        }
+    }
+
+    c.resampled->channel_layout = AV_CH_LAYOUT_STEREO;
+    c.resampled->sample_rate = frame->sample_rate;
+    c.resampled->format = kOutputFMT;
+    c.resampled->channels = static_cast<int>(kChannels);
+
+    swr_config_frame(c.swr, c.resampled, frame);
+
+    if (swr_convert_frame(c.swr, c.resampled, frame) < 0) {
+        RW_ERROR("Error resampling audio frame");
+        av_frame_unref(c.resampled);
+        return false;
+    }
+
+    auto samples = reinterpret_cast<int16_t*>(c.resampled->data[0]);
+    pending.insert(
+        pending.end(), samples,
+        samples + static_cast<size_t>(c.resampled->nb_samples) * kChannels);
+    av_frame_unref(c.resampled);
+
+    return true;
+
+#endif
+}
@@ -0,0 +1,58 @@
+#ifndef _RWENGINE_AUDIO_DECODER_HPP_
+#define _RWENGINE_AUDIO_DECODER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <rw/filesystem.hpp>
+
+/// Incremental decoder for mp3/wav files,
+/// cooperate with ffmpeg.
+/// Output is always interleaved 16 bit stereo, so
+/// callers can pull as little audio as they need
+/// instead of decoding the whole file up front.
+class AudioDecoder {
+public:
+    static constexpr size_t kChannels = 2;
+
+    AudioDecoder();
+    ~AudioDecoder();
+
+    AudioDecoder(const AudioDecoder&) = delete;
+    AudioDecoder& operator=(const AudioDecoder&) = delete;
+
+    /// Open file for decoding, closes any previous file
+    bool open(const rwfs::path& filePath);
+    void close();
+
+    bool isOpen() const;
+
+    /// Append up to maxSamples samples (counting both channels) to out.
+    /// @return number of samples appended, 0 once the end is reached
+    size_t decode(std::vector<int16_t>& out, size_t maxSamples);
+
+    /// Move the read position, the next decode continues from there
+    bool seek(float seconds);
+
+    size_t getSampleRate() const {
+        return sampleRate;
+    }
+
+private:
+    /// ffmpeg state, kept out of the header
+    struct Context;
+    std::unique_ptr<Context> context;
+
+    size_t sampleRate = 0;
+
+    /// Samples of the last frame that didn't fit the previous request
+    std::vector<int16_t> pending;
+    size_t pendingOffset = 0;
+
+    /// Decode the next frame into pending
+    bool decodeFrame();
+};
+
+#endif
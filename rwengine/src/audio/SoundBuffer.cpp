@@ -1,12 +1,13 @@
 #include "audio/SoundBuffer.hpp"
 
+#include <limits>
+
 #include <rw/types.hpp>
 
 #include "audio/alCheck.hpp"
 
 SoundBuffer::SoundBuffer() {
     alCheck(alGenSources(1, &source));
-    alCheck(alGenBuffers(1, &buffer));
 
     alCheck(alSourcef(source, AL_PITCH, 1));
     alCheck(alSourcef(source, AL_GAIN, 1));
@@ -15,7 +16,19 @@ SoundBuffer::SoundBuffer() {
     alCheck(alSourcei(source, AL_LOOPING, AL_FALSE));
 }
 
+SoundBuffer::~SoundBuffer() {
+    alCheck(alSourceStop(source));
+    alCheck(alSourcei(source, AL_BUFFER, 0));
+    alCheck(alDeleteSources(1, &source));
+    if (buffer) {
+        alCheck(alDeleteBuffers(1, &buffer));
+    }
+}
+
 bool SoundBuffer::bufferData(SoundSource& soundSource) {
+    if (!buffer) {
+        alCheck(alGenBuffers(1, &buffer));
+    }
     alCheck(alBufferData(
         buffer,
         soundSource.channels == 1 ? AL_FORMAT_MONO16 : AL_FORMAT_STEREO16,
@@ -26,6 +39,14 @@ bool SoundBuffer::bufferData(SoundSource& soundSource) {
     return true;
 }
 
+void SoundBuffer::attach(ALuint sharedBuffer) {
+    alCheck(alSourceStop(source));
+    alCheck(alSourcei(source, AL_BUFFER, sharedBuffer));
+    alCheck(alSourcei(source, AL_LOOPING, AL_FALSE));
+    alCheck(alSourcef(source, AL_MAX_DISTANCE,
+                      std::numeric_limits<float>::max()));
+}
+
 bool SoundBuffer::isPlaying() const {
     ALint sourceState;
     alCheck(alGetSourcei(source, AL_SOURCE_STATE, &sourceState));
@@ -44,6 +65,12 @@ bool SoundBuffer::isStopped() const {
     return AL_STOPPED == sourceState;
 }
 
+bool SoundBuffer::isIdle() const {
+    ALint sourceState;
+    alCheck(alGetSourcei(source, AL_SOURCE_STATE, &sourceState));
+    return AL_STOPPED == sourceState || AL_INITIAL == sourceState;
+}
+
 void SoundBuffer::play() {
     alCheck(alSourcePlay(source));
 }
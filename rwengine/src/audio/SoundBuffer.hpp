@@ -14,11 +14,23 @@ class SoundBuffer {
 
 public:
     SoundBuffer();
+    ~SoundBuffer();
+
+    SoundBuffer(const SoundBuffer&) = delete;
+    SoundBuffer& operator=(const SoundBuffer&) = delete;
+
     bool bufferData(SoundSource& soundSource);
 
+    /// Play a buffer owned by someone else, e.g. one
+    /// decoded sfx shared by many voices.
+    /// Resets looping and distance from the last use.
+    void attach(ALuint sharedBuffer);
+
     bool isPlaying() const;
     bool isPaused() const;
     bool isStopped() const;
+    /// Stopped, or never played
+    bool isIdle() const;
 
     void play();
     void pause();
@@ -32,7 +44,8 @@ public:
 
 private:
     ALuint source;
-    ALuint buffer;
+    /// Own buffer, created by bufferData
+    ALuint buffer = 0;
 };
 
 #endif
@@ -14,6 +14,8 @@ extern "C" {
 
 #include <rw/types.hpp>
 
+constexpr size_t SoundManager::kMaxVoices;
+
 Sound& SoundManager::getSoundRef(size_t name) {
     auto ref = buffers.find(name);
     if (ref != buffers.end()) {
@@ -38,6 +40,16 @@ SoundManager::SoundManager(GameWorld* engine) : _engine(engine) {
 }
 
 SoundManager::~SoundManager() {
+    // Release OpenAL objects while the context is still alive
+    streams.clear();
+    sounds.clear();
+    buffers.clear();
+    for (auto& cached : sfx) {
+        if (cached.second) {
+            alCheck(alDeleteBuffers(1, &cached.second));
+        }
+    }
+
     // De-initialize OpenAL
     if (alContext) {
         alcMakeContextCurrent(nullptr);
@@ -111,53 +123,92 @@ bool SoundManager::loadSound(const std::string& name,
 }
 
 void SoundManager::loadSound(size_t index) {
-    Sound* sound = nullptr;
+    if (sfx.find(index) != sfx.end()) {
+        return;
+    }
 
-    auto emplaced =
-        sfx.emplace(std::piecewise_construct, std::forward_as_tuple(index),
-                    std::forward_as_tuple());
-    sound = &emplaced.first->second;
+    ALuint buffer = 0;
+    alCheck(alGenBuffers(1, &buffer));
+
+    // Sfx are raw 16 bit mono, so they can go
+    // straight from the mapped archive to OpenAL
+    if (auto data = sdt.getAssetData(index)) {
+        const auto& info = sdt.getAssetInfoByIndex(index);
+        alCheck(alBufferData(buffer, AL_FORMAT_MONO16, data,
+                             static_cast<ALsizei>(info.size),
+                             static_cast<ALsizei>(info.sampleRate)));
+        sfxMemory.set(sfxMemory.get() + info.size);
+    } else {
+        SoundSource source;
+        source.loadSfx(sdt, index);
+        if (source.data.empty()) {
+            // Remember the failure instead of retrying on every use
+            alCheck(alDeleteBuffers(1, &buffer));
+            buffer = 0;
+        } else {
+            alCheck(alBufferData(
+                buffer,
+                source.channels == 1 ? AL_FORMAT_MONO16 : AL_FORMAT_STEREO16,
+                source.data.data(),
+                static_cast<ALsizei>(source.data.size() * sizeof(int16_t)),
+                static_cast<ALsizei>(source.sampleRate)));
+            sfxMemory.set(sfxMemory.get() +
+                          source.data.size() * sizeof(int16_t));
+        }
+    }
 
-    sound->source = std::make_shared<SoundSource>();
-    sound->source->loadSfx(sdt, index);
+    sfx.emplace(index, buffer);
 }
 
-size_t SoundManager::createSfxInstance(size_t index) {
-    Sound* sound = nullptr;
-    auto soundRef = sfx.find(index);
-
-    if(soundRef == sfx.end()) {
+size_t SoundManager::createSfxInstance(size_t index, int priority) {
+    auto cached = sfx.find(index);
+    if (cached == sfx.end()) {
         // Sound source is not loaded yet
         loadSound(index);
-        soundRef = sfx.find(index);
+        cached = sfx.find(index);
     }
 
-    // Try to reuse first available buffer
-    // (aka with stopped state)
-    for (auto& sound : buffers) {
-        if (sound.second.buffer && sound.second.isStopped()) {
-            // Let's use this buffer
-            sound.second.buffer = std::make_unique<SoundBuffer>();
-            sound.second.source = soundRef->second.source;
-            sound.second.isLoaded =
-                sound.second.buffer->bufferData(*sound.second.source);
-            return sound.first;
+    auto id = acquireVoice();
+    auto& sound = buffers[id];
+    sound.buffer->attach(cached->second);
+    sound.isLoaded = cached->second != 0;
+    voices[id].priority = priority;
+    voices[id].position = listenerPosition;
+
+    return id;
+}
+
+size_t SoundManager::acquireVoice() {
+    // Reuse the first voice that finished playing
+    for (size_t id = 0; id < voices.size(); ++id) {
+        if (buffers[id].buffer->isIdle()) {
+            return id;
         }
     }
-    // There's no available free buffer, so
-    // we should create a new one.
-    auto emplaced = buffers.emplace(std::piecewise_construct,
-                                    std::forward_as_tuple(bufferNr),
-                                    std::forward_as_tuple());
-    sound = &emplaced.first->second;
 
-    sound->id = bufferNr;
-    sound->buffer = std::make_unique<SoundBuffer>();
-    sound->source = soundRef->second.source;
-    sound->isLoaded = sound->buffer->bufferData(*sound->source);
-    bufferNr++;
+    if (voices.size() < kMaxVoices) {
+        auto id = voices.size();
+        auto& sound = buffers[id];
+        sound.id = id;
+        sound.buffer = std::make_unique<SoundBuffer>();
+        voices.emplace_back();
+        return id;
+    }
 
-    return sound->id;
+    // Every voice is busy, steal the least important one
+    auto importance = [&](size_t id) {
+        auto offset = voices[id].position - listenerPosition;
+        return std::make_pair(voices[id].priority, -glm::dot(offset, offset));
+    };
+    size_t victim = 0;
+    for (size_t id = 1; id < voices.size(); ++id) {
+        if (importance(id) < importance(victim)) {
+            victim = id;
+        }
+    }
+
+    // attach() stops it
+    return victim;
 }
 
 bool SoundManager::isLoaded(const std::string& name) {
@@ -173,6 +224,10 @@ bool SoundManager::isPlaying(const std::string& name) {
     if (sound != sounds.end()) {
         return sound->second.isPlaying();
     }
+    auto stream = streams.find(name);
+    if (stream != streams.end()) {
+        return stream->second->isPlaying();
+    }
     return false;
 }
 
@@ -181,6 +236,10 @@ bool SoundManager::isStopped(const std::string& name) {
     if (sound != sounds.end()) {
         return sound->second.isStopped();
     }
+    auto stream = streams.find(name);
+    if (stream != streams.end()) {
+        return stream->second->isStopped();
+    }
     return false;
 }
 
@@ -189,6 +248,10 @@ bool SoundManager::isPaused(const std::string& name) {
     if (sound != sounds.end()) {
         return sound->second.isPaused();
     }
+    auto stream = streams.find(name);
+    if (stream != streams.end()) {
+        return stream->second->isPaused();
+    }
     return false;
 }
 
@@ -203,6 +266,7 @@ void SoundManager::playSfx(size_t name, const glm::vec3& position, bool looping,
                            int maxDist) {
     auto buffer = buffers.find(name);
     if (buffer != buffers.end()) {
+        voices[name].position = position;
         buffer->second.setPosition(position);
         if (looping) {
             buffer->second.setLooping(looping);
@@ -228,6 +292,11 @@ void SoundManager::pauseAllSounds() {
             sound.second.pause();
         }
     }
+    for (auto& stream : streams) {
+        if (stream.second->isPlaying()) {
+            stream.second->pause();
+        }
+    }
 }
 
 void SoundManager::resumeAllSounds() {
@@ -241,13 +310,17 @@ void SoundManager::resumeAllSounds() {
             sound.second.play();
         }
     }
+    for (auto& stream : streams) {
+        if (stream.second->isPaused()) {
+            stream.second->play();
+        }
+    }
 }
 
 bool SoundManager::playBackground(const std::string& fileName) {
-    if (this->loadSound(fileName, fileName)) {
+    if (loadMusic(fileName, fileName)) {
         backgroundNoise = fileName;
-        auto& sound = getSoundRef(fileName);
-        sound.play();
+        playMusic(fileName);
         return true;
     }
 
@@ -256,20 +329,24 @@ bool SoundManager::playBackground(const std::string& fileName) {
 
 bool SoundManager::loadMusic(const std::string& name,
                              const std::string& fileName) {
-    return loadSound(name, fileName);
+    auto& stream = streams[name];
+    if (!stream) {
+        stream = std::make_unique<SoundStream>();
+    }
+    return stream->open(fileName);
 }
 
 void SoundManager::playMusic(const std::string& name) {
-    auto sound = sounds.find(name);
-    if (sound != sounds.end()) {
-        sound->second.play();
+    auto stream = streams.find(name);
+    if (stream != streams.end()) {
+        stream->second->play();
     }
 }
 
 void SoundManager::stopMusic(const std::string& name) {
-    auto sound = sounds.find(name);
-    if (sound != sounds.end()) {
-        sound->second.stop();
+    auto stream = streams.find(name);
+    if (stream != streams.end()) {
+        stream->second->stop();
     }
 }
 
@@ -290,6 +367,8 @@ void SoundManager::updateListenerTransform(const ViewCamera& cam) {
     float orientation[6] = {at.x, at.y, at.z, up.x, up.y, up.z};
     alListenerfv(AL_ORIENTATION, orientation);
 
+    listenerPosition = cam.position;
+
     // Position
     float position[3] = {cam.position.x, cam.position.y, cam.position.z};
     alListenerfv(AL_POSITION, position);
@@ -2,6 +2,7 @@
 #define _RWENGINE_SOUNDMANAGER_HPP_
 
 #include "audio/Sound.hpp"
+#include "audio/SoundStream.hpp"
 
 #include <algorithm>
 #include <cstddef>
@@ -16,6 +17,7 @@
 #include <glm/glm.hpp>
 
 #include <rw/filesystem.hpp>
+#include <rw/memorystats.hpp>
 #include <loaders/LoaderSDT.hpp>
 
 class GameWorld;
@@ -35,13 +37,28 @@ public:
     /// Load sound from file and store it with selected name
     bool loadSound(const std::string& name, const std::string& fileName);
 
-    /// Load selected sfx sound
+    /// Sfx voices playing at once, beyond that a voice gets stolen
+    static constexpr size_t kMaxVoices = 32;
+
+    /// Load selected sfx sound into the cache,
+    /// it's shared by every voice playing it
     void loadSound(size_t index);
 
     Sound& getSoundRef(size_t name);
     Sound& getSoundRef(const std::string& name);
 
-    size_t createSfxInstance(size_t index);
+    /// Get a voice from the pool playing selected sfx.
+    /// If all voices are busy the one with the lowest priority,
+    /// then the farthest from the listener, is stopped and reused.
+    size_t createSfxInstance(size_t index, int priority = 0);
+
+    size_t getVoiceCount() const {
+        return voices.size();
+    }
+
+    size_t getSfxCacheSize() const {
+        return sfx.size();
+    }
 
     /// Checking is selected sound loaded.
     bool isLoaded(const std::string& name);
@@ -70,8 +87,11 @@ public:
     void resumeAllSounds();
 
     /// Play background from selected file.
+    /// Streamed like music.
     bool playBackground(const std::string& fileName);
 
+    /// Open file for streaming, playback can start
+    /// before it has been decoded.
     bool loadMusic(const std::string& name, const std::string& fileName);
     void playMusic(const std::string& name);
     void stopMusic(const std::string& name);
@@ -93,13 +113,26 @@ private:
 
     /// Containers for sounds
     std::unordered_map<std::string, Sound> sounds;
-    std::unordered_map<size_t, Sound> sfx;
+    /// Decoded sfx by sdt index
+    std::unordered_map<size_t, ALuint> sfx;
+    /// Sample data held by OpenAL for the sfx cache
+    TrackedMemory<MemoryTag::Sound> sfxMemory;
+    /// Voice pool, by voice id
     std::unordered_map<size_t, Sound> buffers;
+    std::unordered_map<std::string, std::unique_ptr<SoundStream>> streams;
+
+    /// Used to pick a voice to steal
+    struct Voice {
+        int priority = 0;
+        glm::vec3 position{};
+    };
+    std::vector<Voice> voices;
+    glm::vec3 listenerPosition{};
 
     std::string backgroundNoise;
 
-    /// Nr of already created buffers
-    size_t bufferNr = 0;
+    /// Find a free voice, or steal one
+    size_t acquireVoice();
 
     GameWorld* _engine;
     LoaderSDT sdt{};
@@ -1,4 +1,7 @@
 #include "audio/SoundSource.hpp"
+
+#include "audio/AudioDecoder.hpp"
+
 #include <loaders/LoaderSDT.hpp>
 #include <rw/types.hpp>
 
@@ -7,8 +10,6 @@ extern "C" {
 #include <libavformat/avformat.h>
 #include <libavformat/avio.h>
 #include <libavutil/avutil.h>
-#include <libavutil/opt.h>
-#include <libswresample/swresample.h>
 }
 
 // Rename some functions for older libavcodec/ffmpeg versions (e.g. Ubuntu
@@ -22,220 +23,22 @@ extern "C" {
 #define avio_context_free av_freep
 #endif
 
-constexpr int kNumOutputChannels = 2;
-constexpr AVSampleFormat kOutputFMT = AV_SAMPLE_FMT_S16;
-
 void SoundSource::loadFromFile(const rwfs::path& filePath) {
-    // Allocate audio frame
-    AVFrame* frame = av_frame_alloc();
-    if (!frame) {
-        RW_ERROR("Error allocating the audio frame");
-        return;
-    }
-
-    // Allocate formatting context
-    AVFormatContext* formatContext = nullptr;
-    if (avformat_open_input(&formatContext, filePath.string().c_str(), nullptr,
-                            nullptr) != 0) {
-        av_frame_free(&frame);
-        RW_ERROR("Error opening audio file (" << filePath << ")");
-        return;
-    }
-
-    if (avformat_find_stream_info(formatContext, nullptr) < 0) {
-        av_frame_free(&frame);
-        avformat_close_input(&formatContext);
-        RW_ERROR("Error finding audio stream info");
+    RW_MEMORY_SCOPE(MemoryTag::Sound);
+    AudioDecoder decoder;
+    if (!decoder.open(filePath)) {
         return;
     }
 
-    // Find the audio stream
-    int streamIndex = av_find_best_stream(formatContext, AVMEDIA_TYPE_AUDIO, -1,
-                                          -1, nullptr, 0);
-    if (streamIndex < 0) {
-        av_frame_free(&frame);
-        avformat_close_input(&formatContext);
-        RW_ERROR("Could not find any audio stream in the file " << filePath);
-        return;
-    }
-
-    AVStream* audioStream = formatContext->streams[streamIndex];
-    AVCodec* codec = avcodec_find_decoder(audioStream->codecpar->codec_id);
-
-#if LIBAVCODEC_VERSION_INT < AV_VERSION_INT(57, 5, 0)
-    AVCodecContext* codecContext = audioStream->codec;
-    codecContext->codec = codec;
-
-    // Open the codec
-    if (avcodec_open2(codecContext, codecContext->codec, nullptr) != 0) {
-        av_frame_free(&frame);
-        avformat_close_input(&formatContext);
-        RW_ERROR("Couldn't open the audio codec context");
-        return;
-    }
-#else
-    // Initialize codec context for the decoder.
-    AVCodecContext* codecContext = avcodec_alloc_context3(codec);
-    if (!codecContext) {
-        av_frame_free(&frame);
-        avformat_close_input(&formatContext);
-        RW_ERROR("Couldn't allocate a decoding context.");
-        return;
-    }
-
-    // Fill the codecCtx with the parameters of the codec used in the read file.
-    if (avcodec_parameters_to_context(codecContext, audioStream->codecpar) !=
-        0) {
-        avcodec_close(codecContext);
-        avcodec_free_context(&codecContext);
-        avformat_close_input(&formatContext);
-        RW_ERROR("Couldn't find parametrs for context");
-    }
-
-    // Initialize the decoder.
-    if (avcodec_open2(codecContext, codec, nullptr) != 0) {
-        avcodec_close(codecContext);
-        avcodec_free_context(&codecContext);
-        avformat_close_input(&formatContext);
-        RW_ERROR("Couldn't open the audio codec context");
-        return;
-    }
-#endif
-
     // Expose audio metadata
-    channels = kNumOutputChannels;
-    sampleRate = static_cast<size_t>(codecContext->sample_rate);
-
-    // prepare resampler
-    SwrContext* swr = nullptr;
-
-    // Start reading audio packets
-    AVPacket readingPacket;
-    av_init_packet(&readingPacket);
-
-#if LIBAVCODEC_VERSION_INT < AV_VERSION_INT(57, 37, 100)
+    channels = AudioDecoder::kChannels;
+    sampleRate = decoder.getSampleRate();
 
-    while (av_read_frame(formatContext, &readingPacket) == 0) {
-        if (readingPacket.stream_index == audioStream->index) {
-            AVPacket decodingPacket = readingPacket;
-
-            while (decodingPacket.size > 0) {
-                // Decode audio packet
-                int gotFrame = 0;
-                int len = avcodec_decode_audio4(codecContext, frame, &gotFrame,
-                                                &decodingPacket);
-
-                if (len >= 0 && gotFrame) {
-                    // Write samples to audio buffer
-                    for (size_t i = 0;
-                         i < static_cast<size_t>(frame->nb_samples); i++) {
-                        // Interleave left/right channels
-                        for (size_t channel = 0; channel < channels;
-                             channel++) {
-                            int16_t sample = reinterpret_cast<int16_t*>(
-                                frame->data[channel])[i];
-                            data.push_back(sample);
-                        }
-                    }
-
-                    decodingPacket.size -= len;
-                    decodingPacket.data += len;
-                } else {
-                    decodingPacket.size = 0;
-                    decodingPacket.data = nullptr;
-                }
-            }
-        }
-        av_free_packet(&readingPacket);
+    // Decode in chunks of one second until the end
+    const auto chunkSize = sampleRate * channels;
+    while (decoder.decode(data, chunkSize) > 0) {
     }
-#else
-
-    AVFrame* resampled = av_frame_alloc();
-
-    while (av_read_frame(formatContext, &readingPacket) == 0) {
-        if (readingPacket.stream_index == audioStream->index) {
-            int sendPacket = avcodec_send_packet(codecContext, &readingPacket);
-            av_packet_unref(&readingPacket);
-            int receiveFrame = 0;
-
-            while ((receiveFrame =
-                        avcodec_receive_frame(codecContext, frame)) == 0) {
-                if (!swr) {
-                    if (frame->channels == 1 || frame->channel_layout == 0) {
-                        frame->channel_layout =
-                            av_get_default_channel_layout(1);
-                    }
-                    swr = swr_alloc_set_opts(
-                        nullptr,
-                        AV_CH_LAYOUT_STEREO,    // output channel layout
-                        kOutputFMT,             // output format
-                        frame->sample_rate,     // output sample rate
-                        frame->channel_layout,  // input channel layout
-                        static_cast<AVSampleFormat>(
-                            frame->format),  // input format
-                        frame->sample_rate,  // input sample rate
-                        0, nullptr);
-                    if (!swr) {
-                        RW_ERROR(
-                            "Resampler has not been successfully allocated.");
-                        return;
-                    }
-                    swr_init(swr);
-                    if (!swr_is_initialized(swr)) {
-                        RW_ERROR(
-                            "Resampler has not been properly initialized.");
-                        return;
-                    }
-                }
-
-                // Decode audio packet
-                if (receiveFrame == 0 && sendPacket == 0) {
-                    // Write samples to audio buffer
-                    resampled->channel_layout = AV_CH_LAYOUT_STEREO;
-                    resampled->sample_rate = frame->sample_rate;
-                    resampled->format = kOutputFMT;
-                    resampled->channels = kNumOutputChannels;
-
-                    swr_config_frame(swr, resampled, frame);
-
-                    if (swr_convert_frame(swr, resampled, frame) < 0) {
-                        RW_ERROR("Error resampling " << filePath << '\n');
-                    }
-
-                    for (size_t i = 0;
-                         i <
-                         static_cast<size_t>(resampled->nb_samples) * channels;
-                         i++) {
-                        data.push_back(
-                            reinterpret_cast<int16_t*>(resampled->data[0])[i]);
-                    }
-                    av_frame_unref(resampled);
-                }
-            }
-        }
-    }
-
-    /// Free all data used by the resampled frame.
-    av_frame_free(&resampled);
-
-#endif
-
-    // Cleanup
-    /// Free all data used by the frame.
-    av_frame_free(&frame);
-
-    /// Free resampler
-    swr_free(&swr);
-
-    /// Close the context and free all data associated to it, but not the
-    /// context itself.
-    avcodec_close(codecContext);
-
-    /// Free the context itself.
-    avcodec_free_context(&codecContext);
-
-    /// We are done here. Close the input.
-    avformat_close_input(&formatContext);
+    memory.set(data.capacity() * sizeof(int16_t));
 }
 
 /// Structure for input data
@@ -2,6 +2,7 @@
 #define _RWENGINE_SOUND_SOURCE_HPP_
 
 #include <rw/filesystem.hpp>
+#include <rw/memorystats.hpp>
 #include <loaders/LoaderSDT.hpp>
 
 /// Opaque for raw sound,
@@ -21,6 +22,7 @@ public:
 private:
     /// Raw data
     std::vector<int16_t> data;
+    TrackedMemory<MemoryTag::Sound> memory;
 
     size_t channels;
     size_t sampleRate;
@@ -0,0 +1,253 @@
+#include "audio/SoundStream.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include <rw/types.hpp>
+
+#include "audio/alCheck.hpp"
+
+namespace {
+/// How often the decoder thread checks for played buffers
+constexpr std::chrono::milliseconds kPollInterval{10};
+}  // namespace
+
+SoundStream::SoundStream() {
+    alCheck(alGenSources(1, &source));
+    alCheck(alGenBuffers(static_cast<ALsizei>(kBufferCount), buffers.data()));
+
+    alCheck(alSourcef(source, AL_PITCH, 1));
+    alCheck(alSourcef(source, AL_GAIN, 1));
+    alCheck(alSource3f(source, AL_POSITION, 0, 0, 0));
+    alCheck(alSource3f(source, AL_VELOCITY, 0, 0, 0));
+    // Looping is done by the decoder, the source only sees the ring
+    alCheck(alSourcei(source, AL_LOOPING, AL_FALSE));
+}
+
+SoundStream::~SoundStream() {
+    close();
+    alCheck(alDeleteSources(1, &source));
+    alCheck(
+        alDeleteBuffers(static_cast<ALsizei>(kBufferCount), buffers.data()));
+}
+
+bool SoundStream::open(const rwfs::path& filePath) {
+    close();
+
+    if (!decoder.open(filePath)) {
+        return false;
+    }
+
+    sampleRate = static_cast<ALsizei>(decoder.getSampleRate());
+    bufferSamples = static_cast<size_t>(static_cast<float>(sampleRate) *
+                                        kBufferSeconds) *
+                    AudioDecoder::kChannels;
+    scratch.reserve(bufferSamples);
+
+    quit = false;
+    playing = false;
+    paused = false;
+    endOfStream = false;
+    seekPending = false;
+    freeBuffers.assign(buffers.begin(), buffers.end());
+    queuedBuffers = 0;
+    bufferedBytes = 0;
+    peakBufferedBytes = 0;
+
+    thread = std::thread(&SoundStream::run, this);
+    return true;
+}
+
+void SoundStream::close() {
+    if (thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+        }
+        wake.notify_one();
+        thread.join();
+    }
+
+    alCheck(alSourceStop(source));
+    unqueueAll();
+    decoder.close();
+    playing = false;
+    paused = false;
+}
+
+bool SoundStream::isOpen() const {
+    return decoder.isOpen();
+}
+
+bool SoundStream::isPlaying() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return playing && !paused;
+}
+
+bool SoundStream::isPaused() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return playing && paused;
+}
+
+bool SoundStream::isStopped() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return !playing;
+}
+
+bool SoundStream::isReady() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queuedBuffers > 0 || endOfStream;
+}
+
+void SoundStream::play() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!thread.joinable()) {
+        return;
+    }
+    if (!playing && endOfStream) {
+        // Played to the end, start over like a regular sound would
+        seekPending = true;
+        seekTarget = 0.f;
+    }
+    playing = true;
+    paused = false;
+    // Otherwise the decoder thread starts the source with the first buffer
+    if (queuedBuffers > 0 && !seekPending) {
+        alCheck(alSourcePlay(source));
+    }
+    wake.notify_one();
+}
+
+void SoundStream::pause() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (playing) {
+        paused = true;
+        alCheck(alSourcePause(source));
+    }
+}
+
+void SoundStream::stop() {
+    std::lock_guard<std::mutex> lock(mutex);
+    playing = false;
+    paused = false;
+    alCheck(alSourceStop(source));
+    seekPending = true;
+    seekTarget = 0.f;
+    wake.notify_one();
+}
+
+void SoundStream::seek(float seconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    seekPending = true;
+    seekTarget = seconds;
+    wake.notify_one();
+}
+
+void SoundStream::setPosition(const glm::vec3& position) {
+    alCheck(
+        alSource3f(source, AL_POSITION, position.x, position.y, position.z));
+}
+
+void SoundStream::setLooping(bool looping) {
+    std::lock_guard<std::mutex> lock(mutex);
+    this->looping = looping;
+    if (looping && endOfStream) {
+        // The decoder thread wraps around to the start
+        endOfStream = false;
+        wake.notify_one();
+    }
+}
+
+void SoundStream::setGain(float gain) {
+    alCheck(alSourcef(source, AL_GAIN, gain));
+}
+
+size_t SoundStream::getPeakBufferedBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return peakBufferedBytes;
+}
+
+void SoundStream::unqueueAll() {
+    // Detaching the buffer list only works on a stopped source
+    alCheck(alSourcei(source, AL_BUFFER, 0));
+    freeBuffers.assign(buffers.begin(), buffers.end());
+    queuedBuffers = 0;
+    bufferedBytes = 0;
+}
+
+void SoundStream::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (!quit) {
+        if (seekPending) {
+            seekPending = false;
+            alCheck(alSourceStop(source));
+            unqueueAll();
+            decoder.seek(seekTarget);
+            endOfStream = false;
+        }
+
+        // Take back the buffers that finished playing
+        ALint processed = 0;
+        alCheck(alGetSourcei(source, AL_BUFFERS_PROCESSED, &processed));
+        for (; processed > 0; --processed) {
+            ALuint buffer;
+            ALint size = 0;
+            alCheck(alSourceUnqueueBuffers(source, 1, &buffer));
+            alCheck(alGetBufferi(buffer, AL_SIZE, &size));
+            freeBuffers.push_back(buffer);
+            queuedBuffers--;
+            bufferedBytes -= static_cast<size_t>(size);
+        }
+
+        // Refill them, decoding without holding the lock so
+        // the game thread never waits on the decoder
+        while (!freeBuffers.empty() && !endOfStream && !seekPending && !quit) {
+            auto buffer = freeBuffers.back();
+            freeBuffers.pop_back();
+            auto loop = looping;
+
+            lock.unlock();
+            scratch.clear();
+            auto count = decoder.decode(scratch, bufferSamples);
+            if (loop && count < bufferSamples && decoder.seek(0.f)) {
+                count += decoder.decode(scratch, bufferSamples - count);
+            }
+            lock.lock();
+
+            if (seekPending || count == 0) {
+                // The decoded audio is stale, or there is none left
+                freeBuffers.push_back(buffer);
+                if (!seekPending) {
+                    endOfStream = true;
+                }
+                break;
+            }
+
+            auto bytes = count * sizeof(int16_t);
+            alCheck(alBufferData(buffer, AL_FORMAT_STEREO16, scratch.data(),
+                                 static_cast<ALsizei>(bytes), sampleRate));
+            alCheck(alSourceQueueBuffers(source, 1, &buffer));
+            queuedBuffers++;
+            bufferedBytes += bytes;
+            peakBufferedBytes =
+                std::max(peakBufferedBytes,
+                         bufferedBytes + scratch.capacity() * sizeof(int16_t));
+        }
+
+        if (playing && !paused && !seekPending) {
+            ALint state;
+            alCheck(alGetSourcei(source, AL_SOURCE_STATE, &state));
+            if (state != AL_PLAYING) {
+                if (queuedBuffers > 0) {
+                    // First buffer, or the decoder fell behind
+                    alCheck(alSourcePlay(source));
+                } else if (endOfStream) {
+                    playing = false;
+                }
+            }
+        }
+
+        wake.wait_for(lock, kPollInterval);
+    }
+}
@@ -0,0 +1,99 @@
+#ifndef _RWENGINE_SOUND_STREAM_HPP_
+#define _RWENGINE_SOUND_STREAM_HPP_
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <al.h>
+#include <alc.h>
+#include <glm/glm.hpp>
+
+#include <rw/filesystem.hpp>
+
+#include "audio/AudioDecoder.hpp"
+
+/// Plays a long mp3/wav file (music, radio, cutscene audio)
+/// without decoding all of it first.
+/// A decoder thread keeps a small ring of OpenAL buffers
+/// queued on the source, so memory use doesn't depend on
+/// the length of the file and playback can start as soon
+/// as the first buffer is decoded.
+class SoundStream {
+public:
+    /// Number of buffers in the ring
+    static constexpr size_t kBufferCount = 4;
+    /// Length of audio held by each buffer
+    static constexpr float kBufferSeconds = 0.25f;
+
+    SoundStream();
+    ~SoundStream();
+
+    SoundStream(const SoundStream&) = delete;
+    SoundStream& operator=(const SoundStream&) = delete;
+
+    /// Open file and start buffering it in the background
+    bool open(const rwfs::path& filePath);
+    void close();
+
+    bool isOpen() const;
+
+    bool isPlaying() const;
+    bool isPaused() const;
+    bool isStopped() const;
+
+    /// True once the first buffer is queued
+    bool isReady() const;
+
+    void play();
+    void pause();
+    /// Stop and rewind to the start of the file
+    void stop();
+    void seek(float seconds);
+
+    void setPosition(const glm::vec3& position);
+    void setLooping(bool looping);
+    void setGain(float gain);
+
+    /// Most bytes of PCM held by the stream at once
+    size_t getPeakBufferedBytes() const;
+
+private:
+    ALuint source;
+    std::array<ALuint, kBufferCount> buffers;
+
+    /// Only used by the decoder thread once it's running
+    AudioDecoder decoder;
+    std::vector<int16_t> scratch;
+    size_t bufferSamples = 0;
+    ALsizei sampleRate = 0;
+
+    std::thread thread;
+    mutable std::mutex mutex;
+    std::condition_variable wake;
+
+    // Guarded by mutex
+    bool quit = false;
+    bool playing = false;
+    bool paused = false;
+    bool looping = false;
+    bool endOfStream = false;
+    bool seekPending = false;
+    float seekTarget = 0.f;
+    std::vector<ALuint> freeBuffers;
+    size_t queuedBuffers = 0;
+    size_t bufferedBytes = 0;
+    size_t peakBufferedBytes = 0;
+
+    /// Decoder thread
+    void run();
+
+    /// Detach all buffers from the stopped source
+    void unqueueAll();
+};
+
+#endif
@@ -1,23 +1,146 @@
 #include <core/Logger.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
-#include <map>
+
+namespace {
+// How long the writer thread sleeps when the queue is empty
+constexpr std::chrono::milliseconds kWriterInterval(10);
+}  // namespace
+
+Logger::Logger(std::initializer_list<MessageReceiver*> initial)
+    : receivers(initial)
+    , queueHead(new QueueNode("", Verbose, ""))
+    , queueTail(queueHead.load()) {
+}
+
+Logger::~Logger() {
+    stopWriterThread();
+    delete queueTail;
+}
 
 void Logger::log(const std::string& component, Logger::MessageSeverity severity,
                  const std::string& message) {
-    LogMessage m{component, severity, message};
+    if (isEnabled(component, severity)) {
+        dispatch(LogMessage{component, severity, message});
+    }
+}
 
+void Logger::dispatch(LogMessage&& message) {
+    if (!writerRunning.load(std::memory_order_acquire)) {
+        deliver(message);
+        return;
+    }
+
+    auto node = new QueueNode(std::move(message));
+    pending.fetch_add(1, std::memory_order_relaxed);
+    auto previous = queueHead.exchange(node, std::memory_order_acq_rel);
+    previous->next.store(node, std::memory_order_release);
+}
+
+void Logger::deliver(const LogMessage& message) {
+    std::lock_guard<std::mutex> lock(receiverMutex);
     for (MessageReceiver* r : receivers) {
-        r->messageReceived(m);
+        r->messageReceived(message);
     }
 }
 
+size_t Logger::drainQueue() {
+    size_t delivered = 0;
+    while (true) {
+        auto next = queueTail->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            break;
+        }
+        // The popped node becomes the new empty tail
+        delete queueTail;
+        queueTail = next;
+        deliver(next->message);
+        delivered++;
+    }
+    pending.fetch_sub(delivered, std::memory_order_release);
+    return delivered;
+}
+
+void Logger::writerLoop() {
+    while (true) {
+        bool running = writerRunning.load(std::memory_order_acquire);
+        auto delivered = drainQueue();
+
+        std::unique_lock<std::mutex> lock(writerMutex);
+        if (delivered > 0) {
+            writerDrained.notify_all();
+            continue;
+        }
+        if (!running) {
+            break;
+        }
+        writerWake.wait_for(lock, kWriterInterval);
+    }
+}
+
+void Logger::startWriterThread() {
+    if (writer.joinable()) {
+        return;
+    }
+    writerRunning.store(true, std::memory_order_release);
+    writer = std::thread(&Logger::writerLoop, this);
+}
+
+void Logger::stopWriterThread() {
+    if (!writer.joinable()) {
+        return;
+    }
+    writerRunning.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        writerWake.notify_one();
+    }
+    writer.join();
+}
+
+void Logger::flush() {
+    if (!writer.joinable()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(writerMutex);
+    writerWake.notify_one();
+    writerDrained.wait(lock, [this] {
+        return pending.load(std::memory_order_acquire) == 0;
+    });
+}
+
+void Logger::setMinimumSeverity(MessageSeverity severity) {
+    minimumSeverity.store(severity, std::memory_order_relaxed);
+}
+
+void Logger::setMinimumSeverity(const std::string& component,
+                                MessageSeverity severity) {
+    std::lock_guard<std::mutex> lock(severityMutex);
+    componentSeverity[component] = severity;
+    hasComponentSeverity.store(true, std::memory_order_release);
+}
+
+bool Logger::isEnabled(const std::string& component,
+                       MessageSeverity severity) const {
+    if (hasComponentSeverity.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(severityMutex);
+        auto it = componentSeverity.find(component);
+        if (it != componentSeverity.end()) {
+            return severity >= it->second;
+        }
+    }
+    return severity >= minimumSeverity.load(std::memory_order_relaxed);
+}
+
 void Logger::addReceiver(Logger::MessageReceiver* out) {
+    std::lock_guard<std::mutex> lock(receiverMutex);
     receivers.push_back(out);
 }
 
 void Logger::removeReceiver(Logger::MessageReceiver* out) {
+    std::lock_guard<std::mutex> lock(receiverMutex);
     receivers.erase(std::remove(receivers.begin(), receivers.end(), out),
                     receivers.end());
 }
@@ -38,12 +161,12 @@ void Logger::verbose(const std::string& component, const std::string& message) {
     log(component, Logger::Verbose, message);
 }
 
-std::map<Logger::MessageSeverity, char> severityStr{{Logger::Error, 'E'},
-                                                    {Logger::Warning, 'W'},
-                                                    {Logger::Info, 'I'},
-                                                    {Logger::Verbose, 'V'}};
-
 void StdOutReceiver::messageReceived(const Logger::LogMessage& message) {
+    static const char severityStr[] = {'V', 'I', 'W', 'E'};
     std::cout << severityStr[message.severity] << " [" << message.component
-              << "] " << message.message << std::endl;
+              << "] " << message.message << '\n';
+    // Errors are flushed right away in case the game is about to exit
+    if (message.severity == Logger::Error) {
+        std::cout.flush();
+    }
 }
@@ -1,15 +1,26 @@
 #ifndef _RWENGINE_LOGGER_HPP_
 #define _RWENGINE_LOGGER_HPP_
 
+#include <atomic>
+#include <condition_variable>
 #include <initializer_list>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 /**
  * Handles and stores messages from different components
  *
- * Dispatches received messages to logger outputs.
+ * Dispatches received messages to logger outputs. Messages below the
+ * minimum severity of their component are dropped before they are
+ * formatted.
+ *
+ * By default receivers are called by the logging thread. After
+ * startWriterThread() messages are queued without locking and delivered by
+ * a writer thread instead, so logging is safe and cheap from any thread.
  */
 class Logger {
 public:
@@ -41,23 +52,136 @@ public:
         virtual void messageReceived(const LogMessage&) = 0;
     };
 
-    Logger(std::initializer_list<MessageReceiver*> initial = {})
-        : receivers(initial) {
-    }
+    Logger(std::initializer_list<MessageReceiver*> initial = {});
+
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
 
     void addReceiver(MessageReceiver* out);
     void removeReceiver(MessageReceiver* out);
 
+    /**
+     * Sets the lowest severity logged for components without their own
+     * minimum
+     */
+    void setMinimumSeverity(MessageSeverity severity);
+
+    /**
+     * Sets the lowest severity logged for one component
+     */
+    void setMinimumSeverity(const std::string& component,
+                            MessageSeverity severity);
+
+    /**
+     * @return true if a message would be passed on to the receivers
+     */
+    bool isEnabled(const std::string& component,
+                   MessageSeverity severity) const;
+
+    /**
+     * Starts delivering messages on a writer thread. Must not be called
+     * while other threads are logging.
+     */
+    void startWriterThread();
+
+    /**
+     * Delivers the queued messages and stops the writer thread. Must not be
+     * called while other threads are logging.
+     */
+    void stopWriterThread();
+
+    /**
+     * Waits until every message logged so far has been delivered
+     */
+    void flush();
+
     void log(const std::string& component, Logger::MessageSeverity severity,
              const std::string& message);
 
+    /**
+     * Logs the string returned by format, which is only called if the
+     * message isn't filtered out
+     */
+    template <class Format,
+              class = decltype(std::string(std::declval<Format>()()))>
+    void log(const std::string& component, Logger::MessageSeverity severity,
+             Format&& format) {
+        if (isEnabled(component, severity)) {
+            dispatch(LogMessage{component, severity, format()});
+        }
+    }
+
     void verbose(const std::string& component, const std::string& message);
     void info(const std::string& component, const std::string& message);
     void warning(const std::string& component, const std::string& message);
     void error(const std::string& component, const std::string& message);
 
+    template <class Format,
+              class = decltype(std::string(std::declval<Format>()()))>
+    void verbose(const std::string& component, Format&& format) {
+        log(component, Verbose, std::forward<Format>(format));
+    }
+    template <class Format,
+              class = decltype(std::string(std::declval<Format>()()))>
+    void info(const std::string& component, Format&& format) {
+        log(component, Info, std::forward<Format>(format));
+    }
+    template <class Format,
+              class = decltype(std::string(std::declval<Format>()()))>
+    void warning(const std::string& component, Format&& format) {
+        log(component, Warning, std::forward<Format>(format));
+    }
+    template <class Format,
+              class = decltype(std::string(std::declval<Format>()()))>
+    void error(const std::string& component, Format&& format) {
+        log(component, Error, std::forward<Format>(format));
+    }
+
 private:
+    /**
+     * Node of the multi-producer single-consumer message queue
+     */
+    struct QueueNode {
+        std::atomic<QueueNode*> next{nullptr};
+        LogMessage message;
+
+        template <class... Args>
+        QueueNode(Args&&... args) : message(std::forward<Args>(args)...) {
+        }
+    };
+
     std::vector<MessageReceiver*> receivers;
+    std::mutex receiverMutex;
+
+    std::atomic<int> minimumSeverity{Verbose};
+    std::atomic<bool> hasComponentSeverity{false};
+    std::map<std::string, MessageSeverity> componentSeverity;
+    mutable std::mutex severityMutex;
+
+    /// Producers exchange the head, the writer thread pops from the tail
+    std::atomic<QueueNode*> queueHead;
+    QueueNode* queueTail;
+    /// Messages queued but not yet delivered
+    std::atomic<size_t> pending{0};
+
+    std::thread writer;
+    std::atomic<bool> writerRunning{false};
+    std::mutex writerMutex;
+    std::condition_variable writerWake;
+    std::condition_variable writerDrained;
+
+    void dispatch(LogMessage&& message);
+    void deliver(const LogMessage& message);
+
+    /**
+     * Delivers all queued messages
+     * @return The number of messages delivered
+     */
+    size_t drainQueue();
+
+    void writerLoop();
 };
 
 class StdOutReceiver final : public Logger::MessageReceiver {
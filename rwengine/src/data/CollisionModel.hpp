@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 
+#include <rw/memorystats.hpp>
+
 /**
  * @class CollisionModel
  * Collision shapes data container.
@@ -46,6 +48,8 @@ struct CollisionModel {
     std::vector<Box> boxes;
     std::vector<glm::vec3> vertices;
     std::vector<Triangle> faces;
+
+    TrackedMemory<MemoryTag::Collision> memory;
 };
 
 #endif
@@ -1,6 +1,8 @@
 #ifndef _RWENGINE_CUTSCENEDATA_HPP_
 #define _RWENGINE_CUTSCENEDATA_HPP_
 #include <glm/glm.hpp>
+#include <algorithm>
+#include <cstddef>
 #include <map>
 #include <string>
 #include <vector>
@@ -27,108 +29,106 @@ struct CutsceneMetadata {
     std::map<float, TextEntry> texts;
 };
 
+/**
+ * @brief Keyframes of one cutscene track, sorted by time.
+ *
+ * Playback samples the track with a cursor that follows the time forward,
+ * so each sample only looks at the next keyframes.
+ */
+template <class T>
+class CutsceneTrack {
+public:
+    /**
+     * Adds a keyframe, replacing any at the same time
+     */
+    void addKeyframe(float time, const T& value) {
+        auto it = std::lower_bound(times.begin(), times.end(), time);
+        auto index = static_cast<size_t>(it - times.begin());
+        if (it != times.end() && *it == time) {
+            values[index] = value;
+            return;
+        }
+        times.insert(it, time);
+        values.insert(values.begin() + index, value);
+        cursor = 0;
+    }
+
+    bool hasKeyframe(float time) const {
+        return std::binary_search(times.begin(), times.end(), time);
+    }
+
+    size_t size() const {
+        return times.size();
+    }
+
+    bool empty() const {
+        return times.empty();
+    }
+
+    /**
+     * Interpolates between the keyframes around time. Before the first
+     * keyframe this is the last value.
+     */
+    T sample(float time) {
+        if (times.empty()) {
+            return T{};
+        }
+        if (time < times[cursor]) {
+            // Went backwards
+            cursor = 0;
+            if (time < times[0]) {
+                return values.back();
+            }
+        }
+        while (cursor + 1 < times.size() && times[cursor + 1] <= time) {
+            ++cursor;
+        }
+
+        if (cursor + 1 == times.size()) {
+            return values[cursor];
+        }
+        auto& a = values[cursor];
+        auto& b = values[cursor + 1];
+        float tdiff = times[cursor + 1] - times[cursor];
+        if (tdiff > 0.f) {
+            float fac = (time - times[cursor]) / tdiff;
+            return glm::mix(a, b, fac);
+        }
+        return b;
+    }
+
+private:
+    std::vector<float> times;
+    std::vector<T> values;
+    size_t cursor = 0;
+};
+
 /**
  * @brief Stores the Camera animation data from .DAT files
  */
 struct CutsceneTracks {
-    std::map<float, float> zoom;
-    std::map<float, float> rotation;
-    std::map<float, glm::vec3> position;
-    std::map<float, glm::vec3> target;
+    CutsceneTrack<float> zoom;
+    CutsceneTrack<float> rotation;
+    CutsceneTrack<glm::vec3> position;
+    CutsceneTrack<glm::vec3> target;
     /* Rotation is angle around the target vector */
 
     float duration{0.f};
 
     glm::vec3 getPositionAt(float time) {
-        glm::vec3 p = position.rbegin()->second;
-        for (auto it = position.begin(); it != position.end(); ++it) {
-            if (it->first <= time) {
-                auto a = it->second;
-                auto b = it->second;
-                auto nextIt = it;
-                float t = it->first;
-                if (++nextIt != position.end()) {
-                    b = nextIt->second;
-                    t = nextIt->first;
-                }
-                float tdiff = t - it->first;
-                p = b;
-                if (tdiff > 0.f) {
-                    float fac = (time - it->first) / tdiff;
-                    p = glm::mix(a, b, fac);
-                }
-            }
-        }
-        return p;
+        return position.sample(time);
     }
 
     glm::vec3 getTargetAt(float time) {
-        glm::vec3 p = position.rbegin()->second;
-        for (auto it = target.begin(); it != target.end(); ++it) {
-            if (it->first <= time) {
-                auto a = it->second;
-                auto b = it->second;
-                auto nextIt = it;
-                float t = it->first;
-                if (++nextIt != target.end()) {
-                    b = nextIt->second;
-                    t = nextIt->first;
-                }
-                float tdiff = t - it->first;
-                p = b;
-                if (tdiff > 0.f) {
-                    float fac = (time - it->first) / tdiff;
-                    p = glm::mix(a, b, fac);
-                }
-            }
-        }
-        return p;
+        return target.sample(time);
     }
 
     float getZoomAt(float time) {
-        float r = zoom.rbegin()->second;
-        for (auto it = zoom.begin(); it != zoom.end(); ++it) {
-            if (it->first <= time) {
-                auto a = it->second;
-                auto b = it->second;
-                auto nextIt = it;
-                float t = it->first;
-                if (++nextIt != zoom.end()) {
-                    b = nextIt->second;
-                    t = nextIt->first;
-                }
-                float tdiff = t - it->first;
-                r = b;
-                if (tdiff > 0.f) {
-                    float fac = (time - it->first) / tdiff;
-                    r = glm::mix(a, b, fac);
-                }
-            }
-        }
-        return r;
+        return zoom.sample(time);
     }
 
     float getRotationAt(float time) {
-        float r = rotation.rbegin()->second;
-        for (auto it = rotation.begin(); it != rotation.end(); ++it) {
-            if (it->first <= time) {
-                auto a = it->second;
-                auto b = it->second;
-                auto nextIt = it;
-                float t = it->first;
-                if (++nextIt != rotation.end()) {
-                    b = nextIt->second;
-                    t = nextIt->first;
-                }
-                float tdiff = t - it->first;
-                r = b;
-                if (tdiff > 0.f) {
-                    float fac = (time - it->first) / tdiff;
-                    r = glm::mix(a, b, fac);
-                }
-            }
-        }
-        return r;
+        return rotation.sample(time);
     }
 };
 
@@ -1,6 +1,6 @@
 #include "data/ModelData.hpp"
 
-void SimpleModelInfo::setupBigBuilding(const ModelInfoTable& models) {
+void SimpleModelInfo::setupBigBuilding(const RelatedModelTable& models) {
     if (loddistances_[0] > 300.f && atomics_[2] == nullptr) {
         isbigbuilding_ = true;
         findRelatedModel(models);
@@ -12,14 +12,27 @@ void SimpleModelInfo::setupBigBuilding(const ModelInfoTable& models) {
     }
 }
 
-void SimpleModelInfo::findRelatedModel(const ModelInfoTable& models) {
-    for (const auto& model : models) {
-        if (model.second.get() == this) continue;
-        const auto& othername = model.second->name;
-        if (othername.size() <= 3 || name.size() <= 3) continue;
-        if (othername.substr(3) == name.substr(3)) {
-            related_ = static_cast<SimpleModelInfo*>(model.second.get());
+void SimpleModelInfo::findRelatedModel(const RelatedModelTable& models) {
+    if (name.size() <= 3) return;
+    auto range = models.equal_range(name.substr(3));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second != this) {
+            related_ = it->second;
             break;
         }
     }
 }
+
+RelatedModelTable SimpleModelInfo::buildRelatedModelTable(
+    const ModelInfoTable& models) {
+    RelatedModelTable table;
+    table.reserve(models.size());
+    for (const auto& model : models) {
+        if (model.second->type() != ModelDataType::SimpleInfo) continue;
+        const auto& name = model.second->name;
+        if (name.size() <= 3) continue;
+        table.emplace(name.substr(3),
+                      static_cast<SimpleModelInfo*>(model.second.get()));
+    }
+    return table;
+}
@@ -115,6 +115,15 @@ private:
 using ModelInfoTable =
     std::unordered_map<ModelID, std::unique_ptr<BaseModelInfo>>;
 
+class SimpleModelInfo;
+
+/**
+ * Simple models keyed by their name without the three character prefix, used
+ * to link LOD models with their detailed model.
+ */
+using RelatedModelTable =
+    std::unordered_multimap<std::string, SimpleModelInfo*>;
+
 const static std::unordered_set<std::string> doorModels = {
     "oddjgaragdoor",      "bombdoor",           "door_bombshop",
     "vheistlocdoor",      "door2_garage",       "ind_slidedoor",
@@ -200,6 +209,7 @@ public:
 
     void unload() override {
         model_ = nullptr;
+        atomics_.fill(nullptr);
     }
 
     enum {
@@ -232,12 +242,18 @@ public:
     };
 
     // Set up data for big building objects
-    void setupBigBuilding(const ModelInfoTable& models);
+    void setupBigBuilding(const RelatedModelTable& models);
     bool isBigBuilding() const {
         return isbigbuilding_;
     }
 
-    void findRelatedModel(const ModelInfoTable& models);
+    void findRelatedModel(const RelatedModelTable& models);
+
+    /**
+     * Builds the lookup used by setupBigBuilding from all simple models
+     */
+    static RelatedModelTable buildRelatedModelTable(
+        const ModelInfoTable& models);
 
     float getLargestLodDistance() const {
         return furthest_ != 0 ? loddistances_[furthest_ - 1]
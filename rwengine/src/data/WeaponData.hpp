@@ -36,8 +36,6 @@ struct WeaponData {
 
 /**
  * @brief simple object for performing weapon checks against the world
- *
- * @todo RADIUS hitscans
  */
 struct WeaponScan {
     enum ScanType {
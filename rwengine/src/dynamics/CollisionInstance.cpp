@@ -131,6 +131,16 @@ bool CollisionInstance::createPhysicsBody(GameObject* object,
     return true;
 }
 
+void CollisionInstance::removeFromWorld() {
+    auto object = static_cast<GameObject*>(m_body->getUserPointer());
+    object->engine->dynamicsWorld->removeRigidBody(m_body.get());
+}
+
+void CollisionInstance::addToWorld() {
+    auto object = static_cast<GameObject*>(m_body->getUserPointer());
+    object->engine->dynamicsWorld->addRigidBody(m_body.get());
+}
+
 void CollisionInstance::changeMass(float newMass) {
     auto object = static_cast<GameObject*>(m_body->getUserPointer());
     auto& dynamicsWorld = object->engine->dynamicsWorld;
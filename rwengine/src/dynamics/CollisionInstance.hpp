@@ -38,6 +38,16 @@ public:
 
     void changeMass(float newMass);
 
+    /**
+     * Removes the body from the dynamics world without destroying it
+     */
+    void removeFromWorld();
+
+    /**
+     * Adds a body removed by removeFromWorld back to the dynamics world
+     */
+    void addToWorld();
+
 private:
     std::unique_ptr<btRigidBody> m_body;
 
@@ -0,0 +1,134 @@
+#include "dynamics/PhysicsQueries.hpp"
+
+#include <algorithm>
+
+#include <btBulletDynamicsCommon.h>
+
+#include "dynamics/RaycastCallbacks.hpp"
+
+namespace {
+/**
+ * Collects the objects of every broadphase proxy that overlaps a sphere
+ */
+class SphereOverlapCallback final : public btBroadphaseAabbCallback {
+public:
+    SphereOverlapCallback(const glm::vec3& center, float radius,
+                          std::vector<GameObject*>& objects)
+        : center(center), radius2(radius * radius), objects(objects) {
+    }
+
+    bool process(const btBroadphaseProxy* proxy) override {
+        auto body = static_cast<btCollisionObject*>(proxy->m_clientObject);
+        auto object = static_cast<GameObject*>(body->getUserPointer());
+        if (!object) {
+            return true;
+        }
+
+        // Distance from the sphere to the closest point of the bounds
+        glm::vec3 min(proxy->m_aabbMin.x(), proxy->m_aabbMin.y(),
+                      proxy->m_aabbMin.z());
+        glm::vec3 max(proxy->m_aabbMax.x(), proxy->m_aabbMax.y(),
+                      proxy->m_aabbMax.z());
+        auto closest = glm::clamp(center, min, max);
+        auto d = closest - center;
+        if (glm::dot(d, d) > radius2) {
+            return true;
+        }
+
+        // Vehicles have a body for each part
+        if (std::find(objects.begin(), objects.end(), object) ==
+            objects.end()) {
+            objects.push_back(object);
+        }
+        return true;
+    }
+
+private:
+    glm::vec3 center;
+    float radius2;
+    std::vector<GameObject*>& objects;
+};
+}  // namespace
+
+PhysicsQueries::RayResult PhysicsQueries::castRay(
+    const glm::vec3& from, const glm::vec3& to, FilterGroup group,
+    btCollisionObject* ignore) const {
+    btVector3 btFrom(from.x, from.y, from.z);
+    btVector3 btTo(to.x, to.y, to.z);
+
+    ClosestNotMeRayResultCallback cb(ignore, btFrom, btTo);
+    cb.m_collisionFilterGroup = group;
+    world->rayTest(btFrom, btTo, cb);
+
+    RayResult result;
+    if (cb.hasHit()) {
+        const auto& p = cb.m_hitPointWorld;
+        const auto& n = cb.m_hitNormalWorld;
+        result.hit = true;
+        result.position = {p.x(), p.y(), p.z()};
+        result.normal = {n.x(), n.y(), n.z()};
+        result.fraction = cb.m_closestHitFraction;
+        result.object =
+            static_cast<GameObject*>(cb.m_collisionObject->getUserPointer());
+    }
+    return result;
+}
+
+PhysicsQueries::SphereResult PhysicsQueries::overlapSphere(
+    const glm::vec3& center, float radius) const {
+    SphereResult result;
+    SphereOverlapCallback cb(center, radius, result.objects);
+    btVector3 min(center.x - radius, center.y - radius, center.z - radius);
+    btVector3 max(center.x + radius, center.y + radius, center.z + radius);
+    world->getBroadphase()->aabbTest(min, max, cb);
+    return result;
+}
+
+PhysicsQueries::Handle PhysicsQueries::queueRay(const glm::vec3& from,
+                                                const glm::vec3& to,
+                                                FilterGroup group,
+                                                btCollisionObject* ignore) {
+    rays.push_back({from, to, group, ignore});
+    return {batch, static_cast<std::uint32_t>(rays.size() - 1)};
+}
+
+PhysicsQueries::Handle PhysicsQueries::queueSphere(const glm::vec3& center,
+                                                   float radius) {
+    spheres.push_back({center, radius});
+    return {batch, static_cast<std::uint32_t>(spheres.size() - 1)};
+}
+
+void PhysicsQueries::execute() {
+    rayResults.clear();
+    rayResults.reserve(rays.size());
+    for (const auto& ray : rays) {
+        rayResults.push_back(
+            castRay(ray.from, ray.to, ray.group, ray.ignore));
+    }
+
+    sphereResults.clear();
+    sphereResults.reserve(spheres.size());
+    for (const auto& sphere : spheres) {
+        sphereResults.push_back(overlapSphere(sphere.center, sphere.radius));
+    }
+
+    rays.clear();
+    spheres.clear();
+    batch++;
+}
+
+const PhysicsQueries::RayResult* PhysicsQueries::getRayResult(
+    Handle handle) const {
+    if (handle.batch + 1 != batch || handle.index >= rayResults.size()) {
+        return nullptr;
+    }
+    return &rayResults[handle.index];
+}
+
+const PhysicsQueries::SphereResult* PhysicsQueries::getSphereResult(
+    Handle handle) const {
+    if (handle.batch + 1 != batch || handle.index >= sphereResults.size()) {
+        return nullptr;
+    }
+    return &sphereResults[handle.index];
+}
@@ -0,0 +1,118 @@
+#ifndef _RWENGINE_PHYSICSQUERIES_HPP_
+#define _RWENGINE_PHYSICSQUERIES_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+class btCollisionObject;
+class btCollisionWorld;
+class GameObject;
+
+/**
+ * Ray and sphere queries against the collision world.
+ *
+ * Queries can either run immediately or be queued during a tick and run
+ * together by execute(), the results are then looked up with the handle
+ * returned when queueing. Results stay valid until the next execute().
+ *
+ * Batches run on the calling thread: Bullet's broadphase shares one traversal
+ * stack (and profiler) between all ray tests unless it is built thread safe,
+ * so queries can't be spread over worker threads.
+ */
+class PhysicsQueries {
+public:
+    /**
+     * Collision filter group of a ray, same values as btBroadphaseProxy.
+     * Characters only collide with the default group's static world, so
+     * rays need AllFilter to hit them.
+     */
+    enum FilterGroup : short { DefaultFilter = 1, AllFilter = -1 };
+
+    struct Handle {
+        /// Batch the query was queued in, 0 is never a valid batch
+        std::uint32_t batch = 0;
+        std::uint32_t index = 0;
+    };
+
+    struct RayResult {
+        bool hit = false;
+        glm::vec3 position{};
+        glm::vec3 normal{};
+        float fraction = 1.f;
+        /// Object that was hit, nullptr for the world or no hit
+        GameObject* object = nullptr;
+    };
+
+    struct SphereResult {
+        /// Objects with bounds overlapping the sphere, each only once
+        std::vector<GameObject*> objects;
+    };
+
+    explicit PhysicsQueries(btCollisionWorld* world) : world(world) {
+    }
+
+    /**
+     * Finds the closest hit along a ray
+     * @param ignore Collision object to ignore, such as the caster's body
+     */
+    RayResult castRay(const glm::vec3& from, const glm::vec3& to,
+                      FilterGroup group = DefaultFilter,
+                      btCollisionObject* ignore = nullptr) const;
+
+    /**
+     * Finds objects whose broadphase bounds overlap a sphere
+     */
+    SphereResult overlapSphere(const glm::vec3& center, float radius) const;
+
+    Handle queueRay(const glm::vec3& from, const glm::vec3& to,
+                    FilterGroup group = DefaultFilter,
+                    btCollisionObject* ignore = nullptr);
+
+    Handle queueSphere(const glm::vec3& center, float radius);
+
+    /**
+     * Runs all queued queries, replacing the results of the previous batch
+     */
+    void execute();
+
+    /**
+     * @return The result of a ray from the last executed batch, or nullptr
+     * if the handle is from another batch
+     */
+    const RayResult* getRayResult(Handle handle) const;
+
+    const SphereResult* getSphereResult(Handle handle) const;
+
+    size_t getQueuedCount() const {
+        return rays.size() + spheres.size();
+    }
+
+private:
+    struct RayQuery {
+        glm::vec3 from;
+        glm::vec3 to;
+        FilterGroup group;
+        btCollisionObject* ignore;
+    };
+
+    struct SphereQuery {
+        glm::vec3 center;
+        float radius;
+    };
+
+    btCollisionWorld* world;
+
+    /// Batch that queries are currently queued in
+    std::uint32_t batch = 1;
+
+    std::vector<RayQuery> rays;
+    std::vector<SphereQuery> spheres;
+
+    std::vector<RayResult> rayResults;
+    std::vector<SphereResult> sphereResults;
+};
+
+#endif
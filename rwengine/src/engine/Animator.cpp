@@ -52,7 +52,7 @@ void Animator::tick(float dt) {
         }
 
         for (auto& b : state.boneInstances) {
-            if (b.first->frames.empty()) continue;
+            if (b.first->empty()) continue;
             auto kf = b.first->getInterpolatedKeyframe(animTime);
 
             BoneTransform xform;
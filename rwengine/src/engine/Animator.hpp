@@ -63,6 +63,13 @@ public:
         animations[slot] = {anim, 0.f, speed, repeat, {}};
     }
 
+    /**
+     * Stops all animations, the bones keep their current pose
+     */
+    void clearAnimations() {
+        animations.clear();
+    }
+
     void setAnimationSpeed(unsigned int slot, float speed) {
         RW_CHECK(slot < animations.size(), "Slot out of range");
         if (slot < animations.size()) {
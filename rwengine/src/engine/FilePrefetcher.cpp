@@ -0,0 +1,116 @@
+#include "engine/FilePrefetcher.hpp"
+
+#include <exception>
+#include <utility>
+
+#include <platform/FileIndex.hpp>
+
+FilePrefetcher::FilePrefetcher(FileIndex& index) : index(index) {
+}
+
+FilePrefetcher::~FilePrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        quit = true;
+    }
+    wake.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void FilePrefetcher::prefetch(const std::string& name) {
+    auto key = FileIndex::normalizeFilePath(name);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (entries.find(key) != entries.end()) {
+            return;
+        }
+        entries[key] = std::make_shared<Entry>();
+        queue.push_back(key);
+
+        // The thread is only started once something is asked for
+        if (!thread.joinable()) {
+            thread = std::thread(&FilePrefetcher::run, this);
+        }
+    }
+    wake.notify_one();
+}
+
+FileContentsInfo FilePrefetcher::take(const std::string& name) {
+    auto key = FileIndex::normalizeFilePath(name);
+    std::unique_lock<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        return {nullptr, 0};
+    }
+
+    auto entry = it->second;
+    finished.wait(lock, [&] { return entry->done; });
+    entries.erase(key);
+    if (!entry->data) {
+        return {nullptr, 0};
+    }
+
+    hits++;
+    return {std::move(entry->data), entry->length};
+}
+
+bool FilePrefetcher::isPrefetched(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(FileIndex::normalizeFilePath(name));
+    return it != entries.end() && it->second->done;
+}
+
+void FilePrefetcher::wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [&] {
+        for (const auto& entry : entries) {
+            if (!entry.second->done) {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+void FilePrefetcher::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    queue.clear();
+    // A file being read is dropped along with its entry
+    entries.clear();
+}
+
+void FilePrefetcher::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [&] { return quit || !queue.empty(); });
+        if (quit) {
+            break;
+        }
+
+        auto key = queue.front();
+        queue.pop_front();
+        auto it = entries.find(key);
+        if (it == entries.end()) {
+            continue;
+        }
+        auto entry = it->second;
+
+        lock.unlock();
+        auto file = [&]() -> FileContentsInfo {
+            try {
+                return index.openFile(key);
+            } catch (std::exception&) {
+                // The caller reports it when loading it again
+                return {nullptr, 0};
+            }
+        }();
+        lock.lock();
+
+        entry->data = std::move(file.data);
+        entry->length = file.length;
+        entry->done = true;
+        finished.notify_all();
+    }
+}
@@ -0,0 +1,88 @@
+#ifndef _RWENGINE_FILEPREFETCHER_HPP_
+#define _RWENGINE_FILEPREFETCHER_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include <platform/FileHandle.hpp>
+#include <rw/forward.hpp>
+
+class FileIndex;
+
+/**
+ * @brief Reads game files on a worker thread before they're needed.
+ *
+ * Files are read with the FileIndex, including members of IMG archives, and
+ * held until take() is called for them. Only the reading happens in the
+ * background, parsing and uploading stay with the caller.
+ *
+ * The index must not be changed while files are being prefetched.
+ */
+class FilePrefetcher {
+public:
+    explicit FilePrefetcher(FileIndex& index);
+    ~FilePrefetcher();
+
+    FilePrefetcher(const FilePrefetcher&) = delete;
+    FilePrefetcher& operator=(const FilePrefetcher&) = delete;
+
+    /**
+     * Queues a file to be read, does nothing if it's already queued
+     */
+    void prefetch(const std::string& name);
+
+    /**
+     * Gives up a prefetched file, waiting for it if it's still being read
+     * @return Empty contents if the file wasn't prefetched or couldn't be
+     * read
+     */
+    FileContentsInfo take(const std::string& name);
+
+    bool isPrefetched(const std::string& name) const;
+
+    /**
+     * Blocks until every queued file has been read
+     */
+    void wait();
+
+    /**
+     * Drops all files that haven't been taken
+     */
+    void clear();
+
+    /// Number of take() calls served from a prefetched file
+    size_t getHitCount() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return hits;
+    }
+
+private:
+    struct Entry {
+        bool done = false;
+        std::unique_ptr<char[]> data;
+        size_t length = 0;
+    };
+
+    void run();
+
+    FileIndex& index;
+
+    std::thread thread;
+    mutable std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+
+    // Guarded by mutex
+    bool quit = false;
+    std::deque<std::string> queue;
+    std::unordered_map<std::string, std::shared_ptr<Entry>> entries;
+    size_t hits = 0;
+};
+
+#endif
@@ -15,6 +15,7 @@
 #include <data/Clump.hpp>
 #include <rw/casts.hpp>
 #include <rw/debug.hpp>
+#include <rw/memorystats.hpp>
 #include <rw/types.hpp>
 
 #include "core/Logger.hpp"
@@ -30,6 +31,7 @@
 #include "loaders/GenericDATLoader.hpp"
 #include "loaders/LoaderGXT.hpp"
 #include "platform/FileIndex.hpp"
+#include "data/WeaponData.hpp"
 
 GameData::GameData(Logger* log, const rwfs::path& path)
     : datpath(path), logger(log) {
@@ -54,6 +56,12 @@ void GameData::load() {
     auto misc = loadTextureArchive("misc.txd");
     textureslots["generic"].insert(misc.begin(), misc.end());
 
+    // These slots are looked up by name and have to stay resident
+    for (const auto& slot : textureslots) {
+        textureResidency.addSlot(slot.first, slot.second, 0);
+        textureResidency.pin(slot.first);
+    }
+
     loadCarcols("data/carcols.dat");
     loadWeather("data/timecyc.dat");
     loadHandling("data/handling.cfg");
@@ -77,6 +85,19 @@ void GameData::load() {
 
     // Load ped groups after IDEs so they can resolve
     loadPedGroups("data/pedgrp.dat");
+
+    // Weapons and wheels are drawn without an instance of their own
+    for (const auto& weapon : weaponData) {
+        if (weapon->modelID > 0) {
+            modelResidency.pin(weapon->modelID);
+        }
+    }
+    for (const auto& info : modelinfo) {
+        if (info.second->type() == ModelDataType::VehicleInfo) {
+            auto vehicle = static_cast<VehicleModelInfo*>(info.second.get());
+            modelResidency.pin(vehicle->wheelmodel_);
+        }
+    }
 }
 
 void GameData::loadLevelFile(const std::string& path) {
@@ -126,10 +147,11 @@ void GameData::loadLevelFile(const std::string& path) {
         }
     }
 
+    const auto related = SimpleModelInfo::buildRelatedModelTable(modelinfo);
     for (const auto& model : modelinfo) {
         if (model.second->type() == ModelDataType::SimpleInfo) {
             auto simple = static_cast<SimpleModelInfo*>(model.second.get());
-            simple->setupBigBuilding(modelinfo);
+            simple->setupBigBuilding(related);
         }
     }
 }
@@ -168,6 +190,7 @@ AnimGroup* GameData::getAnimGroup(const std::string& group) {
 
 void GameData::loadCOL(const size_t zone, const std::string& name) {
     RW_UNUSED(zone);
+    RW_MEMORY_SCOPE(MemoryTag::Collision);
 
     LoaderCOL col;
 
@@ -290,6 +313,7 @@ void GameData::loadHandling(const std::string& path) {
 }
 
 SCMFile* GameData::loadSCM(const std::string& path) {
+    RW_MEMORY_SCOPE(MemoryTag::Script);
     auto scm_h = index.openFileRaw(path);
     SCMFile* scm = new SCMFile;
     scm->loadFile(scm_h.data.get(), scm_h.length);
@@ -318,6 +342,7 @@ void GameData::loadWaterpro(const std::string& path) {
                    sizeof(char) * 64 * 64);
         ifstr.read(reinterpret_cast<char*>(&realWater),
                    sizeof(char) * 128 * 128);
+        water.setTable(waterHeights, realWater);
     }
 }
 
@@ -348,7 +373,15 @@ void GameData::loadWater(const std::string& path) {
     }
 }
 
-void GameData::loadTXD(const std::string& name) {
+void GameData::loadTXD(const std::string& name, bool pinned) {
+    auto slot = useTextureSlot(name);
+    if (pinned) {
+        textureResidency.pin(slot);
+        evictTextures();
+    }
+}
+
+std::string GameData::useTextureSlot(const std::string& name) {
     auto slot = name;
     auto ext = name.find(".txd");
     if (ext != std::string::npos) {
@@ -361,22 +394,69 @@ void GameData::loadTXD(const std::string& name) {
     // Check if this texture slot is loaded already
     auto slotit = textureslots.find(slot);
     if (slotit != textureslots.end()) {
+        textureResidency.use(slot);
+        return slot;
+    }
+
+    size_t fileBytes = 0;
+    auto& textures = textureslots[slot];
+    textures = loadTextureArchive(name, &fileBytes);
+    textureResidency.addSlot(slot, textures, fileBytes);
+
+    return slot;
+}
+
+void GameData::evictTextures() {
+    for (const auto& slot : textureResidency.evict()) {
+        textureslots.erase(slot);
+        logger->info("Data", "Unloaded texture slot " + slot);
+    }
+}
+
+void GameData::releaseModelTextures(ModelID model) {
+    auto it = modelTextureSlots.find(model);
+    if (it == modelTextureSlots.end()) {
         return;
     }
+    textureResidency.removeReference(it->second);
+    modelTextureSlots.erase(it);
+    evictTextures();
+}
 
-    textureslots[slot] = loadTextureArchive(name);
+FileContentsInfo GameData::openFile(const std::string& name) {
+    auto file = prefetcher.take(name);
+    if (file.data) {
+        return file;
+    }
+    return index.openFile(name);
 }
 
-TextureArchive GameData::loadTextureArchive(const std::string& name) {
+TextureArchive GameData::loadTextureArchive(const std::string& name,
+                                            size_t* fileBytes) {
+    RW_MEMORY_SCOPE(MemoryTag::Textures);
     /// @todo refactor loadTXD to use correct file locations
-    auto file = index.openFile(name);
+    auto file = openFile(name);
     if (!file.data) {
         logger->error("Data", "Failed to open txd: " + name);
         return {};
     }
+    if (fileBytes) {
+        *fileBytes = file.length;
+    }
 
     TextureArchive textures;
 
+    if (textureCache && TextureLoader::isCompressionSupported()) {
+        std::vector<TextureImage> images;
+        if (textureCache->load(name, file, images)) {
+            for (const auto& image : images) {
+                textures[image.name] = TextureLoader::upload(image);
+            }
+            return textures;
+        }
+        logger->error("Data", "Error transcoding txd: " + name);
+    }
+
     TextureLoader l;
     if (!l.loadFromMemory(file, textures)) {
         logger->error("Data", "Error loading txd: " + name);
@@ -395,6 +475,7 @@ void GameData::getNameAndLod(std::string& name, int& lod) {
 }
 
 ClumpPtr GameData::loadClump(const std::string& name) {
+    RW_MEMORY_SCOPE(MemoryTag::Clumps);
     auto file = index.openFile(name);
     if (!file.data) {
         logger->error("Data", "Failed to load model " + name);
@@ -482,9 +563,9 @@ bool GameData::loadModel(ModelID model) {
                    ::tolower);
 
     /// @todo remove this from here
-    loadTXD(slotname + ".txd");
+    auto slot = useTextureSlot(slotname + ".txd");
 
-    auto file = index.openFile(name + ".dff");
+    auto file = openFile(name + ".dff");
     if (!file.data) {
         logger->error("Data", "Failed to load model for " +
                                   std::to_string(model) + " [" + name + "]");
@@ -516,15 +597,72 @@ bool GameData::loadModel(ModelID model) {
         /// @todo how is LOD handled for clump objects?
     }
 
+    // Special models can be reloaded with a different slot
+    auto& heldSlot = modelTextureSlots[model];
+    if (heldSlot != slot) {
+        if (!heldSlot.empty()) {
+            textureResidency.removeReference(heldSlot);
+        }
+        textureResidency.addReference(slot);
+        heldSlot = slot;
+    }
+
+    modelResidency.addModel(model, ModelResidency::estimateBytes(*m));
+    evictModels(model);
+    evictTextures();
+
     return true;
 }
 
+bool GameData::requestModel(ModelID model) {
+    auto it = modelinfo.find(model);
+    if (it == modelinfo.end()) {
+        return false;
+    }
+    if (!it->second->isLoaded()) {
+        return loadModel(model);
+    }
+    modelResidency.use(model);
+    return true;
+}
+
+void GameData::unloadModel(ModelID model) {
+    auto it = modelinfo.find(model);
+    if (it != modelinfo.end()) {
+        it->second->unload();
+    }
+    modelResidency.removeModel(model);
+    releaseModelTextures(model);
+}
+
+void GameData::evictModels(ModelID keep) {
+    for (auto model : modelResidency.evict(modelinfo, keep)) {
+        modelinfo[model]->unload();
+        releaseModelTextures(model);
+        logger->info("Data", "Unloaded model " + std::to_string(model));
+    }
+}
+
 void GameData::loadIFP(const std::string& name) {
-    auto f = index.openFile(name);
+    RW_MEMORY_SCOPE(MemoryTag::Animations);
+    auto f = openFile(name);
 
     if (f.data) {
         LoaderIFP loader;
         if (loader.loadFromMemory(f.data.get())) {
+            size_t keyframes = 0;
+            size_t bytes = 0;
+            for (const auto& animation : loader.animations) {
+                keyframes += animation.second->getKeyframeCount();
+                bytes += animation.second->tracks.getBytes();
+            }
+            std::ostringstream ss;
+            ss << "Loaded " << keyframes << " keyframes from " << name << " in "
+               << bytes / 1024 << " KiB, "
+               << keyframes * sizeof(AnimationKeyframe) / 1024
+               << " KiB unpacked";
+            logger->info("Data", ss.str());
+
             animations.insert(loader.animations.begin(),
                               loader.animations.end());
         }
@@ -700,22 +838,11 @@ void GameData::loadSplash(const std::string& name) {
 }
 
 int GameData::getWaterIndexAt(const glm::vec3& ws) const {
-    auto wX = static_cast<int>((ws.x + WATER_WORLD_SIZE / 2.f) /
-                               (WATER_WORLD_SIZE / WATER_HQ_DATA_SIZE));
-    auto wY = static_cast<int>((ws.y + WATER_WORLD_SIZE / 2.f) /
-                               (WATER_WORLD_SIZE / WATER_HQ_DATA_SIZE));
-
-    if (wX >= 0 && wX < WATER_HQ_DATA_SIZE && wY >= 0 &&
-        wY < WATER_HQ_DATA_SIZE) {
-        int i = (wX * WATER_HQ_DATA_SIZE) + wY;
-        return engine->data->realWater[i];
-    }
-    return 0;
+    return water.getHeightIndex(glm::vec2(ws));
 }
 
 float GameData::getWaveHeightAt(const glm::vec3& ws) const {
-    return (1 + std::sin(engine->getGameTime() + (ws.x + ws.y) * WATER_SCALE)) *
-           WATER_HEIGHT;
+    return WaterQueries::getWaveHeight(glm::vec2(ws), engine->getGameTime());
 }
 
 bool GameData::isValidGameDirectory(const rwfs::path& path) {
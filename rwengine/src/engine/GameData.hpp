@@ -22,12 +22,17 @@
 #include <data/PedData.hpp>
 #include <data/Weather.hpp>
 #include <data/ZoneData.hpp>
+#include <engine/WaterQueries.hpp>
 #include <fonts/GameTexts.hpp>
 #include <loaders/LoaderDFF.hpp>
 #include <loaders/LoaderIMG.hpp>
 #include <loaders/LoaderTXD.hpp>
+#include <loaders/TextureCache.hpp>
 #include <objects/VehicleInfo.hpp>
 #include <gl/TextureData.hpp>
+#include <engine/FilePrefetcher.hpp>
+#include <engine/ModelResidency.hpp>
+#include <engine/TextureResidency.hpp>
 
 class Logger;
 struct WeaponData;
@@ -52,6 +57,26 @@ private:
     Logger* logger;
     LoaderDFF dffLoader;
 
+    /// Texture slot that each loaded model holds a reference to
+    std::unordered_map<ModelID, std::string> modelTextureSlots;
+
+    /**
+     * Loads the slot for a TXD file if needed and makes it current
+     * @return The slot name
+     */
+    std::string useTextureSlot(const std::string& name);
+
+    /**
+     * Unloads unreferenced texture slots that exceed the budget
+     */
+    void evictTextures();
+
+    /**
+     * Unloads models without instances that exceed the budget
+     * @param keep Model that is about to be used
+     */
+    void evictModels(ModelID keep);
+
 public:
     /**
      * ctor
@@ -123,14 +148,24 @@ public:
 
     /**
      * Loads the txt slot if it is not already loaded and sets
-     * the current TXD slot
+     * the current TXD slot.
+     * @param pinned If true the slot is never unloaded, otherwise it can be
+     * unloaded once no model uses it
      */
-    void loadTXD(const std::string& name);
+    void loadTXD(const std::string& name, bool pinned = true);
 
     /**
      * Loads a named texture archive from the game data
+     * @param fileBytes If not null, receives the size of the TXD file
      */
-    TextureArchive loadTextureArchive(const std::string& name);
+    TextureArchive loadTextureArchive(const std::string& name,
+                                      size_t* fileBytes = nullptr);
+
+    /**
+     * Releases the texture slot reference held by a model, call when the
+     * model is unloaded
+     */
+    void releaseModelTextures(ModelID model);
 
     /**
      * Converts combined {name}_l{LOD} into name and lod.
@@ -157,6 +192,16 @@ public:
      */
     bool loadModel(ModelID model);
 
+    /**
+     * Loads the model if it isn't loaded and marks it as recently used
+     */
+    bool requestModel(ModelID model);
+
+    /**
+     * Unloads a model's data and releases its textures
+     */
+    void unloadModel(ModelID model);
+
     /**
      * Loads an IFP file containing animations
      */
@@ -207,6 +252,16 @@ public:
 
     FileIndex index;
 
+    /**
+     * Reads files ahead of loading them, see openFile()
+     */
+    FilePrefetcher prefetcher{index};
+
+    /**
+     * Opens a game file, using the prefetched contents if there are any
+     */
+    FileContentsInfo openFile(const std::string& name);
+
     /**
      * Files that have been loaded previously
      */
@@ -273,6 +328,11 @@ public:
      */
     TextureLoader textureLoader;
 
+    /**
+     * If set, textures are uploaded compressed from this cache
+     */
+    std::unique_ptr<TextureCache> textureCache;
+
     /**
      * Weather Data
      */
@@ -283,6 +343,16 @@ public:
      */
     std::map<std::string, TextureArchive> textureslots;
 
+    /**
+     * Memory use and references of each texture slot
+     */
+    TextureResidency textureResidency;
+
+    /**
+     * Memory use of each loaded model
+     */
+    ModelResidency modelResidency;
+
     /**
      * Texture atlases.
      */
@@ -365,6 +435,11 @@ public:
      */
     uint8_t realWater[128 * 128];
 
+    /**
+     * Queries against the real water, for anything that floats or swims
+     */
+    WaterQueries water;
+
     int getWaterIndexAt(const glm::vec3& ws) const;
     float getWaveHeightAt(const glm::vec3& ws) const;
 
@@ -40,6 +40,27 @@
 // Behaviour Tuning
 constexpr float kMaxTrafficSpawnRadius = 100.f;
 constexpr float kMaxTrafficCleanupRadius = kMaxTrafficSpawnRadius * 1.25f;
+// Dormant traffic objects kept for each model
+constexpr size_t kMaxDormantPerModel = 4;
+
+namespace {
+/**
+ * Takes a dormant object that uses the current model, objects left with an
+ * outdated model are deleted
+ */
+template <class T>
+T* takeDormantObject(std::vector<T*>& dormant, const ClumpPtr& model) {
+    while (!dormant.empty()) {
+        auto object = dormant.back();
+        dormant.pop_back();
+        if (object->getModel() == model) {
+            return object;
+        }
+        delete object;
+    }
+    return nullptr;
+}
+}  // namespace
 
 class WorldCollisionDispatcher : public btCollisionDispatcher {
 public:
@@ -65,6 +86,7 @@ GameWorld::GameWorld(Logger* log, GameData* dat)
     dynamicsWorld = std::make_unique<btDiscreteDynamicsWorld>(
         collisionDispatcher.get(), broadphase.get(), solver.get(),
         collisionConfig.get());
+    physicsQueries = std::make_unique<PhysicsQueries>(dynamicsWorld.get());
 
     dynamicsWorld->setGravity(btVector3(0.f, 0.f, -9.81f));
     _overlappingPairCallback = std::make_unique<btGhostPairCallback>();
@@ -78,6 +100,16 @@ GameWorld::~GameWorld() {
     for (auto& p : allObjects) {
         delete p;
     }
+    for (auto& model : dormantVehicles) {
+        for (auto vehicle : model.second) {
+            delete vehicle;
+        }
+    }
+    for (auto& model : dormantPedestrians) {
+        for (auto ped : model.second) {
+            delete ped;
+        }
+    }
 }
 
 bool GameWorld::placeItems(const std::string& name) {
@@ -109,9 +141,7 @@ InstanceObject* GameWorld::createInstance(const uint16_t id,
     if (oi) {
         // Request loading of the model if it isn't loaded already.
         /// @todo implment streaming properly
-        if (!oi->isLoaded()) {
-            data->loadModel(oi->id());
-        }
+        data->requestModel(oi->id());
 
         // Check for dynamic data.
         auto dyit = data->dynamicObjectData.find(oi->name);
@@ -132,6 +162,7 @@ InstanceObject* GameWorld::createInstance(const uint16_t id,
         allObjects.push_back(instance);
 
         modelInstances.insert({oi->name, instance});
+        instanceGrid.insert(instance);
 
         return instance;
     }
@@ -141,37 +172,83 @@ InstanceObject* GameWorld::createInstance(const uint16_t id,
 
 void GameWorld::createTraffic(const ViewCamera& viewCamera) {
     TrafficDirector director(&aigraph, this);
+    director.setDensity(AIGraphNode::Pedestrian, trafficDensity);
+    director.setDensity(AIGraphNode::Vehicle, trafficDensity);
 
     director.populateNearby(viewCamera, kMaxTrafficSpawnRadius, 5);
 }
 
 void GameWorld::cleanupTraffic(const ViewCamera& focus) {
-    for (auto& p : pedestrianPool.objects) {
-        if (p.second->getLifetime() != GameObject::TrafficLifetime) {
-            continue;
-        }
+    std::vector<GameObject*> despawned;
+    auto despawnOutOfRange = [&](const ObjectPool& pool) {
+        for (auto& p : pool.objects) {
+            if (p.second->getLifetime() != GameObject::TrafficLifetime) {
+                continue;
+            }
 
-        if (glm::distance(focus.position, p.second->getPosition()) >=
-            kMaxTrafficCleanupRadius) {
-            if (!focus.frustum.intersects(p.second->getPosition(), 1.f)) {
-                destroyObjectQueued(p.second);
+            if (glm::distance(focus.position, p.second->getPosition()) >=
+                kMaxTrafficCleanupRadius) {
+                if (!focus.frustum.intersects(p.second->getPosition(), 1.f)) {
+                    despawned.push_back(p.second);
+                }
             }
         }
+    };
+    despawnOutOfRange(pedestrianPool);
+    despawnOutOfRange(vehiclePool);
+
+    for (auto object : despawned) {
+        recycleObject(object);
     }
-    for (auto& p : vehiclePool.objects) {
-        if (p.second->getLifetime() != GameObject::TrafficLifetime) {
-            continue;
-        }
 
-        if (glm::distance(focus.position, p.second->getPosition()) >=
-            kMaxTrafficCleanupRadius) {
-            if (!focus.frustum.intersects(p.second->getPosition(), 1.f)) {
-                destroyObjectQueued(p.second);
-            }
+    destroyQueuedObjects();
+}
+
+void GameWorld::recycleObject(GameObject* object) {
+    // Objects that are about to be deleted can't be kept
+    if (deletionQueue.find(object) != deletionQueue.end()) {
+        return;
+    }
+
+    auto modelID = object->getModelInfo<BaseModelInfo>()->id();
+    if (object->type() == GameObject::Vehicle) {
+        auto vehicle = static_cast<VehicleObject*>(object);
+        auto& dormant = dormantVehicles[modelID];
+        if (!vehicle->isWrecked() && dormant.size() < kMaxDormantPerModel) {
+            unlinkObject(vehicle);
+            vehicle->makeDormant();
+            dormant.push_back(vehicle);
+            return;
+        }
+    } else if (object->type() == GameObject::Character) {
+        auto ped = static_cast<CharacterObject*>(object);
+        auto& dormant = dormantPedestrians[modelID];
+        if (ped->isAlive() && !ped->isPlayer() &&
+            dormant.size() < kMaxDormantPerModel) {
+            unlinkObject(ped);
+            ped->makeDormant();
+            dormant.push_back(ped);
+            return;
         }
     }
 
-    destroyQueuedObjects();
+    destroyObject(object);
+}
+
+size_t GameWorld::getDormantVehicleCount() const {
+    size_t count = 0;
+    for (const auto& model : dormantVehicles) {
+        count += model.second.size();
+    }
+    return count;
+}
+
+size_t GameWorld::getDormantPedestrianCount() const {
+    size_t count = 0;
+    for (const auto& model : dormantPedestrians) {
+        count += model.second.size();
+    }
+    return count;
 }
 
 CutsceneObject* GameWorld::createCutsceneObject(const uint16_t id,
@@ -185,9 +262,7 @@ CutsceneObject* GameWorld::createCutsceneObject(const uint16_t id,
 
     auto clumpmodel = static_cast<ClumpModelInfo*>(modelinfo);
 
-    if (!clumpmodel->isLoaded()) {
-        data->loadModel(id);
-    }
+    data->requestModel(id);
     auto model = clumpmodel->getModel();
 
     if (id == 0) {
@@ -212,12 +287,7 @@ VehicleObject* GameWorld::createVehicle(const uint16_t id, const glm::vec3& pos,
     if (!vti) {
         return nullptr;
     }
-    logger->info("World", "Creating Vehicle ID " + std::to_string(id) + " (" +
-                              vti->vehiclename_ + ")");
-
-    if (!vti->isLoaded()) {
-        data->loadModel(id);
-    }
+    data->requestModel(id);
 
     glm::u8vec3 prim(255), sec(128);
     auto palit = data->vehiclePalettes.find(
@@ -231,6 +301,20 @@ VehicleObject* GameWorld::createVehicle(const uint16_t id, const glm::vec3& pos,
         logger->warning("World", "No colour palette for vehicle " + vti->name);
     }
 
+    auto dormant = takeDormantObject(dormantVehicles[id], vti->getModel());
+    if (dormant) {
+        dormant->respawn(pos, rot, prim, sec);
+        dormant->setGameObjectID(gid);
+        vehiclePool.insert(dormant);
+        allObjects.push_back(dormant);
+        return dormant;
+    }
+
+    logger->info("World", [&] {
+        return "Creating Vehicle ID " + std::to_string(id) + " (" +
+               vti->vehiclename_ + ")";
+    });
+
     auto addSeats = [](std::vector<SeatInfo>& seats, glm::vec3&& offset) {
         // Left seat
         offset.x = -offset.x;
@@ -299,8 +383,19 @@ CharacterObject* GameWorld::createPedestrian(const uint16_t id,
     }
 
     auto isSpecial = pt->name.compare(0, 7, "special") == 0;
-    if (!pt->isLoaded() || isSpecial) {
+    if (isSpecial) {
         data->loadModel(id);
+    } else {
+        data->requestModel(id);
+    }
+
+    auto dormant = takeDormantObject(dormantPedestrians[id], pt->getModel());
+    if (dormant) {
+        dormant->respawn(pos, rot);
+        dormant->setGameObjectID(gid);
+        pedestrianPool.insert(dormant);
+        allObjects.push_back(dormant);
+        return dormant;
     }
 
     auto controller = new DefaultAIController();
@@ -348,9 +443,7 @@ PickupObject* GameWorld::createPickup(const glm::vec3& pos, int id, int type) {
         return nullptr;
     }
 
-    if (!modelInfo->isLoaded()) {
-        data->loadModel(id);
-    }
+    data->requestModel(id);
 
     PickupObject* pickup = nullptr;
     auto pickuptype = static_cast<PickupObject::PickupType>(type);
@@ -467,9 +560,18 @@ GameObject* GameWorld::getBlipTarget(const BlipData& blip) const {
 }
 
 void GameWorld::destroyObject(GameObject* object) {
+    unlinkObject(object);
+    delete object;
+}
+
+void GameWorld::unlinkObject(GameObject* object) {
     auto& pool = getTypeObjectPool(object);
     pool.remove(object);
 
+    if (object->type() == GameObject::Instance) {
+        instanceGrid.remove(static_cast<InstanceObject*>(object));
+    }
+
     // Remove from mission objects
     if (state) {
         auto& mO = state->missionObjects;
@@ -481,8 +583,6 @@ void GameWorld::destroyObject(GameObject* object) {
     if (it != allObjects.end()) {
         allObjects.erase(it);
     }
-
-    delete object;
 }
 
 void GameWorld::destroyObjectQueued(GameObject* object) {
@@ -497,6 +597,12 @@ void GameWorld::destroyQueuedObjects() {
     }
 }
 
+void GameWorld::updateLastTransforms() {
+    for (auto& object : allObjects) {
+        object->_updateLastTransform();
+    }
+}
+
 LightFX& GameWorld::createLightEffect() {
     auto effect = std::make_unique<LightFX>();
     auto& ref = *effect;
@@ -529,32 +635,83 @@ void GameWorld::destroyEffect(VisualFX& effect) {
 }
 
 void GameWorld::doWeaponScan(const WeaponScan& scan) {
-    RW_CHECK(scan.type != WeaponScan::RADIUS,
-             "Radius scans not implemented yet");
-
     if (scan.type == WeaponScan::RADIUS) {
-        // TODO
-        // Requires custom ConvexResultCallback
+        auto result = physicsQueries->overlapSphere(scan.center, scan.radius);
+        applyWeaponScan(scan, nullptr, &result);
     } else if (scan.type == WeaponScan::HITSCAN) {
-        btVector3 from(scan.center.x, scan.center.y, scan.center.z),
-            to(scan.end.x, scan.end.y, scan.end.z);
-        glm::vec3 hitEnd = scan.end;
-        btCollisionWorld::ClosestRayResultCallback cb(from, to);
-        cb.m_collisionFilterGroup = btBroadphaseProxy::AllFilter;
-        dynamicsWorld->rayTest(from, to, cb);
-        // TODO: did any weapons penetrate?
+        auto result = physicsQueries->castRay(scan.center, scan.end,
+                                              PhysicsQueries::AllFilter);
+        applyWeaponScan(scan, &result, nullptr);
+    }
+}
+
+void GameWorld::queueWeaponScan(const WeaponScan& scan) {
+    auto query = scan.type == WeaponScan::RADIUS
+                     ? physicsQueries->queueSphere(scan.center, scan.radius)
+                     : physicsQueries->queueRay(scan.center, scan.end,
+                                                PhysicsQueries::AllFilter);
+    queuedWeaponScans.push_back({scan, query});
+}
+
+void GameWorld::processPhysicsQueries() {
+    physicsQueries->execute();
+
+    for (const auto& queued : queuedWeaponScans) {
+        applyWeaponScan(queued.scan,
+                        physicsQueries->getRayResult(queued.query),
+                        physicsQueries->getSphereResult(queued.query));
+    }
+    queuedWeaponScans.clear();
+}
+
+void GameWorld::applyWeaponScan(const WeaponScan& scan,
+                                const PhysicsQueries::RayResult* ray,
+                                const PhysicsQueries::SphereResult* sphere) {
+    if (scan.type == WeaponScan::RADIUS && sphere) {
+        for (auto object : sphere->objects) {
+            switch (object->type()) {
+                case GameObject::Instance:
+                case GameObject::Vehicle:
+                case GameObject::Character:
+                    break;
+                default:
+                    continue;
+            }
 
-        if (cb.hasHit()) {
-            GameObject* go = static_cast<GameObject*>(
-                cb.m_collisionObject->getUserPointer());
+            // Bounds can reach the sphere from far away, only hit objects
+            // whose origin is inside it
+            float d = glm::distance(scan.center, object->getPosition());
+            if (d > scan.radius) {
+                continue;
+            }
+
+            // Damage falls off with the distance to the center
+            GameObject::DamageInfo di;
+            di.damageLocation = object->getPosition();
+            di.damageSource = scan.center;
+            di.type = GameObject::DamageInfo::Explosion;
+            di.hitpoints = scan.damage / glm::max(d, 1.f);
+            di.impulse = 0.f;
+            object->takeDamage(di);
+
+            // Passengers have no body of their own for the query to find
+            if (object->type() == GameObject::Vehicle) {
+                auto vehicle = static_cast<VehicleObject*>(object);
+                for (const auto& seat : vehicle->seatOccupants) {
+                    seat.second->takeDamage(di);
+                }
+            }
+        }
+    } else if (scan.type == WeaponScan::HITSCAN && ray) {
+        // TODO: did any weapons penetrate?
+        if (ray->hit && ray->object) {
             GameObject::DamageInfo di;
-            hitEnd = di.damageLocation =
-                glm::vec3(cb.m_hitPointWorld.x(), cb.m_hitPointWorld.y(),
-                          cb.m_hitPointWorld.z());
+            di.damageLocation = ray->position;
             di.damageSource = scan.center;
             di.type = GameObject::DamageInfo::Bullet;
             di.hitpoints = scan.damage;
-            go->takeDamage(di);
+            di.impulse = 0.f;
+            ray->object->takeDamage(di);
         }
     }
 }
@@ -588,19 +745,32 @@ void GameWorld::offsetGameTime(int minutes) {
 }
 
 glm::vec3 GameWorld::getGroundAtPosition(const glm::vec3& pos) const {
-    btVector3 rayFrom(pos.x, pos.y, 100.f);
-    btVector3 rayTo(pos.x, pos.y, -100.f);
-
-    btDynamicsWorld::ClosestRayResultCallback rr(rayFrom, rayTo);
+    float height;
+    if (groundMap.getGroundHeight({pos.x, pos.y, 100.f}, height)) {
+        return {pos.x, pos.y, height};
+    }
 
-    dynamicsWorld->rayTest(rayFrom, rayTo, rr);
+    auto result = physicsQueries->castRay({pos.x, pos.y, 100.f},
+                                          {pos.x, pos.y, -100.f});
+    return result.hit ? result.position : pos;
+}
 
-    if (rr.hasHit()) {
-        auto& ws = rr.m_hitPointWorld;
-        return {ws.x(), ws.y(), ws.z()};
+void GameWorld::buildGroundMap() {
+    groundMap.clear();
+    for (auto& p : instancePool.objects) {
+        auto instance = static_cast<InstanceObject*>(p.second);
+        // Objects with dynamics can be knocked over or moved
+        if (instance->dynamics) {
+            continue;
+        }
+        auto modelinfo = instance->getModelInfo<BaseModelInfo>();
+        auto collision = modelinfo ? modelinfo->getCollision() : nullptr;
+        if (!collision) {
+            continue;
+        }
+        groundMap.addCollision(*collision, instance->getPosition(),
+                               instance->getRotation());
     }
-
-    return pos;
 }
 
 float GameWorld::getGameTime() const {
@@ -691,6 +861,19 @@ void GameWorld::PhysicsTickCallback(btDynamicsWorld* physWorld,
                                     btScalar timeStep) {
     GameWorld* world = static_cast<GameWorld*>(physWorld->getWorldUserInfo());
 
+    // Everything that floats or swims is checked against the water at once
+    auto& water = world->data->water;
+    for (auto& p : world->vehiclePool.objects) {
+        static_cast<VehicleObject*>(p.second)->queueWater(water);
+    }
+    for (auto& p : world->pedestrianPool.objects) {
+        static_cast<CharacterObject*>(p.second)->queueWater(water);
+    }
+    for (auto& p : world->instancePool.objects) {
+        static_cast<InstanceObject*>(p.second)->queueWater(water);
+    }
+    water.execute(world->getGameTime());
+
     for (auto& p : world->vehiclePool.objects) {
         VehicleObject* object = static_cast<VehicleObject*>(p.second);
         object->tickPhysics(timeStep);
@@ -707,8 +890,13 @@ void GameWorld::PhysicsTickCallback(btDynamicsWorld* physWorld,
     }
 }
 
+void GameWorld::prefetchCutscene(const std::string& name) {
+    data->prefetcher.prefetch(name + ".dat");
+    data->prefetcher.prefetch(name + ".ifp");
+}
+
 void GameWorld::loadCutscene(const std::string& name) {
-    auto datfile = data->index.openFile(name + ".dat");
+    auto datfile = data->openFile(name + ".dat");
 
     CutsceneData* cutscene = new CutsceneData;
 
@@ -759,6 +947,7 @@ void GameWorld::clearCutscene() {
     delete state->currentCutscene;
     state->currentCutscene = nullptr;
     state->isCinematic = false;
+    data->prefetcher.clear();
     state->cutsceneStartTime = -1.f;
 }
 
@@ -781,12 +970,16 @@ void GameWorld::loadSpecialCharacter(const unsigned short index,
     auto modelid = kFirstSpecialActor + index - 1;
     auto model = data->findModelInfo<PedModelInfo>(modelid);
     if (model && model->isLoaded()) {
-        model->unload();
+        data->unloadModel(modelid);
     }
     std::string lowerName(name);
     std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(),
                    ::tolower);
     state->specialCharacters[index] = lowerName;
+
+    // Read while the script sets up the rest of the cutscene
+    data->prefetcher.prefetch(lowerName + ".dff");
+    data->prefetcher.prefetch(lowerName + ".txd");
 }
 
 void GameWorld::loadSpecialModel(const unsigned short index,
@@ -796,12 +989,15 @@ void GameWorld::loadSpecialModel(const unsigned short index,
     // Tell the HIER model to discard the currently loaded model
     auto model = data->findModelInfo<ClumpModelInfo>(index);
     if (model && model->isLoaded()) {
-        model->unload();
+        data->unloadModel(index);
     }
     std::string lowerName(name);
     std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(),
                    ::tolower);
     state->specialModels[index] = lowerName;
+
+    data->prefetcher.prefetch(lowerName + ".dff");
+    data->prefetcher.prefetch(lowerName + ".txd");
 }
 
 void GameWorld::disableAIPaths(AIGraphNode::NodeType type, const glm::vec3& min,
@@ -1,12 +1,14 @@
 #ifndef _RWENGINE_GAMEWORLD_HPP_
 #define _RWENGINE_GAMEWORLD_HPP_
 
+#include <algorithm>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <random>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <LinearMath/btScalar.h>
@@ -18,12 +20,17 @@
 #include <audio/SoundManager.hpp>
 
 #include <engine/Garage.hpp>
+#include <engine/GroundHeightMap.hpp>
+#include <engine/InstanceGrid.hpp>
 #include <engine/Payphone.hpp>
 #include <objects/ObjectTypes.hpp>
 
 #include <render/VisualFX.hpp>
 
 #include <data/Chase.hpp>
+#include <data/ModelData.hpp>
+#include <data/WeaponData.hpp>
+#include <dynamics/PhysicsQueries.hpp>
 
 class btCollisionDispatcher;
 class btDefaultCollisionConfiguration;
@@ -53,7 +60,6 @@ class PickupObject;
 class ViewCamera;
 
 struct BlipData;
-struct WeaponScan;
 struct VehicleGenerator;
 
 /**
@@ -96,6 +102,11 @@ public:
      */
     void createTraffic(const ViewCamera& viewCamera);
 
+    /**
+     * Scales how closely createTraffic packs peds and vehicles
+     */
+    float trafficDensity = 1.f;
+
     /**
      * @brief cleanupTraffic Cleans up traffic too far away from the given
      * camera
@@ -173,11 +184,38 @@ public:
      */
     void destroyQueuedObjects();
 
+    /**
+     * Records where every object is at the start of a tick. Called before
+     * the physics step, as that moves the rigid bodies.
+     */
+    void updateLastTransforms();
+
+    /**
+     * Keeps a traffic object that left the traffic radius so createVehicle
+     * or createPedestrian can reuse it, or destroys it if it can't be
+     * reused.
+     */
+    void recycleObject(GameObject* object);
+
+    size_t getDormantVehicleCount() const;
+    size_t getDormantPedestrianCount() const;
+
     /**
      * Performs a weapon scan against things in the world
      */
     void doWeaponScan(const WeaponScan& scan);
 
+    /**
+     * Queues a weapon scan to be performed with the other physics queries
+     * of this tick, in processPhysicsQueries()
+     */
+    void queueWeaponScan(const WeaponScan& scan);
+
+    /**
+     * Executes the queued physics queries and applies queued weapon scans
+     */
+    void processPhysicsQueries();
+
     /**
      * Allocates a new Light Effect
      */
@@ -217,8 +255,18 @@ public:
     //! Check if the weather conditions are rainy
     bool isRaining() const;
 
+    /**
+     * Finds the highest ground below 100 units at the given x and y, using
+     * groundMap where it is known and a physics ray otherwise.
+     * @return pos if there is no ground
+     */
     glm::vec3 getGroundAtPosition(const glm::vec3& pos) const;
 
+    /**
+     * Rebuilds groundMap from the collision of the static instances
+     */
+    void buildGroundMap();
+
     float getGameTime() const;
 
     /**
@@ -297,6 +345,35 @@ public:
      */
     std::map<std::string, InstanceObject*> modelInstances;
 
+    /**
+     * Every instance, by position on the ground plane
+     */
+    InstanceGrid instanceGrid;
+
+    /**
+     * Finds instances inside a box on the ground plane
+     * @param predicate Called with each InstanceObject* in the box
+     * @return Matching instances sorted by object ID, the order in which
+     * instancePool iterates them
+     */
+    template <class Predicate>
+    std::vector<InstanceObject*> findInstances(const glm::vec2& min,
+                                               const glm::vec2& max,
+                                               Predicate predicate) const {
+        auto found = instanceGrid.query(min, max);
+        found.erase(std::remove_if(found.begin(), found.end(),
+                                   [&](InstanceObject* instance) {
+                                       return !predicate(instance);
+                                   }),
+                    found.end());
+        return found;
+    }
+
+    /**
+     * Heights of the static collision world
+     */
+    GroundHeightMap groundMap;
+
     /**
      * AI Graph
      */
@@ -322,6 +399,11 @@ public:
     std::unique_ptr<btSequentialImpulseConstraintSolver> solver;
     std::unique_ptr<btDiscreteDynamicsWorld> dynamicsWorld;
 
+    /**
+     * Ray and sphere queries against dynamicsWorld
+     */
+    std::unique_ptr<PhysicsQueries> physicsQueries;
+
     /**
      * @brief physicsNearCallback
      * Used to implement uprooting and other physics oddities.
@@ -337,6 +419,15 @@ public:
     static void PhysicsTickCallback(btDynamicsWorld* physWorld,
                                     btScalar timeStep);
 
+    /**
+     * @brief Starts reading the named cutscene's files in the background,
+     * so loadCutscene() doesn't wait on them. load_cutscene_data calls this
+     * before loading, so the IFP is read while the DAT is parsed.
+     *
+     * Special characters and models are prefetched when they're requested.
+     */
+    void prefetchCutscene(const std::string& name);
+
     /**
      * @brief Loads and starts the named cutscene.
      * @param name
@@ -395,6 +486,33 @@ private:
      */
     std::set<GameObject*> deletionQueue;
 
+    /**
+     * Recycled traffic objects by model. They are outside of the object
+     * pools and the dynamics world, but keep their clump and physics.
+     */
+    std::unordered_map<ModelID, std::vector<VehicleObject*>> dormantVehicles;
+    std::unordered_map<ModelID, std::vector<CharacterObject*>>
+        dormantPedestrians;
+
+    /**
+     * Removes an object from the pools without deleting it
+     */
+    void unlinkObject(GameObject* object);
+
+    struct QueuedWeaponScan {
+        WeaponScan scan;
+        PhysicsQueries::Handle query;
+    };
+
+    std::vector<QueuedWeaponScan> queuedWeaponScans;
+
+    /**
+     * Damages the objects found by a weapon scan
+     */
+    void applyWeaponScan(const WeaponScan& scan,
+                         const PhysicsQueries::RayResult* ray,
+                         const PhysicsQueries::SphereResult* sphere);
+
     std::vector<AreaIndicatorInfo> areaIndicators;
 
     /**
@@ -8,6 +8,7 @@
 #include "ai/PlayerController.hpp"
 
 #include "engine/GameState.hpp"
+#include "engine/GameWorld.hpp"
 
 #include "objects/CharacterObject.hpp"
 #include "objects/GameObject.hpp"
@@ -30,18 +31,14 @@ Garage::Garage(GameWorld* engine_, const int id_, const glm::vec3 coord0,
     midpoint.y = (min.y + max.y) / 2;
 
     // Find door objects for this garage
-    for (const auto p : engine->instancePool.objects) {
-        const auto inst = static_cast<InstanceObject*>(p.second);
-
-        if (!inst->getModel()) {
-            continue;
-        }
-
-        if (!SimpleModelInfo::isDoorModel(
-                inst->getModelInfo<BaseModelInfo>()->name)) {
-            continue;
-        }
-
+    const auto doors = engine->findInstances(
+        midpoint - glm::vec2(20.f), midpoint + glm::vec2(20.f),
+        [](InstanceObject* inst) {
+            return inst->getModel() &&
+                   SimpleModelInfo::isDoorModel(
+                       inst->getModelInfo<BaseModelInfo>()->name);
+        });
+    for (const auto inst : doors) {
         const auto instPos = inst->getPosition();
         const auto xDist = std::abs(instPos.x - midpoint.x);
         const auto yDist = std::abs(instPos.y - midpoint.y);
@@ -0,0 +1,190 @@
+#include "engine/GroundHeightMap.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "data/CollisionModel.hpp"
+
+namespace {
+/// Height units per metre
+constexpr float kHeightScale = 8.f;
+/// Heights closer than this are merged into one level
+constexpr float kLevelMergeHeight = 0.5f;
+/// Triangles steeper than this are walls, not ground
+constexpr float kMinNormalZ = 0.3f;
+/// Neighbouring samples further apart than this aren't interpolated
+constexpr float kMaxBlendHeight = 2.f;
+
+int floorDiv(int a, int b) {
+    return (a >= 0 ? a : a - b + 1) / b;
+}
+
+std::uint32_t tileKey(int x, int y) {
+    return static_cast<std::uint32_t>(static_cast<std::uint16_t>(x)) << 16 |
+           static_cast<std::uint16_t>(y);
+}
+}  // namespace
+
+void GroundHeightMap::addCollision(const CollisionModel& collision,
+                                   const glm::vec3& position,
+                                   const glm::quat& rotation) {
+    auto toWorld = [&](const glm::vec3& v) { return position + rotation * v; };
+
+    std::vector<glm::vec3> vertices;
+    vertices.reserve(collision.vertices.size());
+    for (const auto& v : collision.vertices) {
+        vertices.push_back(toWorld(v));
+    }
+
+    for (const auto& face : collision.faces) {
+        if (face.tri[0] >= vertices.size() || face.tri[1] >= vertices.size() ||
+            face.tri[2] >= vertices.size()) {
+            continue;
+        }
+        addTriangle(vertices[face.tri[0]], vertices[face.tri[1]],
+                    vertices[face.tri[2]]);
+    }
+
+    for (const auto& box : collision.boxes) {
+        auto a = toWorld({box.min.x, box.min.y, box.max.z});
+        auto b = toWorld({box.max.x, box.min.y, box.max.z});
+        auto c = toWorld({box.max.x, box.max.y, box.max.z});
+        auto d = toWorld({box.min.x, box.max.y, box.max.z});
+        addTriangle(a, b, c);
+        addTriangle(a, c, d);
+    }
+}
+
+void GroundHeightMap::addTriangle(const glm::vec3& a, const glm::vec3& b,
+                                  const glm::vec3& c) {
+    auto normal = glm::cross(b - a, c - a);
+    auto length = glm::length(normal);
+    if (length <= 0.f || normal.z / length < kMinNormalZ) {
+        return;
+    }
+
+    auto min = glm::min(a, glm::min(b, c));
+    auto max = glm::max(a, glm::max(b, c));
+    int x0 = static_cast<int>(std::ceil(min.x / kCellSize));
+    int x1 = static_cast<int>(std::floor(max.x / kCellSize));
+    int y0 = static_cast<int>(std::ceil(min.y / kCellSize));
+    int y1 = static_cast<int>(std::floor(max.y / kCellSize));
+
+    // Barycentric coordinates in the XY plane
+    glm::vec2 v0(b - a), v1(c - a);
+    float denom = v0.x * v1.y - v1.x * v0.y;
+    if (std::abs(denom) <= std::numeric_limits<float>::epsilon()) {
+        return;
+    }
+
+    constexpr float kEpsilon = 1e-4f;
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            glm::vec2 p(x * kCellSize - a.x, y * kCellSize - a.y);
+            float u = (p.x * v1.y - v1.x * p.y) / denom;
+            float v = (v0.x * p.y - p.x * v0.y) / denom;
+            if (u < -kEpsilon || v < -kEpsilon || u + v > 1.f + kEpsilon) {
+                continue;
+            }
+            addHeight(x, y, a.z + u * (b.z - a.z) + v * (c.z - a.z));
+        }
+    }
+}
+
+void GroundHeightMap::addHeight(int x, int y, float height) {
+    auto tx = floorDiv(x, kTileSamples);
+    auto ty = floorDiv(y, kTileSamples);
+    auto& tile = tiles[tileKey(tx, ty)];
+    if (!tile) {
+        tile = std::make_unique<Tile>();
+    }
+
+    auto& sample = (*tile)[(y - ty * kTileSamples) * kTileSamples +
+                           (x - tx * kTileSamples)];
+    auto value = static_cast<std::int16_t>(
+        glm::clamp(std::round(height * kHeightScale),
+                   float(std::numeric_limits<std::int16_t>::min()),
+                   float(std::numeric_limits<std::int16_t>::max())));
+
+    auto levels = sample.levels;
+    auto end = levels + sample.count;
+    auto merge = static_cast<std::int16_t>(kLevelMergeHeight * kHeightScale);
+    for (auto it = levels; it != end; ++it) {
+        if (std::abs(*it - value) <= merge) {
+            *it = std::max(*it, value);
+            return;
+        }
+    }
+
+    // Keep the levels sorted highest first, dropping the lowest when full
+    auto pos = std::find_if(levels, end,
+                            [&](std::int16_t level) { return level < value; });
+    if (sample.count == kMaxLevels) {
+        if (pos == end) {
+            return;
+        }
+        --end;
+    } else {
+        sample.count++;
+    }
+    std::move_backward(pos, end, end + 1);
+    *pos = value;
+}
+
+const GroundHeightMap::Sample* GroundHeightMap::getSample(int x,
+                                                          int y) const {
+    auto tx = floorDiv(x, kTileSamples);
+    auto ty = floorDiv(y, kTileSamples);
+    auto it = tiles.find(tileKey(tx, ty));
+    if (it == tiles.end()) {
+        return nullptr;
+    }
+    return &(*it->second)[(y - ty * kTileSamples) * kTileSamples +
+                          (x - tx * kTileSamples)];
+}
+
+bool GroundHeightMap::getLevel(const Sample* sample, float maxHeight,
+                               float& height) {
+    if (!sample) {
+        return false;
+    }
+    for (auto i = 0; i < sample->count; ++i) {
+        float level = sample->levels[i] / kHeightScale;
+        if (level <= maxHeight) {
+            height = level;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GroundHeightMap::getGroundHeight(const glm::vec3& position,
+                                      float& height) const {
+    float fx = position.x / kCellSize;
+    float fy = position.y / kCellSize;
+    int x = static_cast<int>(std::floor(fx));
+    int y = static_cast<int>(std::floor(fy));
+    float tx = fx - x;
+    float ty = fy - y;
+
+    const float maxHeight = position.z + kStepHeight;
+    float h[4];
+    if (!getLevel(getSample(x, y), maxHeight, h[0]) ||
+        !getLevel(getSample(x + 1, y), maxHeight, h[1]) ||
+        !getLevel(getSample(x, y + 1), maxHeight, h[2]) ||
+        !getLevel(getSample(x + 1, y + 1), maxHeight, h[3])) {
+        return false;
+    }
+
+    auto lowest = std::min(std::min(h[0], h[1]), std::min(h[2], h[3]));
+    auto highest = std::max(std::max(h[0], h[1]), std::max(h[2], h[3]));
+    if (highest - lowest > kMaxBlendHeight) {
+        // Kerbs and walls, use the nearest sample instead of a slope
+        height = h[(ty >= 0.5f ? 2 : 0) + (tx >= 0.5f ? 1 : 0)];
+        return true;
+    }
+
+    height = glm::mix(glm::mix(h[0], h[1], tx), glm::mix(h[2], h[3], tx), ty);
+    return true;
+}
@@ -0,0 +1,92 @@
+#ifndef _RWENGINE_GROUNDHEIGHTMAP_HPP_
+#define _RWENGINE_GROUNDHEIGHTMAP_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+struct CollisionModel;
+
+/**
+ * Heights of the static collision world, sampled on a regular grid.
+ *
+ * The grid is split into tiles that are only allocated where there is
+ * collision. Each sample stores a few levels so bridges, overpasses and
+ * interiors keep the ground underneath them. Queries interpolate the four
+ * surrounding samples, which replaces a long vertical ray test through the
+ * physics world when placing things on the ground.
+ */
+class GroundHeightMap {
+public:
+    /// Distance between samples
+    static constexpr float kCellSize = 2.f;
+    /// Samples along each side of a tile
+    static constexpr int kTileSamples = 32;
+    /// Surfaces stored at each sample, the highest are kept
+    static constexpr int kMaxLevels = 3;
+    /// Surfaces up to this far above the query position are accepted
+    static constexpr float kStepHeight = 1.f;
+
+    /**
+     * Adds the upward facing triangles and box tops of a collision model
+     * placed in the world.
+     */
+    void addCollision(const CollisionModel& collision,
+                      const glm::vec3& position, const glm::quat& rotation);
+
+    /**
+     * Adds a world space triangle, steep or downward facing triangles are
+     * ignored.
+     */
+    void addTriangle(const glm::vec3& a, const glm::vec3& b,
+                     const glm::vec3& c);
+
+    /**
+     * Finds the highest ground at or just above position.
+     * @param height Set to the ground height if found
+     * @return false if there is no known ground there, the caller should
+     * fall back to a physics query
+     */
+    bool getGroundHeight(const glm::vec3& position, float& height) const;
+
+    void clear() {
+        tiles.clear();
+    }
+
+    size_t getTileCount() const {
+        return tiles.size();
+    }
+
+    size_t getMemoryBytes() const {
+        return tiles.size() * sizeof(Tile);
+    }
+
+private:
+    struct Sample {
+        /// Heights in 1/8th metres, highest first
+        std::int16_t levels[kMaxLevels];
+        std::uint8_t count;
+    };
+
+    using Tile = std::array<Sample, kTileSamples * kTileSamples>;
+    using TileKey = std::uint32_t;
+
+    std::unordered_map<TileKey, std::unique_ptr<Tile>> tiles;
+
+    void addHeight(int x, int y, float height);
+
+    const Sample* getSample(int x, int y) const;
+
+    /**
+     * @return false if the sample has no level below maxHeight
+     */
+    static bool getLevel(const Sample* sample, float maxHeight,
+                         float& height);
+};
+
+#endif
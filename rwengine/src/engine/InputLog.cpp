@@ -0,0 +1,70 @@
+#include "engine/InputLog.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+namespace {
+constexpr char kMagic[4] = {'R', 'W', 'I', 'N'};
+constexpr std::uint32_t kVersion = 1;
+
+struct InputLogHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t controls;
+    std::uint32_t ticks;
+};
+}  // namespace
+
+const GameInputState& InputLog::getInput(size_t tick) const {
+    static const GameInputState neutral{};
+    return tick < ticks.size() ? ticks[tick] : neutral;
+}
+
+bool InputLog::save(const std::string& file) const {
+    std::ofstream out(file, std::ios::binary);
+    if (!out) {
+        return false;
+    }
+
+    InputLogHeader header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.controls = GameInputState::_MaxControls;
+    header.ticks = static_cast<std::uint32_t>(ticks.size());
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const auto& input : ticks) {
+        out.write(reinterpret_cast<const char*>(input.levels),
+                  sizeof(input.levels));
+    }
+
+    return out.good();
+}
+
+bool InputLog::load(const std::string& file) {
+    std::ifstream in(file, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    InputLogHeader header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!in || std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.version != kVersion ||
+        header.controls != GameInputState::_MaxControls) {
+        return false;
+    }
+
+    std::vector<GameInputState> loaded(header.ticks);
+    for (auto& input : loaded) {
+        in.read(reinterpret_cast<char*>(input.levels), sizeof(input.levels));
+    }
+    if (!in) {
+        return false;
+    }
+
+    ticks = std::move(loaded);
+    return true;
+}
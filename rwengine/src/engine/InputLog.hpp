@@ -0,0 +1,53 @@
+#ifndef _RWENGINE_INPUTLOG_HPP_
+#define _RWENGINE_INPUTLOG_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <engine/GameInputState.hpp>
+
+/**
+ * Recording of the game input for each simulation tick.
+ *
+ * Replaying a log into a world created with the same random seeds reproduces
+ * the recorded session.
+ */
+class InputLog {
+public:
+    void record(const GameInputState& input) {
+        ticks.push_back(input);
+    }
+
+    /**
+     * @return The input for the given tick, or a neutral state past the end
+     * of the log
+     */
+    const GameInputState& getInput(size_t tick) const;
+
+    size_t getTickCount() const {
+        return ticks.size();
+    }
+
+    void clear() {
+        ticks.clear();
+    }
+
+    /**
+     * Writes the log to a file
+     * @return false if the file could not be written
+     */
+    bool save(const std::string& file) const;
+
+    /**
+     * Replaces the log with the contents of a file
+     * @return false if the file could not be read or has a different set of
+     * controls
+     */
+    bool load(const std::string& file);
+
+private:
+    std::vector<GameInputState> ticks;
+};
+
+#endif
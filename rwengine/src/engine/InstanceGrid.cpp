@@ -0,0 +1,76 @@
+#include "engine/InstanceGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "objects/InstanceObject.hpp"
+
+namespace {
+int getCellCoord(float position) {
+    return static_cast<int>(std::floor(position / InstanceGrid::kCellSize));
+}
+}  // namespace
+
+InstanceGrid::CellKey InstanceGrid::getCellKey(int x, int y) {
+    return static_cast<CellKey>(static_cast<std::uint16_t>(x)) << 16 |
+           static_cast<std::uint16_t>(y);
+}
+
+void InstanceGrid::insert(InstanceObject* instance) {
+    const auto& position = instance->getPosition();
+    cells[getCellKey(getCellCoord(position.x), getCellCoord(position.y))]
+        .push_back(instance);
+    count++;
+}
+
+void InstanceGrid::remove(InstanceObject* instance) {
+    auto removeFrom = [&](std::vector<InstanceObject*>& list) {
+        auto it = std::find(list.begin(), list.end(), instance);
+        if (it == list.end()) {
+            return false;
+        }
+        list.erase(it);
+        count--;
+        return true;
+    };
+
+    const auto& position = instance->getPosition();
+    auto it = cells.find(
+        getCellKey(getCellCoord(position.x), getCellCoord(position.y)));
+    if (it != cells.end() && removeFrom(it->second)) {
+        return;
+    }
+
+    for (auto& cell : cells) {
+        if (removeFrom(cell.second)) {
+            return;
+        }
+    }
+}
+
+std::vector<InstanceObject*> InstanceGrid::query(const glm::vec2& min,
+                                                 const glm::vec2& max) const {
+    std::vector<InstanceObject*> found;
+    for (auto x = getCellCoord(min.x); x <= getCellCoord(max.x); ++x) {
+        for (auto y = getCellCoord(min.y); y <= getCellCoord(max.y); ++y) {
+            auto it = cells.find(getCellKey(x, y));
+            if (it == cells.end()) {
+                continue;
+            }
+            for (auto instance : it->second) {
+                const auto& position = instance->getPosition();
+                if (position.x >= min.x && position.y >= min.y &&
+                    position.x <= max.x && position.y <= max.y) {
+                    found.push_back(instance);
+                }
+            }
+        }
+    }
+
+    // Same order as the instance pool
+    std::sort(found.begin(), found.end(),
+              [](const InstanceObject* a, const InstanceObject* b) {
+                  return a->getGameObjectID() < b->getGameObjectID();
+              });
+    return found;
+}
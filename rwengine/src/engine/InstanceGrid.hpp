@@ -0,0 +1,56 @@
+#ifndef _RWENGINE_INSTANCEGRID_HPP_
+#define _RWENGINE_INSTANCEGRID_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+class InstanceObject;
+
+/**
+ * Buckets instances into square cells on the ground plane, so fixtures such
+ * as garage doors and phones can be found near a point without looking at
+ * every instance in the world.
+ *
+ * Instances are filed under the position they had when inserted. One that
+ * moves into another cell afterwards is only found around where it started.
+ */
+class InstanceGrid {
+public:
+    static constexpr float kCellSize = 32.f;
+
+    using CellKey = std::uint32_t;
+
+    void insert(InstanceObject* instance);
+
+    /**
+     * Removes an instance, searching every cell if it has moved
+     */
+    void remove(InstanceObject* instance);
+
+    void clear() {
+        cells.clear();
+        count = 0;
+    }
+
+    /**
+     * @return Instances positioned inside the box, sorted by object ID
+     */
+    std::vector<InstanceObject*> query(const glm::vec2& min,
+                                       const glm::vec2& max) const;
+
+    size_t getInstanceCount() const {
+        return count;
+    }
+
+    static CellKey getCellKey(int x, int y);
+
+private:
+    std::unordered_map<CellKey, std::vector<InstanceObject*>> cells;
+    size_t count = 0;
+};
+
+#endif
@@ -0,0 +1,101 @@
+#include "engine/ModelResidency.hpp"
+
+#include <algorithm>
+#include <ostream>
+#include <utility>
+
+#include <data/Clump.hpp>
+
+void ModelResidency::addModel(ModelID model, size_t modelBytes) {
+    removeModel(model);
+
+    ResidentModel info;
+    info.bytes = modelBytes;
+    info.lastUse = ++useCounter;
+
+    bytes += modelBytes;
+    models[model] = info;
+}
+
+void ModelResidency::removeModel(ModelID model) {
+    auto it = models.find(model);
+    if (it == models.end()) {
+        return;
+    }
+    bytes -= it->second.bytes;
+    models.erase(it);
+}
+
+void ModelResidency::use(ModelID model) {
+    auto it = models.find(model);
+    if (it != models.end()) {
+        it->second.lastUse = ++useCounter;
+    }
+}
+
+bool ModelResidency::isReferenced(const ModelInfoTable& modelinfo,
+                                  ModelID model) {
+    auto it = modelinfo.find(model);
+    return it != modelinfo.end() && it->second &&
+           it->second->getReferenceCount() > 0;
+}
+
+std::vector<ModelID> ModelResidency::evict(const ModelInfoTable& modelinfo,
+                                           ModelID keep) {
+    std::vector<ModelID> evicted;
+    if (budget == 0 || bytes <= budget) {
+        return evicted;
+    }
+
+    std::vector<std::pair<std::uint64_t, ModelID>> candidates;
+    for (const auto& model : models) {
+        if (model.first != keep && !isPinned(model.first) &&
+            !isReferenced(modelinfo, model.first)) {
+            candidates.emplace_back(model.second.lastUse, model.first);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto& candidate : candidates) {
+        if (bytes <= budget) {
+            break;
+        }
+        removeModel(candidate.second);
+        evicted.push_back(candidate.second);
+    }
+
+    return evicted;
+}
+
+size_t ModelResidency::getUnreferencedCount(
+    const ModelInfoTable& modelinfo) const {
+    return static_cast<size_t>(
+        std::count_if(models.begin(), models.end(), [&](const auto& model) {
+            return !isReferenced(modelinfo, model.first);
+        }));
+}
+
+void ModelResidency::dumpStats(std::ostream& out,
+                               const ModelInfoTable& modelinfo) const {
+    out << models.size() << " models, " << getUnreferencedCount(modelinfo)
+        << " without instances, " << pinned.size() << " pinned, "
+        << bytes / 1024 << " KiB, budget " << budget / 1024 << " KiB\n";
+}
+
+size_t ModelResidency::estimateBytes(const Clump& clump) {
+    size_t total = 0;
+    std::set<const Geometry*> counted;
+    for (const auto& atomic : clump.getAtomics()) {
+        const auto& geometry = atomic->getGeometry();
+        if (!geometry || !counted.insert(geometry.get()).second) {
+            continue;
+        }
+        total += static_cast<size_t>(geometry->gbuff.getCount()) *
+                 sizeof(GeometryVertex);
+        for (const auto& subgeom : geometry->subgeom) {
+            // Indices stay in memory after they are uploaded
+            total += subgeom.numIndices * sizeof(uint32_t) * 2;
+        }
+    }
+    return total;
+}
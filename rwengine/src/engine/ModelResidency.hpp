@@ -0,0 +1,114 @@
+#ifndef _RWENGINE_MODELRESIDENCY_HPP_
+#define _RWENGINE_MODELRESIDENCY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include <data/ModelData.hpp>
+#include <rw/forward.hpp>
+
+/**
+ * Tracks the memory used by each loaded model and decides which models to
+ * unload when the total exceeds a budget.
+ *
+ * Live instances are counted by the model info itself (GameObject adds a
+ * reference), so only models without instances are considered, least
+ * recently used first. Models that are drawn without an instance of their
+ * own, such as weapons and wheels, have to be pinned.
+ */
+class ModelResidency {
+public:
+    struct ResidentModel {
+        /// Estimated memory used by the geometry
+        size_t bytes = 0;
+        /// Value of the use counter when the model was last used
+        std::uint64_t lastUse = 0;
+    };
+
+    /**
+     * @param bytes Geometry bytes to keep unreferenced models under, 0 to
+     * never evict
+     */
+    void setBudget(size_t bytes) {
+        budget = bytes;
+    }
+
+    size_t getBudget() const {
+        return budget;
+    }
+
+    /**
+     * Records a newly loaded model, replacing any previous record
+     */
+    void addModel(ModelID model, size_t bytes);
+
+    void removeModel(ModelID model);
+
+    bool isResident(ModelID model) const {
+        return models.find(model) != models.end();
+    }
+
+    /**
+     * Marks the model as the most recently used
+     */
+    void use(ModelID model);
+
+    void pin(ModelID model) {
+        pinned.insert(model);
+    }
+
+    bool isPinned(ModelID model) const {
+        return pinned.find(model) != pinned.end();
+    }
+
+    /**
+     * Chooses models to unload so the resident bytes fit in the budget,
+     * least recently used first. Models with live instances, pinned models
+     * and keep are never chosen. The chosen models are removed, the caller
+     * has to unload them.
+     */
+    std::vector<ModelID> evict(const ModelInfoTable& modelinfo,
+                               ModelID keep);
+
+    size_t getBytes() const {
+        return bytes;
+    }
+
+    size_t getResidentCount() const {
+        return models.size();
+    }
+
+    /**
+     * @return The number of resident models without live instances
+     */
+    size_t getUnreferencedCount(const ModelInfoTable& modelinfo) const;
+
+    const std::unordered_map<ModelID, ResidentModel>& getModels() const {
+        return models;
+    }
+
+    /**
+     * Writes a summary of resident models and their memory use
+     */
+    void dumpStats(std::ostream& out, const ModelInfoTable& modelinfo) const;
+
+    /**
+     * Counts vertex and index data of every distinct geometry in the clump
+     */
+    static size_t estimateBytes(const Clump& clump);
+
+private:
+    std::unordered_map<ModelID, ResidentModel> models;
+    std::set<ModelID> pinned;
+    std::uint64_t useCounter = 0;
+    size_t budget = 0;
+    size_t bytes = 0;
+
+    static bool isReferenced(const ModelInfoTable& modelinfo, ModelID model);
+};
+
+#endif
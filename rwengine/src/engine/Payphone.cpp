@@ -14,18 +14,15 @@
 Payphone::Payphone(GameWorld* engine_, const int id_, const glm::vec2 coord)
     : engine(engine_), id(id_) {
     // Find payphone object, original game does this differently
-    for (const auto& p : engine->instancePool.objects) {
-        auto o = p.second;
-        if (!o->getModel()) {
-            continue;
-        }
-        if (o->getModelInfo<BaseModelInfo>()->name != "phonebooth1") {
-            continue;
-        }
-        if (glm::distance(coord, glm::vec2(o->getPosition())) < 2.f) {
-            object = static_cast<InstanceObject*>(o);
-            break;
-        }
+    const auto phones = engine->findInstances(
+        coord - glm::vec2(2.f), coord + glm::vec2(2.f),
+        [&](InstanceObject* o) {
+            return o->getModel() &&
+                   o->getModelInfo<BaseModelInfo>()->name == "phonebooth1" &&
+                   glm::distance(coord, glm::vec2(o->getPosition())) < 2.f;
+        });
+    if (!phones.empty()) {
+        object = phones.front();
     }
 
     message.clear();
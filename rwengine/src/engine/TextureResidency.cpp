@@ -0,0 +1,139 @@
+#include "engine/TextureResidency.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <set>
+
+void TextureResidency::addSlot(const std::string& slot,
+                               const TextureArchive& textures,
+                               size_t fileBytes) {
+    removeSlot(slot);
+
+    SlotInfo info;
+    info.textures = textures.size();
+    info.fileBytes = fileBytes;
+    // Slots can share textures, such as the error texture, only count them
+    // once per slot
+    std::set<const TextureData*> counted;
+    for (const auto& texture : textures) {
+        if (texture.second && counted.insert(texture.second.get()).second) {
+            info.gpuBytes += estimateGPUBytes(*texture.second);
+        }
+    }
+    info.lastUse = ++useCounter;
+
+    gpuBytes += info.gpuBytes;
+    slots[slot] = info;
+}
+
+void TextureResidency::removeSlot(const std::string& slot) {
+    auto it = slots.find(slot);
+    if (it == slots.end()) {
+        return;
+    }
+    gpuBytes -= it->second.gpuBytes;
+    slots.erase(it);
+}
+
+void TextureResidency::use(const std::string& slot) {
+    auto it = slots.find(slot);
+    if (it != slots.end()) {
+        it->second.lastUse = ++useCounter;
+    }
+}
+
+void TextureResidency::pin(const std::string& slot) {
+    auto it = slots.find(slot);
+    if (it != slots.end()) {
+        it->second.pinned = true;
+    }
+}
+
+void TextureResidency::addReference(const std::string& slot) {
+    auto it = slots.find(slot);
+    if (it != slots.end()) {
+        it->second.references++;
+    }
+}
+
+void TextureResidency::removeReference(const std::string& slot) {
+    auto it = slots.find(slot);
+    if (it != slots.end() && it->second.references > 0) {
+        it->second.references--;
+    }
+}
+
+std::vector<std::string> TextureResidency::evict() {
+    std::vector<std::string> evicted;
+    if (budget == 0 || gpuBytes <= budget) {
+        return evicted;
+    }
+
+    std::vector<std::pair<std::uint64_t, std::string>> candidates;
+    for (const auto& slot : slots) {
+        if (!slot.second.pinned && slot.second.references == 0) {
+            candidates.emplace_back(slot.second.lastUse, slot.first);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto& candidate : candidates) {
+        if (gpuBytes <= budget) {
+            break;
+        }
+        removeSlot(candidate.second);
+        evicted.push_back(candidate.second);
+    }
+
+    return evicted;
+}
+
+void TextureResidency::dumpStats(std::ostream& out) const {
+    std::vector<std::pair<std::uint64_t, std::string>> order;
+    size_t fileBytes = 0;
+    for (const auto& slot : slots) {
+        order.emplace_back(slot.second.lastUse, slot.first);
+        fileBytes += slot.second.fileBytes;
+    }
+    std::sort(order.rbegin(), order.rend());
+
+    out << slots.size() << " texture slots, " << gpuBytes / 1024
+        << " KiB GPU, " << fileBytes / 1024 << " KiB TXD, budget "
+        << budget / 1024 << " KiB\n";
+    for (const auto& entry : order) {
+        const auto& info = slots.at(entry.second);
+        out << std::left << std::setw(16) << entry.second << std::right
+            << std::setw(5) << info.textures << " textures "
+            << std::setw(8) << info.gpuBytes / 1024 << " KiB GPU "
+            << std::setw(8) << info.fileBytes / 1024 << " KiB TXD  ";
+        if (info.pinned) {
+            out << "pinned";
+        } else if (info.references > 0) {
+            out << "used by " << info.references << " models";
+        } else {
+            out << "unreferenced";
+        }
+        out << "\n";
+    }
+}
+
+size_t TextureResidency::estimateGPUBytes(const TextureData& texture) {
+    // Known exactly for compressed textures
+    if (texture.getGPUBytes() != 0) {
+        return texture.getGPUBytes();
+    }
+
+    size_t bytes = 0;
+    size_t width = std::max(texture.getSize().x, 1);
+    size_t height = std::max(texture.getSize().y, 1);
+    while (true) {
+        bytes += width * height * 4;
+        if (width == 1 && height == 1) {
+            break;
+        }
+        width = std::max<size_t>(width / 2, 1);
+        height = std::max<size_t>(height / 2, 1);
+    }
+    return bytes;
+}
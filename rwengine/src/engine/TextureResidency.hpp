@@ -0,0 +1,106 @@
+#ifndef _RWENGINE_TEXTURERESIDENCY_HPP_
+#define _RWENGINE_TEXTURERESIDENCY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gl/TextureData.hpp>
+
+/**
+ * Tracks the memory used by each loaded texture slot and decides which slots
+ * to unload when the total exceeds a budget.
+ *
+ * A slot stays resident while a loaded model references it, or if it was
+ * pinned because it was loaded explicitly (HUD, fonts, radar etc.). The
+ * remaining slots are unloaded least recently used first.
+ */
+class TextureResidency {
+public:
+    struct SlotInfo {
+        /// Number of loaded models using the slot
+        size_t references = 0;
+        /// Loaded explicitly rather than for a model, never evicted
+        bool pinned = false;
+        size_t textures = 0;
+        /// Size of the TXD file, the cost of loading the slot again
+        size_t fileBytes = 0;
+        /// Estimated video memory used by the textures and their mipmaps
+        size_t gpuBytes = 0;
+        /// Value of the use counter when the slot was last used
+        std::uint64_t lastUse = 0;
+    };
+
+    /**
+     * @param bytes GPU bytes to keep unreferenced slots under, 0 to never
+     * evict
+     */
+    void setBudget(size_t bytes) {
+        budget = bytes;
+    }
+
+    size_t getBudget() const {
+        return budget;
+    }
+
+    /**
+     * Records a newly loaded slot, replacing any previous record
+     */
+    void addSlot(const std::string& slot, const TextureArchive& textures,
+                 size_t fileBytes);
+
+    void removeSlot(const std::string& slot);
+
+    bool isResident(const std::string& slot) const {
+        return slots.find(slot) != slots.end();
+    }
+
+    /**
+     * Marks the slot as the most recently used
+     */
+    void use(const std::string& slot);
+
+    void pin(const std::string& slot);
+
+    void addReference(const std::string& slot);
+    void removeReference(const std::string& slot);
+
+    /**
+     * Chooses slots to unload so the resident GPU bytes fit in the budget,
+     * least recently used first. Referenced and pinned slots are never
+     * chosen. The chosen slots are removed, the caller has to release their
+     * textures.
+     */
+    std::vector<std::string> evict();
+
+    size_t getGPUBytes() const {
+        return gpuBytes;
+    }
+
+    const std::map<std::string, SlotInfo>& getSlots() const {
+        return slots;
+    }
+
+    /**
+     * Writes a line per resident slot with its size and what keeps it
+     * resident, most recently used first
+     */
+    void dumpStats(std::ostream& out) const;
+
+    /**
+     * Uses the size recorded for compressed textures, otherwise assumes
+     * RGBA8 with a full mipmap chain
+     */
+    static size_t estimateGPUBytes(const TextureData& texture);
+
+private:
+    std::map<std::string, SlotInfo> slots;
+    std::uint64_t useCounter = 0;
+    size_t budget = 0;
+    size_t gpuBytes = 0;
+};
+
+#endif
@@ -0,0 +1,176 @@
+#include "engine/WaterQueries.hpp"
+
+#include <algorithm>
+
+namespace {
+constexpr float kCellSize = WATER_WORLD_SIZE / WATER_HQ_DATA_SIZE;
+constexpr float kPi = 3.14159265f;
+
+/**
+ * Branch free sine, accurate to about 1e-5 so the wave loop vectorises
+ * instead of calling into libm for each point.
+ */
+inline float approxSin(float x) {
+    // Drop whole turns, leaving (-2pi, 2pi)
+    x -= 2.f * kPi * static_cast<float>(static_cast<int>(x * (0.5f / kPi)));
+    // Fold onto [-pi/2, pi/2] where the series converges quickly, min and
+    // max keep this free of branches
+    x = std::min(x, kPi - x);
+    x = std::max(x, -kPi - x);
+    x = std::min(x, kPi - x);
+    const float x2 = x * x;
+    return x * (1.f +
+                x2 * (-1.f / 6.f +
+                      x2 * (1.f / 120.f +
+                            x2 * (-1.f / 5040.f + x2 * (1.f / 362880.f)))));
+}
+
+inline float getWavePhase(float x, float y, float time) {
+    return time + (x + y) * WATER_SCALE;
+}
+
+inline float getWave(float phase) {
+    return (1.f + approxSin(phase)) * WATER_HEIGHT;
+}
+}  // namespace
+
+void WaterQueries::setTable(const float* heights_,
+                            const std::uint8_t* cells_) {
+    heights = heights_;
+    cells = cells_;
+
+    std::fill(std::begin(blocks), std::end(blocks), false);
+    anyWater = false;
+    for (auto x = 0; x < WATER_HQ_DATA_SIZE; ++x) {
+        for (auto y = 0; y < WATER_HQ_DATA_SIZE; ++y) {
+            if (cells[x * WATER_HQ_DATA_SIZE + y] < NO_WATER_INDEX) {
+                blocks[(x / kBlockCells) * kBlockCount + y / kBlockCells] =
+                    true;
+                anyWater = true;
+            }
+        }
+    }
+}
+
+int WaterQueries::getCellIndex(const glm::vec2& position) {
+    auto x = static_cast<int>((position.x + WATER_WORLD_SIZE / 2.f) /
+                              kCellSize);
+    auto y = static_cast<int>((position.y + WATER_WORLD_SIZE / 2.f) /
+                              kCellSize);
+
+    if (x >= 0 && x < WATER_HQ_DATA_SIZE && y >= 0 &&
+        y < WATER_HQ_DATA_SIZE) {
+        return x * WATER_HQ_DATA_SIZE + y;
+    }
+    return -1;
+}
+
+int WaterQueries::getHeightIndex(const glm::vec2& position) const {
+    auto i = getCellIndex(position);
+    if (!cells || i < 0 || cells[i] >= NO_WATER_INDEX) {
+        return NO_WATER_INDEX;
+    }
+    return cells[i];
+}
+
+bool WaterQueries::isNearWater(const glm::vec2& position) const {
+    auto i = getCellIndex(position);
+    if (i < 0) {
+        return false;
+    }
+    auto x = i / WATER_HQ_DATA_SIZE / kBlockCells;
+    auto y = i % WATER_HQ_DATA_SIZE / kBlockCells;
+    return blocks[x * kBlockCount + y];
+}
+
+float WaterQueries::getWaveHeight(const glm::vec2& position, float time) {
+    return getWave(getWavePhase(position.x, position.y, time));
+}
+
+WaterQueries::Result WaterQueries::sample(const glm::vec3& point,
+                                          float time) const {
+    Result result;
+    if (!isNearWater(glm::vec2(point))) {
+        return result;
+    }
+
+    auto index = getHeightIndex(glm::vec2(point));
+    if (index == NO_WATER_INDEX) {
+        return result;
+    }
+
+    result.water = true;
+    result.waveHeight = getWaveHeight(glm::vec2(point), time);
+    result.height = heights[index] + result.waveHeight;
+    result.depth = result.height - point.z;
+    return result;
+}
+
+WaterQueries::Handle WaterQueries::queue(const glm::vec3& point) {
+    points.push_back(point);
+    return {batch, static_cast<std::uint32_t>(points.size() - 1)};
+}
+
+void WaterQueries::execute(float time) {
+    results.assign(points.size(), Result{});
+    wetPoints.clear();
+    wetPhases.clear();
+
+    if (anyWater) {
+        for (auto i = 0u; i < points.size(); ++i) {
+            const auto& point = points[i];
+            if (!isNearWater(glm::vec2(point))) {
+                continue;
+            }
+            auto index = getHeightIndex(glm::vec2(point));
+            if (index == NO_WATER_INDEX) {
+                continue;
+            }
+            results[i].water = true;
+            results[i].height = heights[index];
+            wetPoints.push_back(i);
+            wetPhases.push_back(getWavePhase(point.x, point.y, time));
+        }
+    }
+
+    // No lookups or branches on the data here
+    wetWaves.resize(wetPhases.size());
+    const auto count = wetPhases.size();
+    const float* phases = wetPhases.data();
+    float* waves = wetWaves.data();
+    for (size_t i = 0; i < count; ++i) {
+        waves[i] = getWave(phases[i]);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        auto& result = results[wetPoints[i]];
+        result.waveHeight = waves[i];
+        result.height += waves[i];
+        result.depth = result.height - points[wetPoints[i]].z;
+    }
+
+    resultPoints.swap(points);
+    points.clear();
+    batch++;
+}
+
+const WaterQueries::Result* WaterQueries::getResult(
+    Handle handle, std::uint32_t offset) const {
+    auto index = handle.index + offset;
+    if (handle.batch + 1 != batch || index >= results.size()) {
+        return nullptr;
+    }
+    return &results[index];
+}
+
+WaterQueries::Result WaterQueries::getResultOrSample(Handle handle,
+                                                     std::uint32_t offset,
+                                                     const glm::vec3& point,
+                                                     float time) const {
+    auto result = getResult(handle, offset);
+    if (result &&
+        glm::vec2(resultPoints[handle.index + offset]) == glm::vec2(point)) {
+        return *result;
+    }
+    return sample(point, time);
+}
@@ -0,0 +1,113 @@
+#ifndef _RWENGINE_WATERQUERIES_HPP_
+#define _RWENGINE_WATERQUERIES_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <rw/types.hpp>
+
+/**
+ * Height, depth and wave queries against the water table.
+ *
+ * Like PhysicsQueries, points can either be sampled immediately or queued
+ * during a tick and evaluated together by execute(), the results are then
+ * looked up with the handle returned when queueing. A coarse map of which
+ * blocks contain any water lets dry points skip the lookup entirely, and
+ * the waves of all wet points are evaluated in one pass over packed arrays.
+ */
+class WaterQueries {
+public:
+    /// Width of a coarse block, in water table cells
+    static constexpr int kBlockCells = 8;
+    static constexpr int kBlockCount = WATER_HQ_DATA_SIZE / kBlockCells;
+
+    struct Handle {
+        /// Batch the point was queued in, 0 is never a valid batch
+        std::uint32_t batch = 0;
+        std::uint32_t index = 0;
+    };
+
+    struct Result {
+        bool water = false;
+        /// Surface height, including the wave
+        float height = 0.f;
+        float waveHeight = 0.f;
+        /// Distance below the surface, negative when above it
+        float depth = 0.f;
+    };
+
+    /**
+     * Sets the water levels and the table of which level each cell uses.
+     * Both are used in place, but the coarse blocks are only built here so
+     * call it again after adding water to the table.
+     */
+    void setTable(const float* heights, const std::uint8_t* cells);
+
+    /**
+     * @return Index into the water table, or -1 outside of it
+     */
+    static int getCellIndex(const glm::vec2& position);
+
+    /**
+     * @return The water level index at a point, or NO_WATER_INDEX
+     */
+    int getHeightIndex(const glm::vec2& position) const;
+
+    /**
+     * @return True if the coarse block around the point has any water
+     */
+    bool isNearWater(const glm::vec2& position) const;
+
+    static float getWaveHeight(const glm::vec2& position, float time);
+
+    Result sample(const glm::vec3& point, float time) const;
+
+    Handle queue(const glm::vec3& point);
+
+    /**
+     * Evaluates all queued points, replacing the results of the previous
+     * batch
+     */
+    void execute(float time);
+
+    /**
+     * @param offset Points queued after the handle's, in the same batch
+     * @return The result from the last executed batch, or nullptr if the
+     * handle is from another batch
+     */
+    const Result* getResult(Handle handle, std::uint32_t offset = 0) const;
+
+    /**
+     * Looks up a queued point, sampling it now if it wasn't in the last batch
+     * or has moved since
+     */
+    Result getResultOrSample(Handle handle, std::uint32_t offset,
+                             const glm::vec3& point, float time) const;
+
+    size_t getQueuedCount() const {
+        return points.size();
+    }
+
+private:
+    const float* heights = nullptr;
+    const std::uint8_t* cells = nullptr;
+    bool blocks[kBlockCount * kBlockCount]{};
+    bool anyWater = false;
+
+    /// Batch that points are currently queued in
+    std::uint32_t batch = 1;
+
+    std::vector<glm::vec3> points;
+    std::vector<glm::vec3> resultPoints;
+    std::vector<Result> results;
+
+    /// Packed inputs and outputs of the wet points in a batch
+    std::vector<std::uint32_t> wetPoints;
+    std::vector<float> wetPhases;
+    std::vector<float> wetWaves;
+};
+
+#endif
@@ -18,7 +18,7 @@ void Weapon::fireHitscan(WeaponData* weapon, CharacterObject* owner) {
     auto fireOrigin = glm::vec3(handMatrix[3]);
     float dmg = weapon->damage;
 
-    owner->engine->doWeaponScan({dmg, fireOrigin, rayend, weapon});
+    owner->engine->queueWeaponScan({dmg, fireOrigin, rayend, weapon});
 }
 
 void Weapon::fireProjectile(WeaponData* weapon, CharacterObject* owner,
@@ -20,6 +20,7 @@ struct ColHeader {
 };
 
 bool LoaderCOL::load(const std::string& path) {
+    RW_MEMORY_SCOPE(MemoryTag::Collision);
     std::ifstream file(path.c_str(), std::ios_base::binary);
     if (!file.is_open()) {
         return false;
@@ -118,6 +119,13 @@ bool LoaderCOL::load(const std::string& path) {
             t.surface = readSurface();
         }
 
+        model->memory.set(
+            sizeof(CollisionModel) +
+            model->spheres.size() * sizeof(CollisionModel::Sphere) +
+            model->boxes.size() * sizeof(CollisionModel::Box) +
+            model->vertices.size() * sizeof(glm::vec3) +
+            model->faces.size() * sizeof(CollisionModel::Triangle));
+
         collisions.emplace_back(std::move(model));
     }
 
@@ -27,7 +27,7 @@ void LoaderCutsceneDAT::load(CutsceneTracks &tracks, const FileContentsInfo& fil
 
         float t = std::stof(st);
 
-        tracks.zoom[t] = std::stof(sz);
+        tracks.zoom.addKeyframe(t, std::stof(sz));
         tracks.duration = std::max(t, tracks.duration);
 
         ss.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -46,7 +46,7 @@ void LoaderCutsceneDAT::load(CutsceneTracks &tracks, const FileContentsInfo& fil
 
         float t = std::stof(st);
 
-        tracks.rotation[t] = std::stof(sr);
+        tracks.rotation.addKeyframe(t, std::stof(sr));
         tracks.duration = std::max(t, tracks.duration);
 
         ss.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -68,7 +68,7 @@ void LoaderCutsceneDAT::load(CutsceneTracks &tracks, const FileContentsInfo& fil
         float t = std::stof(st);
         glm::vec3 p{std::stof(sx), std::stof(sy), std::stof(sz)};
 
-        tracks.position[t] = p;
+        tracks.position.addKeyframe(t, p);
         tracks.duration = std::max(t, tracks.duration);
 
         ss.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -90,7 +90,7 @@ void LoaderCutsceneDAT::load(CutsceneTracks &tracks, const FileContentsInfo& fil
         float t = std::stof(st);
         glm::vec3 p{std::stof(sx), std::stof(sy), std::stof(sz)};
 
-        tracks.target[t] = p;
+        tracks.target.addKeyframe(t, p);
         tracks.duration = std::max(t, tracks.duration);
 
         ss.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
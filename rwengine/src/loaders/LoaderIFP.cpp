@@ -2,67 +2,251 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
+#include <limits>
 #include <memory>
 
-bool findKeyframes(float t, AnimationBone* bone, AnimationKeyframe& f1,
-                   AnimationKeyframe& f2, float& alpha) {
-    for (size_t f = 0; f < bone->frames.size(); ++f) {
-        if (t <= bone->frames[f].starttime) {
-            f2 = bone->frames[f];
-
-            if (f == 0) {
-                if (bone->frames.size() != 1) {
-                    f1 = bone->frames.back();
-                } else {
-                    f1 = f2;
-                }
-            } else {
-                f1 = bone->frames[f - 1];
-            }
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define RW_IFP_SSE_INTERPOLATION 1
+#endif
 
-            float tdiff = (f2.starttime - f1.starttime);
-            if (tdiff == 0.f) {
-                alpha = 1.f;
-            } else {
-                alpha = glm::clamp((t - f1.starttime) / tdiff, 0.f, 1.f);
-            }
+namespace {
+constexpr float kQuantiseRange = 0.70710678f;  // 1 / sqrt(2)
+constexpr float kQuantiseSteps = 32767.f;
+
+#ifdef RW_IFP_SSE_INTERPOLATION
+/// Sum of all four lanes, in every lane
+__m128 horizontalSum(__m128 v) {
+    auto shuffled = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+    auto sums = _mm_add_ps(v, shuffled);
+    shuffled = _mm_movehl_ps(shuffled, sums);
+    sums = _mm_add_ss(sums, shuffled);
+    return _mm_shuffle_ps(sums, sums, 0);
+}
+#endif
+
+/**
+ * Same as glm::normalize(glm::slerp(a, b, alpha))
+ */
+glm::quat interpolateRotation(const glm::quat& a, const glm::quat& b,
+                              float alpha) {
+#ifdef RW_IFP_SSE_INTERPOLATION
+    const auto va = _mm_setr_ps(a.x, a.y, a.z, a.w);
+    auto vb = _mm_setr_ps(b.x, b.y, b.z, b.w);
+
+    // Take the shortest path
+    auto cosTheta = _mm_cvtss_f32(horizontalSum(_mm_mul_ps(va, vb)));
+    if (cosTheta < 0.f) {
+        vb = _mm_sub_ps(_mm_setzero_ps(), vb);
+        cosTheta = -cosTheta;
+    }
+
+    // Close rotations are blended linearly to avoid dividing by ~0
+    float weightA = 1.f - alpha;
+    float weightB = alpha;
+    if (cosTheta <= 1.f - std::numeric_limits<float>::epsilon()) {
+        const auto angle = std::acos(cosTheta);
+        const auto invSin = 1.f / std::sin(angle);
+        weightA = std::sin((1.f - alpha) * angle) * invSin;
+        weightB = std::sin(alpha * angle) * invSin;
+    }
+
+    auto result = _mm_add_ps(_mm_mul_ps(va, _mm_set1_ps(weightA)),
+                             _mm_mul_ps(vb, _mm_set1_ps(weightB)));
+    result = _mm_div_ps(result,
+                        _mm_sqrt_ps(horizontalSum(_mm_mul_ps(result, result))));
+
+    alignas(16) float out[4];
+    _mm_store_ps(out, result);
+    return glm::quat{out[3], out[0], out[1], out[2]};
+#else
+    return glm::normalize(glm::slerp(a, b, alpha));
+#endif
+}
+}  // namespace
 
-            return true;
+PackedRotation PackedRotation::pack(const glm::quat& q) {
+    const float components[4] = {q.x, q.y, q.z, q.w};
+    std::uint16_t largest = 0;
+    for (std::uint16_t i = 1; i < 4; ++i) {
+        if (std::abs(components[i]) > std::abs(components[largest])) {
+            largest = i;
         }
     }
-    return false;
+
+    // q and -q are the same rotation, keep the dropped component positive
+    const float sign = components[largest] < 0.f ? -1.f : 1.f;
+
+    PackedRotation packed;
+    for (std::uint16_t i = 0, o = 0; i < 4; ++i) {
+        if (i == largest) {
+            continue;
+        }
+        const auto normalised = glm::clamp(
+            sign * components[i] / kQuantiseRange * 0.5f + 0.5f, 0.f, 1.f);
+        packed.data[o++] = static_cast<std::uint16_t>(
+            std::lround(normalised * kQuantiseSteps));
+    }
+    packed.data[0] |= static_cast<std::uint16_t>((largest & 2) << 14);
+    packed.data[1] |= static_cast<std::uint16_t>((largest & 1) << 15);
+    return packed;
 }
 
-AnimationKeyframe AnimationBone::getInterpolatedKeyframe(float time) {
-    AnimationKeyframe f1, f2;
-    float alpha;
+glm::quat PackedRotation::unpack() const {
+    const auto largest = ((data[0] >> 14) & 2) | (data[1] >> 15);
 
-    if (findKeyframes(time, this, f1, f2, alpha)) {
-        return {glm::normalize(glm::slerp(f1.rotation, f2.rotation, alpha)),
-                glm::mix(f1.position, f2.position, alpha),
-                glm::mix(f1.scale, f2.scale, alpha), time,
-                std::max(f1.id, f2.id)};
+    float components[4];
+    float sumSquares = 0.f;
+    for (int i = 0, o = 0; i < 4; ++i) {
+        if (i == largest) {
+            continue;
+        }
+        const auto value = static_cast<float>(data[o++] & 0x7FFF);
+        components[i] = (value / kQuantiseSteps * 2.f - 1.f) * kQuantiseRange;
+        sumSquares += components[i] * components[i];
     }
+    components[largest] = std::sqrt(std::max(0.f, 1.f - sumSquares));
+
+    return glm::quat{components[3], components[0], components[1],
+                     components[2]};
+}
 
-    return frames.back();
+size_t AnimationTracks::getBytes() const {
+    return times.capacity() * sizeof(float) +
+           rotations.capacity() * sizeof(PackedRotation) +
+           translations.capacity() * sizeof(glm::vec3) +
+           scales.capacity() * sizeof(glm::vec3);
 }
 
-AnimationKeyframe AnimationBone::getKeyframe(float time) {
-    for (auto &frame : frames) {
-        if (time >= frame.starttime) {
-            return frame;
+AnimationKeyframe AnimationBone::getKeyframe(size_t index) const {
+    AnimationKeyframe frame;
+    frame.rotation = tracks->rotations[rotationOffset + index].unpack();
+    if (type != R00) {
+        frame.position = tracks->translations[translationOffset + index];
+    }
+    if (type == RTS) {
+        frame.scale = tracks->scales[scaleOffset + index];
+    }
+    frame.starttime = tracks->times[timeOffset + index];
+    frame.id = static_cast<int>(index);
+    return frame;
+}
+
+AnimationKeyframe AnimationBone::getInterpolatedKeyframe(float time) const {
+    const auto times = tracks->times.data() + timeOffset;
+    const auto last = keyframeCount - 1;
+
+    const auto next = std::lower_bound(times, times + keyframeCount, time);
+    if (next == times + keyframeCount) {
+        return getKeyframe(last);
+    }
+
+    // Before the first keyframe blends in from the last one
+    const auto f2 = static_cast<size_t>(next - times);
+    const auto f1 = f2 == 0 ? last : f2 - 1;
+
+    float alpha = 1.f;
+    const auto tdiff = times[f2] - times[f1];
+    if (tdiff != 0.f) {
+        alpha = glm::clamp((time - times[f1]) / tdiff, 0.f, 1.f);
+    }
+
+    const auto& rotations = tracks->rotations;
+    AnimationKeyframe frame;
+    frame.rotation =
+        interpolateRotation(rotations[rotationOffset + f1].unpack(),
+                            rotations[rotationOffset + f2].unpack(), alpha);
+    if (type != R00) {
+        const auto& translations = tracks->translations;
+        frame.position = glm::mix(translations[translationOffset + f1],
+                                  translations[translationOffset + f2], alpha);
+    }
+    if (type == RTS) {
+        const auto& scales = tracks->scales;
+        frame.scale = glm::mix(scales[scaleOffset + f1],
+                               scales[scaleOffset + f2], alpha);
+    }
+    frame.starttime = time;
+    frame.id = static_cast<int>(std::max(f1, f2));
+    return frame;
+}
+
+AnimationBone* Animation::addBone(
+    const std::string& boneName, AnimationBone::Data type,
+    const std::vector<AnimationKeyframe>& keyframes) {
+    auto existing = bones.find(boneName);
+    if (existing != bones.end()) {
+        return existing->second;
+    }
+
+    auto bone = new AnimationBone;
+    bone->name = boneName;
+    bone->type = type;
+    bone->tracks = &tracks;
+    bone->keyframeCount = static_cast<std::uint32_t>(keyframes.size());
+    if (!keyframes.empty()) {
+        bone->duration = keyframes.back().starttime;
+    }
+
+    // Reuse the times of another bone if they're the same
+    std::vector<float> times;
+    times.reserve(keyframes.size());
+    for (const auto& frame : keyframes) {
+        times.push_back(frame.starttime);
+    }
+    bone->timeOffset = static_cast<std::uint32_t>(tracks.times.size());
+    for (const auto& other : bones) {
+        const auto& shared = *other.second;
+        if (shared.keyframeCount == bone->keyframeCount &&
+            std::equal(times.begin(), times.end(),
+                       tracks.times.begin() + shared.timeOffset)) {
+            bone->timeOffset = shared.timeOffset;
+            break;
         }
     }
-    return frames.back();
+    if (bone->timeOffset == tracks.times.size()) {
+        tracks.times.insert(tracks.times.end(), times.begin(), times.end());
+    }
+
+    bone->rotationOffset = static_cast<std::uint32_t>(tracks.rotations.size());
+    bone->translationOffset =
+        static_cast<std::uint32_t>(tracks.translations.size());
+    bone->scaleOffset = static_cast<std::uint32_t>(tracks.scales.size());
+    for (const auto& frame : keyframes) {
+        tracks.rotations.push_back(PackedRotation::pack(frame.rotation));
+        if (type != AnimationBone::R00) {
+            tracks.translations.push_back(frame.position);
+        }
+        if (type == AnimationBone::RTS) {
+            tracks.scales.push_back(frame.scale);
+        }
+    }
+
+    bones.insert({boneName, bone});
+    memory.set(tracks.getBytes() + bones.size() * sizeof(AnimationBone));
+    return bone;
+}
+
+size_t Animation::getKeyframeCount() const {
+    size_t count = 0;
+    for (const auto& bone : bones) {
+        count += bone.second->keyframeCount;
+    }
+    return count;
 }
 
 bool LoaderIFP::loadFromMemory(char* data) {
+    RW_MEMORY_SCOPE(MemoryTag::Animations);
     size_t data_offs = 0;
     size_t* dataI = &data_offs;
 
     ANPK* fileRoot = read<ANPK>(data, dataI);
     std::string listname = readString(data, dataI);
 
+    // Decoded keyframes of one bone at a time, before packing
+    std::vector<AnimationKeyframe> keyframes;
+
     for (int a = 0; a < fileRoot->info.entries; ++a) {
         // something about a name?
         /*NAME* n =*/read<NAME>(data, dataI);
@@ -81,57 +265,50 @@ bool LoaderIFP::loadFromMemory(char* data) {
             CPAN* cpan = read<CPAN>(data, dataI);
             ANIM* frames = read<ANIM>(data, dataI);
 
-            auto bonedata = new AnimationBone;
-            bonedata->name = frames->name;
-            bonedata->frames.reserve(frames->frames);
+            keyframes.clear();
+            keyframes.reserve(frames->frames);
 
             data_offs += ((8 + frames->base.size) - sizeof(ANIM));
 
             KFRM* frame = read<KFRM>(data, dataI);
             std::string type(frame->base.magic, 4);
 
-            float time = 0.f;
-
+            AnimationBone::Data boneType = AnimationBone::R00;
             if (type == "KR00") {
-                bonedata->type = AnimationBone::R00;
                 for (int d = 0; d < frames->frames; ++d) {
                     glm::quat q = glm::conjugate(*read<glm::quat>(data, dataI));
-                    time = *read<float>(data, dataI);
-                    bonedata->frames.emplace_back(q, glm::vec3(0.f, 0.f, 0.f),
-                                                glm::vec3(1.f, 1.f, 1.f), time,
-                                                d);
+                    float time = *read<float>(data, dataI);
+                    keyframes.emplace_back(q, glm::vec3(0.f, 0.f, 0.f),
+                                           glm::vec3(1.f, 1.f, 1.f), time, d);
                 }
             } else if (type == "KRT0") {
-                bonedata->type = AnimationBone::RT0;
+                boneType = AnimationBone::RT0;
                 for (int d = 0; d < frames->frames; ++d) {
                     glm::quat q = glm::conjugate(*read<glm::quat>(data, dataI));
                     glm::vec3 p = *read<glm::vec3>(data, dataI);
-                    time = *read<float>(data, dataI);
-                    bonedata->frames.emplace_back(
-                        q, p, glm::vec3(1.f, 1.f, 1.f), time, d);
+                    float time = *read<float>(data, dataI);
+                    keyframes.emplace_back(q, p, glm::vec3(1.f, 1.f, 1.f),
+                                           time, d);
                 }
             } else if (type == "KRTS") {
-                bonedata->type = AnimationBone::RTS;
+                boneType = AnimationBone::RTS;
                 for (int d = 0; d < frames->frames; ++d) {
                     glm::quat q = glm::conjugate(*read<glm::quat>(data, dataI));
                     glm::vec3 p = *read<glm::vec3>(data, dataI);
                     glm::vec3 s = *read<glm::vec3>(data, dataI);
-                    time = *read<float>(data, dataI);
-                    bonedata->frames.emplace_back(q, p, s, time, d);
+                    float time = *read<float>(data, dataI);
+                    keyframes.emplace_back(q, p, s, time, d);
                 }
             }
 
-            bonedata->duration = time;
-            animation->duration =
-                std::max(bonedata->duration, animation->duration);
-
             data_offs = start + sizeof(CPAN) + cpan->base.size;
 
             std::string framename(frames->name);
             std::transform(framename.begin(), framename.end(),
                            framename.begin(), ::tolower);
 
-            animation->bones.insert({framename, bonedata});
+            auto bone = animation->addBone(framename, boneType, keyframes);
+            animation->duration = std::max(bone->duration, animation->duration);
         }
 
         data_offs = animstart + animroot->base.size;
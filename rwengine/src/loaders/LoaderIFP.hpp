@@ -11,6 +11,7 @@
 #include <glm/gtc/quaternion.hpp>
 
 #include <rw/forward.hpp>
+#include <rw/memorystats.hpp>
 
 struct AnimationKeyframe {
     glm::quat rotation{1.0f,0.0f,0.0f,0.0f};
@@ -30,19 +31,63 @@ struct AnimationKeyframe {
     AnimationKeyframe() = default;
 };
 
+/**
+ * A unit quaternion in 6 bytes, quantised with the smallest three method.
+ *
+ * The largest component is dropped and rebuilt from the other three, which
+ * are stored in 15 bits each. The top bits of the first two values hold the
+ * index of the dropped component.
+ */
+struct PackedRotation {
+    std::uint16_t data[3]{};
+
+    static PackedRotation pack(const glm::quat& q);
+    glm::quat unpack() const;
+};
+
+/**
+ * Keyframes of every bone in an animation, in one array per kind of data.
+ * Bones with the same key times share them.
+ */
+struct AnimationTracks {
+    std::vector<float> times;
+    std::vector<PackedRotation> rotations;
+    std::vector<glm::vec3> translations;
+    std::vector<glm::vec3> scales;
+
+    size_t getBytes() const;
+};
+
+/**
+ * A bone's keyframes, as offsets into the animation's tracks
+ */
 struct AnimationBone {
     std::string name;
-    int32_t previous;
-    int32_t next;
-    float duration;
+    float duration = 0.f;
 
     enum Data { R00, RT0, RTS };
 
-    Data type;
-    std::vector<AnimationKeyframe> frames;
+    Data type = R00;
+
+    const AnimationTracks* tracks = nullptr;
+    std::uint32_t keyframeCount = 0;
+    std::uint32_t timeOffset = 0;
+    std::uint32_t rotationOffset = 0;
+    /// Only used by RT0 and RTS bones
+    std::uint32_t translationOffset = 0;
+    /// Only used by RTS bones
+    std::uint32_t scaleOffset = 0;
+
+    bool empty() const {
+        return keyframeCount == 0;
+    }
+
+    /**
+     * @return The keyframe at index, decoded
+     */
+    AnimationKeyframe getKeyframe(size_t index) const;
 
-    AnimationKeyframe getInterpolatedKeyframe(float time);
-    AnimationKeyframe getKeyframe(float time);
+    AnimationKeyframe getInterpolatedKeyframe(float time) const;
 };
 
 /**
@@ -54,13 +99,37 @@ struct Animation {
     std::string name;
     std::map<std::string, AnimationBone*> bones;
 
+    Animation() = default;
+    Animation(const Animation&) = delete;
+    Animation& operator=(const Animation&) = delete;
+
     ~Animation() {
         for (auto &bone_pair : bones) {
             delete bone_pair.second;
         }
     }
 
-    float duration;
+    float duration = 0.f;
+
+    /// Storage for all of the bones
+    AnimationTracks tracks;
+
+    /// Bones and their keyframes
+    TrackedMemory<MemoryTag::Animations> memory;
+
+    /**
+     * Packs the keyframes into the tracks and adds a bone for them. Keyframes
+     * must be in time order.
+     * @return The new bone, or the existing one if the name is taken
+     */
+    AnimationBone* addBone(const std::string& boneName,
+                           AnimationBone::Data type,
+                           const std::vector<AnimationKeyframe>& keyframes);
+
+    /**
+     * @return Keyframes of all bones
+     */
+    size_t getKeyframeCount() const;
 };
 
 class LoaderIFP {
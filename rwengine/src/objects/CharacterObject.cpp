@@ -17,6 +17,7 @@
 #include "engine/GameData.hpp"
 #include "engine/GameState.hpp"
 #include "engine/GameWorld.hpp"
+#include "engine/WaterQueries.hpp"
 #include "loaders/LoaderIFP.hpp"
 #include "objects/VehicleObject.hpp"
 
@@ -300,6 +301,16 @@ void CharacterObject::tickPhysics(float dt) {
     }
 }
 
+void CharacterObject::queueWater(WaterQueries& water) {
+    if (physCharacter) {
+        auto pos =
+            physCharacter->getGhostObject()->getWorldTransform().getOrigin();
+        const auto query = water.queue(glm::vec3(pos.x(), pos.y(), pos.z()));
+        waterQueryBatch = query.batch;
+        waterQueryIndex = query.index;
+    }
+}
+
 void CharacterObject::setRotation(const glm::quat& orientation) {
     m_look.x = glm::roll(orientation);
     rotation = orientation;
@@ -311,9 +322,8 @@ void CharacterObject::changeCharacterModel(const std::string& name) {
     std::transform(modelName.begin(), modelName.end(), modelName.begin(),
                    ::tolower);
 
-    /// @todo don't model leak here
-
-    engine->data->loadTXD(modelName + ".txd");
+    // The materials hold on to the textures, the slot can be unloaded
+    engine->data->loadTXD(modelName + ".txd", false);
     auto newmodel = engine->data->loadClump(modelName + ".dff");
 
     if (animator) {
@@ -379,11 +389,11 @@ void CharacterObject::updateCharacter(float dt) {
         getClump()->getFrame()->setTranslation(position);
 
         // Handle above waist height water.
-        auto wi = engine->data->getWaterIndexAt(getPosition());
-        if (wi != NO_WATER_INDEX) {
-            float wh = engine->data->waterHeights[wi];
-            auto ws = getPosition();
-            wh += engine->data->getWaveHeightAt(ws);
+        auto ws = getPosition();
+        const auto water = engine->data->water.getResultOrSample(
+            {waterQueryBatch, waterQueryIndex}, 0, ws, engine->getGameTime());
+        if (water.water) {
+            float wh = water.height;
 
             // If Not in water before
             //  If last position was above water
@@ -434,6 +444,49 @@ void CharacterObject::setPosition(const glm::vec3& pos) {
     getClump()->getFrame()->setTranslation(pos);
 }
 
+void CharacterObject::makeDormant() {
+    if (currentVehicle) {
+        // The actor is kept, it is created again on respawn if it's missing
+        currentVehicle->setOccupant(currentSeat, nullptr);
+        currentVehicle = nullptr;
+        currentSeat = 0;
+    }
+
+    if (physCharacter) {
+        engine->dynamicsWorld->removeCollisionObject(physObject);
+        engine->dynamicsWorld->removeAction(physCharacter);
+    }
+}
+
+void CharacterObject::respawn(const glm::vec3& pos, const glm::quat& rot) {
+    currentState = CharacterState{};
+    movement = glm::vec3();
+    currenteMovementStep = glm::vec3();
+    running = false;
+    jumped = false;
+    jumpSpeed = DefaultJumpSpeed;
+    motionBlockedByActivity = false;
+    cycle_ = AnimCycle::Idle;
+    controller->reset();
+    if (animator) {
+        animator->clearAnimations();
+    }
+    setLifetime(GameObject::UnknownLifetime);
+
+    if (physCharacter) {
+        engine->dynamicsWorld->addCollisionObject(
+            physObject, btBroadphaseProxy::KinematicFilter,
+            btBroadphaseProxy::StaticFilter | btBroadphaseProxy::SensorTrigger);
+        engine->dynamicsWorld->addAction(physCharacter);
+        physCharacter->reset(engine->dynamicsWorld.get());
+    } else {
+        createActor();
+    }
+
+    setPosition(pos);
+    setRotation(rot);
+}
+
 bool CharacterObject::isPlayer() const {
     return engine->state->playerObject == getGameObjectID();
 }
@@ -523,7 +576,9 @@ bool CharacterObject::takeDamage(const GameObject::DamageInfo& dmg) {
     // Right now there's no state that determines immunity to any kind of damage
     float dmgPoints = dmg.hitpoints;
 
-    if (getCurrentVehicle()) {
+    // The vehicle shields its occupants from everything but explosions
+    if (getCurrentVehicle() &&
+        dmg.type != GameObject::DamageInfo::Explosion) {
         return false;
     }
 
@@ -698,8 +753,7 @@ void CharacterObject::useItem(bool active, bool primary) {
         if (primary) {
             if (!currentState.primaryActive && active) {
                 // If we've just started, activate
-                controller->setNextActivity(
-                    std::make_unique<Activities::UseItem>(item));
+                controller->setNextActivity<Activities::UseItem>(item);
             } else if (currentState.primaryActive && !active) {
                 // UseItem will cancel itself upon !primaryActive
             }
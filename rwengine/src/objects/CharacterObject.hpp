@@ -109,6 +109,12 @@ public:
 
     void tickPhysics(float dt);
 
+    /**
+     * Queues the point updateCharacter() checks against the water, where
+     * the physics step leaves the character
+     */
+    void queueWater(WaterQueries& water);
+
     const CharacterState& getCurrentState() const {
         return currentState;
     }
@@ -130,6 +136,18 @@ public:
 
     void setPosition(const glm::vec3& pos) override;
 
+    /**
+     * Leaves the current vehicle and removes the character from the dynamics
+     * world, so it can be kept for reuse
+     */
+    void makeDormant();
+
+    /**
+     * Returns a dormant character to the world with its initial state and
+     * a reset controller
+     */
+    void respawn(const glm::vec3& pos, const glm::quat& rot);
+
     bool isPlayer() const;
 
     bool isDying() const;
@@ -1,6 +1,7 @@
 #ifndef _RWENGINE_GAMEOBJECT_HPP_
 #define _RWENGINE_GAMEOBJECT_HPP_
 
+#include <cstdint>
 #include <limits>
 
 #include <glm/glm.hpp>
@@ -15,6 +16,7 @@
 
 class Animator;
 class GameWorld;
+class WaterQueries;
 
 /**
  * @brief Base data and interface for all world "objects" like vehicles, peds.
@@ -36,6 +38,12 @@ class GameObject {
 
 protected:
     void changeModelInfo(BaseModelInfo* next) {
+        if (next) {
+            next->addReference();
+        }
+        if (modelinfo_) {
+            modelinfo_->removeReference();
+        }
         modelinfo_ = next;
     }
 
@@ -54,6 +62,13 @@ public:
      */
     float _lastHeight = std::numeric_limits<float>::max();
 
+    /**
+     * Handle of the first point queued for this tick's water checks, see
+     * WaterQueries::Handle
+     */
+    std::uint32_t waterQueryBatch = 0;
+    std::uint32_t waterQueryIndex = 0;
+
     /**
      * Should object be rendered?
      */
@@ -140,6 +155,9 @@ public:
     const glm::quat& getRotation() const {
         return rotation;
     }
+    const glm::quat& getLastRotation() const {
+        return _lastRotation;
+    }
     virtual void setRotation(const glm::quat& orientation);
 
     float getHeading() const;
@@ -12,6 +12,7 @@
 #include "engine/Animator.hpp"
 #include "engine/GameData.hpp"
 #include "engine/GameWorld.hpp"
+#include "engine/WaterQueries.hpp"
 
 InstanceObject::InstanceObject(GameWorld* engine, const glm::vec3& pos,
                                const glm::quat& rot, const glm::vec3& scale,
@@ -77,25 +78,9 @@ void InstanceObject::tickPhysics(float dt) {
     // Only certain objects should float on water
     if (floating) {
         const glm::vec3& ws = getPosition();
-        auto wX = static_cast<int>((ws.x + WATER_WORLD_SIZE / 2.f) /
-                        (WATER_WORLD_SIZE / WATER_HQ_DATA_SIZE));
-        auto wY = static_cast<int>((ws.y + WATER_WORLD_SIZE / 2.f) /
-                        (WATER_WORLD_SIZE / WATER_HQ_DATA_SIZE));
-        float vH = ws.z;  // - _collisionHeight/2.f;
-        float wH = 0.f;
-
-        if (wX >= 0 && wX < WATER_HQ_DATA_SIZE && wY >= 0 &&
-            wY < WATER_HQ_DATA_SIZE) {
-            int i = (wX * WATER_HQ_DATA_SIZE) + wY;
-            int hI = engine->data->realWater[i];
-            if (hI < NO_WATER_INDEX) {
-                wH = engine->data->waterHeights[hI];
-                wH += engine->data->getWaveHeightAt(ws);
-                inWater = vH <= wH;
-            } else {
-                inWater = false;
-            }
-        }
+        const auto water = engine->data->water.getResultOrSample(
+            {waterQueryBatch, waterQueryIndex}, 0, ws, engine->getGameTime());
+        inWater = water.water && water.depth >= 0.f;
         _lastHeight = ws.z;
 
         if (inWater) {
@@ -105,34 +90,34 @@ void InstanceObject::tickPhysics(float dt) {
             // Damper motion
             body->getBulletBody()->setDamping(0.95f, 0.9f);
 
-            auto wi = engine->data->getWaterIndexAt(ws);
-            if (wi != NO_WATER_INDEX) {
-                float h = engine->data->waterHeights[wi] + oZ;
-
-                // Calculate wave height
-                h += engine->data->getWaveHeightAt(ws);
-
-                if (ws.z <= h) {
-                    float x = (h - ws.z);
-                    float F =
-                        WATER_BUOYANCY_K * x +
-                        -WATER_BUOYANCY_C *
-                            body->getBulletBody()->getLinearVelocity().z();
-                    btVector3 forcePos = btVector3(0.f, 0.f, 2.f)
-                                             .rotate(body->getBulletBody()
-                                                         ->getOrientation()
-                                                         .getAxis(),
-                                                     body->getBulletBody()
-                                                         ->getOrientation()
-                                                         .getAngle());
-                    body->getBulletBody()->applyImpulse(btVector3(0.f, 0.f, F),
-                                                        forcePos);
-                }
+            float h = water.height + oZ;
+            if (ws.z <= h) {
+                float x = (h - ws.z);
+                float F = WATER_BUOYANCY_K * x +
+                          -WATER_BUOYANCY_C *
+                              body->getBulletBody()->getLinearVelocity().z();
+                btVector3 forcePos = btVector3(0.f, 0.f, 2.f)
+                                         .rotate(body->getBulletBody()
+                                                     ->getOrientation()
+                                                     .getAxis(),
+                                                 body->getBulletBody()
+                                                     ->getOrientation()
+                                                     .getAngle());
+                body->getBulletBody()->applyImpulse(btVector3(0.f, 0.f, F),
+                                                    forcePos);
             }
         }
     }
 }
 
+void InstanceObject::queueWater(WaterQueries& water) {
+    if (floating && body && dynamics) {
+        const auto query = water.queue(getPosition());
+        waterQueryBatch = query.batch;
+        waterQueryIndex = query.index;
+    }
+}
+
 void InstanceObject::changeModel(BaseModelInfo* incoming, int atomicNumber) {
     if (body) {
         body.reset();
@@ -52,6 +52,11 @@ public:
 
     void tickPhysics(float dt);
 
+    /**
+     * Queues the points tickPhysics() checks against the water
+     */
+    void queueWater(WaterQueries& water);
+
     void changeModel(BaseModelInfo* incoming, int atomicNumber = 0);
 
     void setPosition(const glm::vec3& pos) override;
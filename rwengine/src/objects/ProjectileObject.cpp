@@ -57,24 +57,8 @@ void ProjectileObject::explode() {
         const float damageSize = 5.f;
         const float damage = _info.weapon->damage;
 
-        for (auto& o : engine->allObjects) {
-            if (o == this) continue;
-            switch (o->type()) {
-                case GameObject::Instance:
-                case GameObject::Vehicle:
-                case GameObject::Character:
-                    break;
-                default:
-                    continue;
-            }
-
-            float d = glm::distance(getPosition(), o->getPosition());
-            if (d > damageSize) continue;
-
-            o->takeDamage({getPosition(), getPosition(),
-                           damage / glm::max(d, 1.f), DamageInfo::Explosion,
-                           0.f});
-        }
+        engine->doWeaponScan(
+            WeaponScan(damage, getPosition(), damageSize, _info.weapon));
 
         auto& explosion = engine->createParticleEffect();
 
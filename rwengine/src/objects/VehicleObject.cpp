@@ -496,37 +496,30 @@ void VehicleObject::tickPhysics(float dt) {
         }
 
         const auto& ws = getPosition();
-        auto wX = static_cast<int>((ws.x + WATER_WORLD_SIZE / 2.f) /
-                        (WATER_WORLD_SIZE / WATER_HQ_DATA_SIZE));
-        auto wY = static_cast<int>((ws.y + WATER_WORLD_SIZE / 2.f) /
-                        (WATER_WORLD_SIZE / WATER_HQ_DATA_SIZE));
+        const auto& water = engine->data->water;
+        const auto time = engine->getGameTime();
         btVector3 bbmin, bbmax;
         // This is in world space.
         collision->getBulletBody()->getAabb(bbmin, bbmax);
         float vH = bbmin.z();
-        float wH = 0.f;
-
-        if (wX >= 0 && wX < WATER_HQ_DATA_SIZE && wY >= 0 &&
-            wY < WATER_HQ_DATA_SIZE) {
-            int i = (wX * WATER_HQ_DATA_SIZE) + wY;
-            int hI = engine->data->realWater[i];
-            if (hI < NO_WATER_INDEX) {
-                wH = engine->data->waterHeights[hI];
-                wH += engine->data->getWaveHeightAt(ws);
-                // If the vehicle is currently underwater
-                if (vH <= wH) {
-                    // and was not underwater here in the last tick
-                    if (_lastHeight >= wH) {
-                        // we are for real, underwater
-                        inWater = true;
-                    }
-                } else {
-                    // The water is beneath us
-                    inWater = false;
+
+        const WaterQueries::Handle query{waterQueryBatch, waterQueryIndex};
+        const auto surface = water.getResultOrSample(query, 0, ws, time);
+        if (surface.water) {
+            float wH = surface.height;
+            // If the vehicle is currently underwater
+            if (vH <= wH) {
+                // and was not underwater here in the last tick
+                if (_lastHeight >= wH) {
+                    // we are for real, underwater
+                    inWater = true;
                 }
             } else {
+                // The water is beneath us
                 inWater = false;
             }
+        } else {
+            inWater = false;
         }
 
         auto isBoat = getVehicle()->vehicletype_ == VehicleModelInfo::BOAT;
@@ -536,40 +529,18 @@ void VehicleObject::tickPhysics(float dt) {
                 collision->getBulletBody()->activate(true);
             }
 
-            float bbZ = info->handling.dimensions.z / 2.f;
-
-            float oZ =
-                -bbZ / 2.f + (bbZ * (info->handling.percentSubmerged / 120.f));
-
-            if (isBoat) {
-                oZ = 0.f;
-            } else {
+            if (!isBoat) {
                 // Damper motion
                 collision->getBulletBody()->setDamping(0.95f, 0.9f);
             }
 
-            // Boats, Buoyancy offset is affected by the orientation of the
-            // chassis.
-            // Vehicles, it isn't.
-            glm::vec3 vFwd =
-                          glm::vec3(0.f, info->handling.dimensions.y / 2.f, oZ),
-                      vBack = glm::vec3(0.f, -info->handling.dimensions.y / 2.f,
-                                        oZ);
-            glm::vec3 vRt =
-                          glm::vec3(info->handling.dimensions.x / 2.f, 0.f, oZ),
-                      vLeft = glm::vec3(-info->handling.dimensions.x / 2.f, 0.f,
-                                        oZ);
-
-            vFwd = getRotation() * vFwd;
-            vBack = getRotation() * vBack;
-            vRt = getRotation() * vRt;
-            vLeft = getRotation() * vLeft;
-
-            // This function will try to keep v* at the water level.
-            applyWaterFloat(vFwd);
-            applyWaterFloat(vBack);
-            applyWaterFloat(vRt);
-            applyWaterFloat(vLeft);
+            // This function will try to keep the points at the water level.
+            const auto points = getWaterFloatPoints();
+            for (auto i = 0u; i < points.size(); ++i) {
+                applyWaterFloat(points[i],
+                                water.getResultOrSample(query, i + 1,
+                                                        ws + points[i], time));
+            }
         } else {
             if (isBoat) {
                 collision->getBulletBody()->setDamping(0.1f, 0.8f);
@@ -784,23 +755,48 @@ void VehicleObject::setPartState(VehicleObject::Part* part,
     }
 }
 
-void VehicleObject::applyWaterFloat(const glm::vec3& relPt) {
+void VehicleObject::queueWater(WaterQueries& water) {
+    if (!physVehicle) {
+        return;
+    }
+    const auto& ws = getPosition();
+    const auto query = water.queue(ws);
+    waterQueryBatch = query.batch;
+    waterQueryIndex = query.index;
+    for (const auto& point : getWaterFloatPoints()) {
+        water.queue(ws + point);
+    }
+}
+
+std::array<glm::vec3, 4> VehicleObject::getWaterFloatPoints() const {
+    float bbZ = info->handling.dimensions.z / 2.f;
+
+    float oZ = -bbZ / 2.f + (bbZ * (info->handling.percentSubmerged / 120.f));
+
+    if (getVehicle()->vehicletype_ == VehicleModelInfo::BOAT) {
+        oZ = 0.f;
+    }
+
+    // Boats, Buoyancy offset is affected by the orientation of the
+    // chassis.
+    // Vehicles, it isn't.
+    const auto& dimensions = info->handling.dimensions;
+    return {{getRotation() * glm::vec3(0.f, dimensions.y / 2.f, oZ),
+             getRotation() * glm::vec3(0.f, -dimensions.y / 2.f, oZ),
+             getRotation() * glm::vec3(dimensions.x / 2.f, 0.f, oZ),
+             getRotation() * glm::vec3(-dimensions.x / 2.f, 0.f, oZ)}};
+}
+
+void VehicleObject::applyWaterFloat(const glm::vec3& relPt,
+                                    const WaterQueries::Result& water) {
     auto ws = getPosition() + relPt;
-    auto wi = engine->data->getWaterIndexAt(ws);
-    if (wi != NO_WATER_INDEX) {
-        float h = engine->data->waterHeights[wi];
-
-        // Calculate wave height
-        h += engine->data->getWaveHeightAt(ws);
-
-        if (ws.z <= h) {
-            float x = (h - ws.z);
-            float F = WATER_BUOYANCY_K * x +
-                      -WATER_BUOYANCY_C *
-                          collision->getBulletBody()->getLinearVelocity().z();
-            collision->getBulletBody()->applyImpulse(
-                btVector3(0.f, 0.f, F), btVector3(relPt.x, relPt.y, relPt.z));
-        }
+    if (water.water && ws.z <= water.height) {
+        float x = (water.height - ws.z);
+        float F = WATER_BUOYANCY_K * x +
+                  -WATER_BUOYANCY_C *
+                      collision->getBulletBody()->getLinearVelocity().z();
+        collision->getBulletBody()->applyImpulse(
+            btVector3(0.f, 0.f, F), btVector3(relPt.x, relPt.y, relPt.z));
     }
 }
 
@@ -964,6 +960,44 @@ void VehicleObject::destroyObjectHinge(Part* part) {
     part->moveToAngle = false;
 }
 
+void VehicleObject::makeDormant() {
+    ejectAll();
+
+    for (auto& p : dynamicParts) {
+        setPartLocked(&p.second, true);
+        setPartState(&p.second, OK);
+    }
+
+    engine->dynamicsWorld->removeAction(physVehicle);
+    collision->removeFromWorld();
+}
+
+void VehicleObject::respawn(const glm::vec3& pos, const glm::quat& rot,
+                            const glm::u8vec3& prim, const glm::u8vec3& sec) {
+    health = 1000.f;
+    steerAngle = 0.f;
+    throttle = 0.f;
+    brake = 0.f;
+    handbrake = true;
+    std::fill(wheelsRotation.begin(), wheelsRotation.end(), 0.f);
+    colourPrimary = prim;
+    colourSecondary = sec;
+    mHasSpecial = true;
+    setLifetime(GameObject::UnknownLifetime);
+
+    auto body = collision->getBulletBody();
+    body->setLinearVelocity(btVector3(0.f, 0.f, 0.f));
+    body->setAngularVelocity(btVector3(0.f, 0.f, 0.f));
+    body->clearForces();
+    setPosition(pos);
+    setRotation(rot);
+    body->setInterpolationWorldTransform(body->getWorldTransform());
+
+    collision->addToWorld();
+    engine->dynamicsWorld->addAction(physVehicle);
+    physVehicle->resetSuspension();
+}
+
 void VehicleObject::setPrimaryColour(uint8_t color) {
     colourPrimary = engine->data->vehicleColours[color];
 }
@@ -1,6 +1,7 @@
 #ifndef _RWENGINE_VEHICLEOBJECT_HPP_
 #define _RWENGINE_VEHICLEOBJECT_HPP_
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <map>
@@ -12,6 +13,7 @@
 #include <glm/gtc/quaternion.hpp>
 
 #include <data/ModelData.hpp>
+#include <engine/WaterQueries.hpp>
 #include <objects/GameObject.hpp>
 #include <objects/VehicleInfo.hpp>
 
@@ -128,6 +130,11 @@ public:
 
     void tickPhysics(float dt);
 
+    /**
+     * Queues the points tickPhysics() checks against the water
+     */
+    void queueWater(WaterQueries& water);
+
     bool isFlipped() const;
 
     bool isUpright() const;
@@ -183,7 +190,13 @@ public:
 
     Part* getPart(const std::string& name);
 
-    void applyWaterFloat(const glm::vec3& relPt);
+    /**
+     * Pushes a point of the vehicle towards the water surface
+     * @param relPt Point relative to the vehicle's position
+     * @param water The water at that point
+     */
+    void applyWaterFloat(const glm::vec3& relPt,
+                         const WaterQueries::Result& water);
 
     void setPrimaryColour(uint8_t color);
     void setSecondaryColour(uint8_t color);
@@ -217,7 +230,25 @@ public:
 
     void grantOccupantRewards(CharacterObject* character);
 
+    /**
+     * Ejects the occupants, restores the parts and removes the vehicle from
+     * the dynamics world, so it can be kept for reuse
+     */
+    void makeDormant();
+
+    /**
+     * Returns a dormant vehicle to the dynamics world as if it was new
+     */
+    void respawn(const glm::vec3& pos, const glm::quat& rot,
+                 const glm::u8vec3& prim, const glm::u8vec3& sec);
+
 private:
+    /**
+     * Points on the chassis that are kept at the water level, relative to
+     * the vehicle's position
+     */
+    std::array<glm::vec3, 4> getWaterFloatPoints() const;
+
     void setupModel();
     void registerPart(ModelFrame* mf);
     void createObjectHinge(Part* part);
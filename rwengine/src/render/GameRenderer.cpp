@@ -1,6 +1,7 @@
 #include "render/GameRenderer.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cmath>
 #include <string>
@@ -32,6 +33,14 @@ constexpr uint32_t kMissingTextureBytes[] = {
     0xFFFF00FF, 0xFF0000FF, 0xFFFF00FF, 0xFF0000FF,
 };
 
+namespace {
+using Clock = std::chrono::steady_clock;
+
+float getMilliseconds(Clock::duration duration) {
+    return std::chrono::duration<float, std::milli>(duration).count();
+}
+}  // namespace
+
 /// @todo collapse all of these into "VertPNC" etc.
 struct ParticleVert {
     static const AttributeList vertex_attributes() {
@@ -190,11 +199,12 @@ void GameRenderer::setupRender() {
 }
 
 void GameRenderer::renderWorld(GameWorld* world, const ViewCamera& camera,
-                               float alpha) {
+                               float alpha, const RenderSnapshot* snapshot) {
     const auto& state = world->state;
 
     _renderAlpha = alpha;
     _renderWorld = world;
+    _renderSnapshot = snapshot;
 
     // Store the input camera,
     _camera = camera;
@@ -262,10 +272,12 @@ void GameRenderer::renderWorld(GameWorld* world, const ViewCamera& camera,
     renderList.reserve(world->allObjects.size() * 0.5f);
 
     RW_PROFILE_BEGIN("Build");
+    const auto buildStart = Clock::now();
 
     ObjectRenderer objectRenderer(_renderWorld,
                                   (cullOverride ? cullingCamera : _camera),
-                                  _renderAlpha, getMissingTexture());
+                                  _renderAlpha, getMissingTexture(),
+                                  _renderSnapshot);
 
     // World Objects
     for (auto object : world->allObjects) {
@@ -312,6 +324,7 @@ void GameRenderer::renderWorld(GameWorld* world, const ViewCamera& camera,
     }
 
     RW_PROFILE_END();
+    const auto sortStart = Clock::now();
     culled += objectRenderer.culled;
     renderer->pushDebugGroup("Objects");
     renderer->pushDebugGroup("RenderList");
@@ -327,6 +340,7 @@ void GameRenderer::renderWorld(GameWorld* world, const ViewCamera& camera,
                     return (a.sortKey > b.sortKey);
               });
     RW_PROFILE_END();
+    const auto submitStart = Clock::now();
     RW_PROFILE_BEGIN("Draw");
     renderer->drawBatched(renderList);
     RW_PROFILE_END();
@@ -390,6 +404,11 @@ void GameRenderer::renderWorld(GameWorld* world, const ViewCamera& camera,
     }
 
     renderPostProcess();
+
+    const auto end = Clock::now();
+    worldTimings.cull = getMilliseconds(sortStart - buildStart);
+    worldTimings.sort = getMilliseconds(submitStart - sortStart);
+    worldTimings.submit = getMilliseconds(end - submitStart);
 }
 
 void GameRenderer::renderSplash(GameWorld* world, GLuint splashTexName, glm::u16vec3 fc) {
@@ -508,6 +527,9 @@ void GameRenderer::drawColour(const glm::vec4& colour, glm::vec4 extents) {
 }
 
 void GameRenderer::drawRect(const glm::vec4& colour, TextureData* texture, glm::vec4& extents) {
+    // Text queued earlier goes underneath
+    text.flush();
+
     // Move into NDC
     extents.x /= renderer->getViewport().x;
     extents.y /= renderer->getViewport().y;
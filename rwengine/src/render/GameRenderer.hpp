@@ -21,6 +21,7 @@
 class Logger;
 class GameData;
 class GameWorld;
+class RenderSnapshot;
 class TextureData;
 
 /**
@@ -42,6 +43,7 @@ class GameRenderer {
     // Temporary variables used during rendering
     float _renderAlpha{0.f};
     GameWorld* _renderWorld = nullptr;
+    const RenderSnapshot* _renderSnapshot = nullptr;
 
     /** Internal non-descript VAOs */
     GLuint vao;
@@ -96,6 +98,21 @@ public:
         return culled;
     }
 
+    /**
+     * CPU time spent in the phases of renderWorld(), in milliseconds
+     */
+    struct WorldTimings {
+        /// Building the render list, which culls objects
+        float cull = 0.f;
+        float sort = 0.f;
+        /// Issuing the draws for objects, water, sky and effects
+        float submit = 0.f;
+    };
+
+    const WorldTimings& getWorldTimings() const {
+        return worldTimings;
+    }
+
     /**
      * Renders the world using the parameters of the passed Camera.
      * Note: The camera's near and far planes are overriden by weather effects.
@@ -104,8 +121,11 @@ public:
      *  - draws particles
      *  - draws water surfaces
      *  - draws the skybox
+     *
+     * Moving objects are drawn alpha of the way through the snapshot's tick
      */
-    void renderWorld(GameWorld* world, const ViewCamera& camera, float alpha);
+    void renderWorld(GameWorld* world, const ViewCamera& camera, float alpha,
+                     const RenderSnapshot* snapshot = nullptr);
 
     /**
      * Renders the effects (Particles, Lighttrails etc)
@@ -167,6 +187,9 @@ public:
 private:
     /// Hard-coded models to use for each of the special models
     ClumpPtr specialmodels_[SpecialModel::SpecialModelCount];
+
+    WorldTimings worldTimings;
+
     ClumpPtr getSpecialModel(SpecialModel usage) const {
         return specialmodels_[usage];
     }
@@ -12,6 +12,7 @@
 #include "engine/GameData.hpp"
 #include "engine/GameState.hpp"
 #include "engine/GameWorld.hpp"
+#include "render/RenderSnapshot.hpp"
 #include "render/ViewCamera.hpp"
 
 // Objects that we know how to turn into renderlist entries
@@ -199,13 +200,20 @@ void ObjectRenderer::renderInstance(InstanceObject* instance,
     }
 
     // Render the atomic the instance thinks it should be
-    renderAtomic(atomic.get(), glm::mat4(1.0f), instance, outList);
+    renderAtomic(atomic.get(), getInterpolation(instance), instance, outList);
 }
 
 void ObjectRenderer::renderCharacter(CharacterObject* pedestrian,
                                      RenderList& outList) {
     const auto& clump = pedestrian->getClump();
 
+    // Passengers move with their vehicle
+    GameObject* mover = pedestrian;
+    if (pedestrian->getCurrentVehicle()) {
+        mover = pedestrian->getCurrentVehicle();
+    }
+    const auto interpolation = getInterpolation(mover);
+
     if (pedestrian->getCurrentVehicle()) {
         auto vehicle = pedestrian->getCurrentVehicle();
         const auto& vehicleclump = vehicle->getClump();
@@ -224,7 +232,7 @@ void ObjectRenderer::renderCharacter(CharacterObject* pedestrian,
         }
     }
 
-    renderClump(pedestrian->getClump().get(), glm::mat4(1.0f), nullptr,
+    renderClump(pedestrian->getClump().get(), interpolation, nullptr,
                 outList);
 
     auto item = pedestrian->getActiveItem();
@@ -240,7 +248,8 @@ void ObjectRenderer::renderCharacter(CharacterObject* pedestrian,
             m_world->data->findModelInfo<SimpleModelInfo>(weapon->modelID);
         RW_CHECK(simple, "Failed to read modelinfo using " << weapon->modelID);
         auto itematomic = simple->getAtomic(0);
-        renderAtomic(itematomic, handFrame->getWorldTransform(), nullptr,
+        renderAtomic(itematomic,
+                     interpolation * handFrame->getWorldTransform(), nullptr,
                      outList);
     }
 }
@@ -266,7 +275,8 @@ void ObjectRenderer::renderVehicle(VehicleObject* vehicle,
         vehicle->getLowLOD()->setFlag(Atomic::ATOMIC_RENDER, !highLOD);
     }
 
-    renderClump(clump.get(), glm::mat4(1.0f), vehicle, outList);
+    const auto interpolation = getInterpolation(vehicle);
+    renderClump(clump.get(), interpolation, vehicle, outList);
 
     auto modelinfo = vehicle->getVehicle();
     auto woi =
@@ -295,7 +305,8 @@ void ObjectRenderer::renderVehicle(VehicleObject* vehicle,
                 wi.m_wheelDirectionCS * wi.m_raycastInfo.m_suspensionLength);
         glm::mat4 wheelM{1.0f};
         t.getOpenGLMatrix(glm::value_ptr(wheelM));
-        wheelM = clump->getFrame()->getWorldTransform() * wheelM;
+        wheelM =
+            interpolation * clump->getFrame()->getWorldTransform() * wheelM;
         wheelM = glm::scale(wheelM, glm::vec3(modelinfo->wheelscale_));
         if (wi.m_chassisConnectionPointCS.x() < 0.f) {
             wheelM = glm::scale(wheelM, glm::vec3(-1.f, 1.f, 1.f));
@@ -355,6 +366,11 @@ void ObjectRenderer::renderProjectile(ProjectileObject* projectile,
     renderAtomic(atomic, modelMatrix, nullptr, outList);
 }
 
+glm::mat4 ObjectRenderer::getInterpolation(const GameObject* object) const {
+    return m_snapshot ? m_snapshot->getInterpolation(object, m_renderAlpha)
+                      : glm::mat4(1.0f);
+}
+
 void ObjectRenderer::buildRenderList(GameObject* object, RenderList& outList) {
     // Right now specialized on each object type
     switch (object->type()) {
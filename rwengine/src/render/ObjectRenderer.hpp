@@ -22,6 +22,7 @@ class GameWorld;
 class InstanceObject;
 class PickupObject;
 class ProjectileObject;
+class RenderSnapshot;
 class VehicleObject;
 class ViewCamera;
 struct Geometry;
@@ -34,12 +35,18 @@ struct Geometry;
  */
 class ObjectRenderer {
 public:
+    /**
+     * @param snapshot Interpolates moving objects by renderAlpha, they are
+     * drawn where they are without one
+     */
     ObjectRenderer(GameWorld* world, const ViewCamera& camera,
-                   float renderAlpha, GLuint errorTexture)
+                   float renderAlpha, GLuint errorTexture,
+                   const RenderSnapshot* snapshot = nullptr)
         : m_world(world)
         , m_camera(camera)
         , m_renderAlpha(renderAlpha)
-        , m_errorTexture(errorTexture) {
+        , m_errorTexture(errorTexture)
+        , m_snapshot(snapshot) {
     }
 
     /**
@@ -75,6 +82,9 @@ private:
     const ViewCamera& m_camera;
     float m_renderAlpha;
     GLuint m_errorTexture;
+    const RenderSnapshot* m_snapshot;
+
+    glm::mat4 getInterpolation(const GameObject* object) const;
 
     void renderInstance(InstanceObject* instance, RenderList& outList);
     void renderCharacter(CharacterObject* pedestrian, RenderList& outList);
@@ -13,6 +13,7 @@
 
 #include <gl/gl_core_3_3.h>
 #include <gl/GeometryBuffer.hpp>
+#include <rw/arena.hpp>
 
 class DrawBuffer;
 
@@ -126,7 +127,8 @@ public:
             : sortKey(key), model(model), dbuff(dbuff), drawInfo(dp) {
         }
     };
-    typedef std::vector<RenderInstruction> RenderList;
+    /// Rebuilt every frame, so it lives in the frame arena
+    typedef FrameVector<RenderInstruction> RenderList;
 
     struct ObjectUniformData {
         glm::mat4 model{1.0f};
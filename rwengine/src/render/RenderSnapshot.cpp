@@ -0,0 +1,77 @@
+#include "render/RenderSnapshot.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "objects/GameObject.hpp"
+
+namespace {
+glm::mat4 getTransform(const glm::vec3& position, const glm::quat& rotation) {
+    return glm::translate(glm::mat4(1.f), position) * glm::mat4_cast(rotation);
+}
+}  // namespace
+
+void RenderSnapshot::capture(const std::vector<GameObject*>& objects) {
+    ++currentCapture;
+    objectCount = 0;
+    for (auto object : objects) {
+        const auto& position = object->getPosition();
+        const auto& rotation = object->getRotation();
+        const auto& lastPosition = object->getLastPosition();
+        const auto& lastRotation = object->getLastRotation();
+        if (position == lastPosition && rotation == lastRotation) {
+            continue;
+        }
+
+        const auto type = static_cast<size_t>(object->type());
+        if (type >= slots.size()) {
+            slots.resize(type + 1);
+        }
+        auto& typeSlots = slots[type];
+        const auto id = object->getGameObjectID();
+        if (id >= typeSlots.size()) {
+            typeSlots.resize(id + 1);
+        }
+        auto& slot = typeSlots[id];
+        slot.object = object;
+        slot.capture = currentCapture;
+        slot.state = {lastPosition, lastRotation, position, rotation};
+        ++objectCount;
+    }
+}
+
+void RenderSnapshot::clear() {
+    slots.clear();
+    objectCount = 0;
+}
+
+const RenderSnapshot::ObjectState* RenderSnapshot::find(
+    const GameObject* object) const {
+    const auto type = static_cast<size_t>(object->type());
+    if (type >= slots.size()) {
+        return nullptr;
+    }
+    const auto& typeSlots = slots[type];
+    const auto id = object->getGameObjectID();
+    if (id >= typeSlots.size()) {
+        return nullptr;
+    }
+    const auto& slot = typeSlots[id];
+    if (slot.object != object || slot.capture != currentCapture) {
+        return nullptr;
+    }
+    return &slot.state;
+}
+
+glm::mat4 RenderSnapshot::getInterpolation(const GameObject* object,
+                                           float alpha) const {
+    auto state = find(object);
+    if (!state || alpha >= 1.f) {
+        return glm::mat4(1.f);
+    }
+
+    auto interpolated =
+        getTransform(glm::mix(state->lastPosition, state->position, alpha),
+                     glm::slerp(state->lastRotation, state->rotation, alpha));
+    return interpolated *
+           glm::inverse(getTransform(state->position, state->rotation));
+}
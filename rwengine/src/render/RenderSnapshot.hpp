@@ -0,0 +1,71 @@
+#ifndef _RWENGINE_RENDERSNAPSHOT_HPP_
+#define _RWENGINE_RENDERSNAPSHOT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+class GameObject;
+
+/**
+ * Where every moving object was at the start and end of the last tick.
+ *
+ * Captured once the simulation has caught up for a frame. Objects are drawn
+ * between the two by the fraction of a tick left in the accumulator, so
+ * their motion is smooth however the frame rate and tick rate line up.
+ * Objects that didn't move, or were created since, aren't in the snapshot
+ * and are drawn where they are.
+ *
+ * States are stored by pool slot, the object's type and GameObjectID, so
+ * capturing a frame reuses the storage of the previous one. Objects must
+ * have been given an ID by their pool.
+ */
+class RenderSnapshot {
+public:
+    struct ObjectState {
+        glm::vec3 lastPosition{};
+        glm::quat lastRotation{};
+        glm::vec3 position{};
+        glm::quat rotation{};
+    };
+
+    /**
+     * Replaces the snapshot with the objects' last and current transforms
+     */
+    void capture(const std::vector<GameObject*>& objects);
+
+    void clear();
+
+    /**
+     * @return The object's state, or nullptr if it didn't move
+     */
+    const ObjectState* find(const GameObject* object) const;
+
+    /**
+     * @return Transform that moves the object from where it is to where it
+     * was at alpha through the last tick
+     */
+    glm::mat4 getInterpolation(const GameObject* object, float alpha) const;
+
+    size_t getObjectCount() const {
+        return objectCount;
+    }
+
+private:
+    struct Slot {
+        const GameObject* object = nullptr;
+        /// Capture the state was recorded in, older states are stale
+        std::uint32_t capture = 0;
+        ObjectState state;
+    };
+
+    /// Slots of each object type, indexed by GameObjectID
+    std::vector<std::vector<Slot>> slots;
+    std::uint32_t currentCapture = 0;
+    size_t objectCount = 0;
+};
+
+#endif
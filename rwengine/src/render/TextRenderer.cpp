@@ -4,6 +4,7 @@
 #include <cctype>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iterator>
 #include <vector>
 
@@ -42,11 +43,10 @@ out vec2 TexCoord;
 out vec3 Colour;
 
 uniform mat4 proj;
-uniform vec2 alignment;
 
 void main()
 {
-    gl_Position = proj * vec4(alignment + position, 0.0, 1.0);
+    gl_Position = proj * vec4(position, 0.0, 1.0);
     TexCoord = texcoord;
     Colour = colour;
 })";
@@ -120,28 +120,6 @@ constexpr std::array<std::uint8_t, 193> fontWidthsArial = {
 
 }
 
-struct TextVertex {
-    glm::vec2 position;
-    glm::vec2 texcoord;
-    glm::vec3 colour;
-
-    TextVertex(glm::vec2 _position, glm::vec2 _texcoord, glm::vec3 _colour)
-        : position(_position)
-        , texcoord(_texcoord)
-        , colour(_colour) {
-    }
-
-    TextVertex() = default;
-
-    static const AttributeList vertex_attributes() {
-        return {
-            {ATRS_Position, 2, sizeof(TextVertex), 0ul},
-            {ATRS_TexCoord, 2, sizeof(TextVertex), 0ul + sizeof(glm::vec2)},
-            {ATRS_Colour, 3, sizeof(TextVertex), 0ul + sizeof(glm::vec2) * 2},
-        };
-    }
-};
-
 TextRenderer::TextRenderer(GameRenderer* renderer) : renderer(renderer) {
     textShader = renderer->getRenderer()->createShader(TextVertexShader,
                                                        TextFragmentShader);
@@ -182,32 +160,69 @@ void TextRenderer::setFontTexture(font_t font, const std::string& textureName) {
     };
 }
 
-void TextRenderer::renderText(const TextRenderer::TextInfo& ti,
-                              bool forceColour) {
-    if (ti.text.empty() || ti.text[0] == '*')
-        return;
+bool TextRenderer::LayoutCache::Entry::matches(const TextInfo& ti,
+                                               bool forceColour) const {
+    return font == ti.font && text == ti.text && size == ti.size &&
+           wrapX == ti.wrapX && baseColour == ti.baseColour &&
+           this->forceColour == forceColour;
+}
 
-    renderer->getRenderer()->pushDebugGroup("Text");
-    renderer->getRenderer()->useProgram(textShader.get());
+size_t TextRenderer::LayoutCache::hashText(const TextInfo& ti,
+                                          bool forceColour) {
+    size_t hash = 0;
+    auto combine = [&](size_t value) {
+        hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    };
+    for (auto c : ti.text) {
+        combine(c);
+    }
+    combine(ti.font);
+    combine(std::hash<float>()(ti.size));
+    combine(static_cast<size_t>(ti.wrapX));
+    combine(static_cast<size_t>(ti.baseColour.r << 16 |
+                                ti.baseColour.g << 8 | ti.baseColour.b));
+    combine(forceColour ? 1 : 0);
+    return hash;
+}
+
+const TextRenderer::TextLayout& TextRenderer::LayoutCache::get(
+    const TextInfo& ti, const FontMetaData& font, bool forceColour) {
+    const auto key = hashText(ti, forceColour);
+    auto range = layouts.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.matches(ti, forceColour)) {
+            return it->second.layout;
+        }
+    }
+
+    if (layouts.size() >= kMaxLayouts) {
+        layouts.clear();
+    }
+    return layouts
+        .emplace(key, Entry{ti.font, ti.text, ti.size, ti.wrapX,
+                            ti.baseColour, forceColour,
+                            layoutText(ti, font, forceColour)})
+        ->second.layout;
+}
+
+TextRenderer::TextLayout TextRenderer::layoutText(
+    const TextInfo& ti, const FontMetaData& fontMetaData, bool forceColour) {
+    TextLayout layout;
 
     glm::vec2 coord(0.f, 0.f);
-    glm::vec2 alignment = ti.screenPosition;
     // We should track real size not just chars.
     auto lineLength = 0;
 
     glm::vec2 ss(ti.size);
 
     glm::vec3 colour = glm::vec3(ti.baseColour) * (1 / 255.f);
-    glm::vec4 colourBG = glm::vec4(ti.backgroundColour) * (1 / 255.f);
-    std::vector<TextVertex> geo;
+    auto& geo = layout.vertices;
 
     float maxWidth = 0.f;
     float maxHeight = ss.y;
 
     auto text = ti.text;
 
-    const auto &fontMetaData = fonts[ti.font];
-
     for (size_t i = 0; i < text.length(); ++i) {
         char16_t c = text[i];
 
@@ -321,39 +336,85 @@ void TextRenderer::renderText(const TextRenderer::TextInfo& ti,
         geo.emplace_back(glm::vec2{p.x + ss.x, p.y + ss.y}, glm::vec2{tex.z, tex.w}, colour);
     }
 
+    layout.extents = glm::vec2(maxWidth, maxHeight);
+    layout.glyphSize = ss;
+    return layout;
+}
+
+void TextRenderer::renderText(const TextRenderer::TextInfo& ti,
+                              bool forceColour) {
+    if (ti.text.empty() || ti.text[0] == '*')
+        return;
+
+    const auto& layout = layouts.get(ti, fonts[ti.font], forceColour);
+
+    glm::vec2 alignment = ti.screenPosition;
     if (ti.align == TextInfo::TextAlignment::Right) {
-        alignment.x -= maxWidth;
+        alignment.x -= layout.extents.x;
     } else if (ti.align == TextInfo::TextAlignment::Center) {
-        alignment.x -= (maxWidth / 2.f);
+        alignment.x -= (layout.extents.x / 2.f);
     }
 
     alignment.y -= ti.size * 0.2f;
 
-    // If we need to, draw the background.
+    // If we need to, draw the background. This flushes the text before it.
+    glm::vec4 colourBG = glm::vec4(ti.backgroundColour) * (1 / 255.f);
     if (colourBG.a > 0.f) {
+        const auto& ss = layout.glyphSize;
         renderer->drawColour(
             colourBG, glm::vec4(ti.screenPosition - (ss / 3.f),
-                                glm::vec2(maxWidth, maxHeight) + (ss / 2.f)));
+                                layout.extents + (ss / 2.f)));
+    }
+
+    auto& geo = queued[ti.font];
+    for (const auto& vertex : layout.vertices) {
+        geo.emplace_back(vertex.position + alignment, vertex.texcoord,
+                         vertex.colour);
+    }
+}
+
+void TextRenderer::flush() {
+    frameVertices.clear();
+    for (const auto& geo : queued) {
+        frameVertices.insert(frameVertices.end(), geo.begin(), geo.end());
+    }
+    if (frameVertices.empty()) {
+        return;
     }
 
+    renderer->getRenderer()->pushDebugGroup("Text");
+    renderer->getRenderer()->useProgram(textShader.get());
+
     renderer->getRenderer()->setUniform(
         textShader.get(), "proj", renderer->getRenderer()->get2DProjection());
     renderer->getRenderer()->setUniformTexture(textShader.get(), "fontTexture", 0);
-    renderer->getRenderer()->setUniform(textShader.get(), "alignment", alignment);
 
-    gb.uploadVertices(geo);
+    gb.uploadVertices(frameVertices);
     db.addGeometry(&gb);
     db.setFaceType(GL_TRIANGLES);
 
     Renderer::DrawParameters dp;
-    dp.start = 0;
     dp.blendMode = BlendMode::BLEND_ALPHA;
-    dp.count = gb.getCount();
-    auto ftexture = renderer->getData()->findSlotTexture("fonts", fontMetaData.textureName);
-    dp.textures = {ftexture->getName()};
     dp.depthMode = DepthMode::OFF;
 
-    renderer->getRenderer()->drawArrays(glm::mat4(1.0f), &db, dp);
+    size_t start = 0;
+    for (font_t font = 0; font < FONTS_COUNT; ++font) {
+        auto& geo = queued[font];
+        if (geo.empty()) {
+            continue;
+        }
+
+        dp.start = static_cast<unsigned int>(start);
+        dp.count = geo.size();
+        auto ftexture = renderer->getData()->findSlotTexture(
+            "fonts", fonts[font].textureName);
+        dp.textures = {ftexture->getName()};
+
+        renderer->getRenderer()->drawArrays(glm::mat4(1.0f), &db, dp);
+
+        start += geo.size();
+        geo.clear();
+    }
 
     renderer->getRenderer()->popDebugGroup();
 }
@@ -2,9 +2,12 @@
 #define _RWENGINE_TEXTRENDERER_HPP_
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
-#include <array>
+#include <unordered_map>
+#include <vector>
 
 #include <glm/glm.hpp>
 
@@ -15,11 +18,35 @@
 #include <render/OpenGLRenderer.hpp>
 
 class GameRenderer;
+
+struct TextVertex {
+    glm::vec2 position;
+    glm::vec2 texcoord;
+    glm::vec3 colour;
+
+    TextVertex(glm::vec2 _position, glm::vec2 _texcoord, glm::vec3 _colour)
+        : position(_position)
+        , texcoord(_texcoord)
+        , colour(_colour) {
+    }
+
+    TextVertex() = default;
+
+    static const AttributeList vertex_attributes() {
+        return {
+            {ATRS_Position, 2, sizeof(TextVertex), 0ul},
+            {ATRS_TexCoord, 2, sizeof(TextVertex), 0ul + sizeof(glm::vec2)},
+            {ATRS_Colour, 3, sizeof(TextVertex), 0ul + sizeof(glm::vec2) * 2},
+        };
+    }
+};
+
 /**
  * @brief Handles rendering of bitmap font textures.
  *
- * In future, strings textures might be cached to improve performance, but
- * for now, we just render each glyph on it's own quad
+ * Each glyph is a quad. Strings are laid out once and kept in a cache, then
+ * queued by font. Queued text is drawn by flush() with one draw per font, so
+ * anything drawn over text has to flush it first.
  */
 class TextRenderer {
 public:
@@ -56,14 +83,6 @@ public:
         float widthFrac;
     };
 
-    TextRenderer(GameRenderer* renderer);
-    ~TextRenderer() = default;
-
-    void setFontTexture(font_t font, const std::string& textureName);
-
-    void renderText(const TextInfo& ti, bool forceColour = false);
-
-private:
     class FontMetaData {
     public:
         FontMetaData() = default;
@@ -87,8 +106,91 @@ private:
         std::uint8_t monoWidth;
     };
 
+    /**
+     * Glyph quads of a string, relative to its screen position
+     */
+    struct TextLayout {
+        std::vector<TextVertex> vertices;
+        /// Size of the text
+        glm::vec2 extents{};
+        /// Size of the last glyph
+        glm::vec2 glyphSize{};
+    };
+
+    /**
+     * Caches layouts by text, font, size and colour
+     */
+    class LayoutCache {
+    public:
+        /// The cache is emptied when it grows past this
+        static constexpr size_t kMaxLayouts = 256;
+
+        const TextLayout& get(const TextInfo& ti, const FontMetaData& font,
+                              bool forceColour);
+
+        size_t size() const {
+            return layouts.size();
+        }
+
+        void clear() {
+            layouts.clear();
+        }
+
+    private:
+        struct Entry {
+            font_t font;
+            GameString text;
+            float size;
+            int wrapX;
+            glm::u8vec3 baseColour;
+            bool forceColour;
+            TextLayout layout;
+
+            bool matches(const TextInfo& ti, bool forceColour) const;
+        };
+
+        static size_t hashText(const TextInfo& ti, bool forceColour);
+
+        /// Keyed by hash so lookups don't have to copy the text
+        std::unordered_multimap<size_t, Entry> layouts;
+    };
+
+    TextRenderer(GameRenderer* renderer);
+    ~TextRenderer() = default;
+
+    void setFontTexture(font_t font, const std::string& textureName);
+
+    /**
+     * Queues the text to be drawn by the next flush()
+     */
+    void renderText(const TextInfo& ti, bool forceColour = false);
+
+    /**
+     * Draws all queued text
+     */
+    void flush();
+
+    /**
+     * Generates the glyph quads for some text, without touching GL
+     */
+    static TextLayout layoutText(const TextInfo& ti, const FontMetaData& font,
+                                 bool forceColour);
+
+    const LayoutCache& getLayoutCache() const {
+        return layouts;
+    }
+
+private:
     std::array<FontMetaData, FONTS_COUNT> fonts;
 
+    LayoutCache layouts;
+
+    /// Text waiting to be drawn, by font
+    std::array<std::vector<TextVertex>, FONTS_COUNT> queued;
+
+    /// Vertices of every font for the current flush
+    std::vector<TextVertex> frameVertices;
+
     GameRenderer* renderer;
     std::unique_ptr<Renderer::ShaderProgram> textShader;
 
@@ -0,0 +1,239 @@
+#include "script/SCMDisassembler.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+#include "script/SCMFile.hpp"
+#include "script/ScriptMachine.hpp"
+#include "script/ScriptModule.hpp"
+
+namespace {
+// Opcodes that affect control flow
+constexpr SCMOpcode kOpWait = 0x0001;
+constexpr SCMOpcode kOpGoto = 0x0002;
+constexpr SCMOpcode kOpGotoIfFalse = 0x004D;
+constexpr SCMOpcode kOpEndThread = 0x004E;
+constexpr SCMOpcode kOpStartThread = 0x004F;
+constexpr SCMOpcode kOpGosub = 0x0050;
+constexpr SCMOpcode kOpReturn = 0x0051;
+constexpr SCMOpcode kOpStartMissionThread = 0x00D7;
+}  // namespace
+
+SCMDisassembler::SCMDisassembler(const SCMFile& file, ScriptModule& module)
+    : file(file), module(module) {
+}
+
+bool SCMDisassembler::endsBlock(SCMOpcode opcode) {
+    switch (opcode) {
+        case kOpWait:
+        case kOpGoto:
+        case kOpGotoIfFalse:
+        case kOpGosub:
+        case kOpReturn:
+        case kOpEndThread:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool SCMDisassembler::decode(SCMAddress address, SCMInstruction& out) const {
+    const auto size = file.getSize();
+    auto pc = address;
+    if (pc + sizeof(SCMOpcode) > size) {
+        return false;
+    }
+
+    auto opcode = file.read<SCMOpcode>(pc);
+    out.address = address;
+    out.negated = (opcode & SCM_NEGATE_CONDITIONAL_MASK) ==
+                  SCM_NEGATE_CONDITIONAL_MASK;
+    out.opcode = opcode & ~SCM_NEGATE_CONDITIONAL_MASK;
+    out.operands.clear();
+
+    ScriptFunctionMeta* code;
+    if (!module.findOpcode(out.opcode, &code)) {
+        return false;
+    }
+
+    pc += sizeof(SCMOpcode);
+
+    bool hasExtraParameters = code->arguments < 0;
+    auto requiredParams = std::abs(code->arguments);
+
+    // Mirrors the operand decoding in ScriptMachine::executeThread
+    for (int p = 0; p < requiredParams || hasExtraParameters; ++p) {
+        if (pc >= size) {
+            return false;
+        }
+        auto type_r = file.read<SCMByte>(pc);
+        auto type = static_cast<SCMType>(type_r);
+
+        if (type_r > 42) {
+            type = TString;
+        } else {
+            pc += sizeof(SCMByte);
+        }
+
+        SCMOperand operand;
+        operand.type = type;
+        unsigned int operandSize = 0;
+        switch (type) {
+            case EndOfArgList:
+                hasExtraParameters = false;
+                break;
+            case TInt8:
+                operandSize = 1;
+                break;
+            case TInt16:
+            case TGlobal:
+            case TLocal:
+            case TFloat16:
+                operandSize = 2;
+                break;
+            case TInt32:
+                operandSize = 4;
+                break;
+            case TString:
+                operandSize = 8;
+                break;
+            default:
+                return false;
+        }
+        if (pc + operandSize > size) {
+            return false;
+        }
+
+        switch (type) {
+            case TInt8:
+                operand.integer = file.read<std::int8_t>(pc);
+                break;
+            case TInt16:
+                operand.integer = file.read<std::int16_t>(pc);
+                break;
+            case TGlobal:
+            case TLocal:
+                operand.integer = file.read<std::uint16_t>(pc);
+                break;
+            case TInt32:
+                operand.integer = file.read<std::int32_t>(pc);
+                break;
+            case TFloat16:
+                operand.fixed = file.read<std::int16_t>(pc);
+                break;
+            case TString:
+                std::copy(file.data() + pc, file.data() + pc + 8,
+                          operand.string);
+                break;
+            default:
+                break;
+        }
+        pc += operandSize;
+
+        out.operands.push_back(operand);
+    }
+
+    out.next = pc;
+    return true;
+}
+
+void SCMDisassembler::addEntryPoint(SCMAddress entry,
+                                    SCMAddress baseAddress) {
+    std::vector<SCMAddress> pending{entry};
+    leaders.insert(entry);
+
+    auto branchTo = [&](const SCMInstruction& ins) {
+        if (ins.operands.empty()) {
+            return;
+        }
+        auto target = resolveLabel(ins.operands[0].integer, baseAddress);
+        leaders.insert(target);
+        pending.push_back(target);
+    };
+
+    while (!pending.empty()) {
+        auto pc = pending.back();
+        pending.pop_back();
+
+        while (instructions.find(pc) == instructions.end()) {
+            SCMInstruction ins;
+            if (!decode(pc, ins)) {
+                invalid.insert(pc);
+                break;
+            }
+            instructions.emplace(pc, std::make_pair(ins, baseAddress));
+
+            bool fallsThrough = true;
+            switch (ins.opcode) {
+                case kOpGoto:
+                    branchTo(ins);
+                    fallsThrough = false;
+                    break;
+                case kOpGotoIfFalse:
+                case kOpGosub:
+                    branchTo(ins);
+                    leaders.insert(ins.next);
+                    break;
+                case kOpReturn:
+                case kOpEndThread:
+                    fallsThrough = false;
+                    break;
+                case kOpWait:
+                    leaders.insert(ins.next);
+                    break;
+                case kOpStartThread:
+                case kOpStartMissionThread:
+                    // New threads use their start address as the base
+                    if (!ins.operands.empty() &&
+                        ins.operands[0].integer >= 0) {
+                        auto start =
+                            static_cast<SCMAddress>(ins.operands[0].integer);
+                        if (instructions.find(start) == instructions.end()) {
+                            addEntryPoint(start, start);
+                        }
+                    }
+                    break;
+                default:
+                    break;
+            }
+
+            if (!fallsThrough) {
+                break;
+            }
+            pc = ins.next;
+        }
+    }
+}
+
+void SCMDisassembler::addFileEntryPoints() {
+    addEntryPoint(0, 0);
+    for (auto offset : file.getMissionOffsets()) {
+        addEntryPoint(offset, offset);
+    }
+}
+
+std::vector<SCMBasicBlock> SCMDisassembler::getBlocks() const {
+    std::vector<SCMBasicBlock> blocks;
+
+    for (const auto& entry : instructions) {
+        const auto& ins = entry.second.first;
+        bool startsBlock = blocks.empty() || leaders.count(ins.address) ||
+                           blocks.back().instructions.back().next !=
+                               ins.address;
+
+        if (!startsBlock) {
+            // Control transfers end the current block
+            startsBlock = endsBlock(blocks.back().instructions.back().opcode);
+        }
+
+        if (startsBlock) {
+            blocks.emplace_back();
+            blocks.back().address = ins.address;
+            blocks.back().baseAddress = entry.second.second;
+        }
+        blocks.back().instructions.push_back(ins);
+    }
+
+    return blocks;
+}
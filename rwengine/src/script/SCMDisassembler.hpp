@@ -0,0 +1,115 @@
+#ifndef _RWENGINE_SCMDISASSEMBLER_HPP_
+#define _RWENGINE_SCMDISASSEMBLER_HPP_
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+#include <script/ScriptTypes.hpp>
+
+class SCMFile;
+class ScriptModule;
+
+/**
+ * A decoded operand of an SCM instruction.
+ *
+ * Unlike SCMOpcodeParameter this doesn't resolve variables to memory, so
+ * globals and locals are stored as their index.
+ */
+struct SCMOperand {
+    SCMType type = EndOfArgList;
+    /// Immediate integer, or the variable index for globals and locals
+    std::int32_t integer = 0;
+    /// Raw fixed point value for TFloat16
+    std::int16_t fixed = 0;
+    char string[8] = {};
+};
+
+struct SCMInstruction {
+    SCMAddress address = 0;
+    /// Address of the following instruction
+    SCMAddress next = 0;
+    SCMOpcode opcode = 0;
+    bool negated = false;
+    std::vector<SCMOperand> operands;
+};
+
+/**
+ * A straight run of instructions that is only entered at its first
+ * instruction.
+ */
+struct SCMBasicBlock {
+    SCMAddress address = 0;
+    /// Address that negative labels in this block are relative to
+    SCMAddress baseAddress = 0;
+    std::vector<SCMInstruction> instructions;
+};
+
+/**
+ * Decodes SCM bytecode into instructions and basic blocks without executing
+ * it.
+ *
+ * Blocks are found by following control flow from the main script and each
+ * mission entry point. Branch targets, gosub return points and instructions
+ * following a wait start a new block, so the VM can resume a suspended
+ * thread at the start of a block.
+ */
+class SCMDisassembler {
+public:
+    SCMDisassembler(const SCMFile& file, ScriptModule& module);
+
+    /**
+     * Decodes the instruction at the given address.
+     * @return false if the opcode is unknown or the instruction runs past
+     * the end of the file
+     */
+    bool decode(SCMAddress address, SCMInstruction& out) const;
+
+    /**
+     * Finds all basic blocks reachable from the entry point.
+     * @param entry address to start decoding at
+     * @param baseAddress address negative labels are relative to
+     */
+    void addEntryPoint(SCMAddress entry, SCMAddress baseAddress);
+
+    /**
+     * Adds the main script and every mission as entry points
+     */
+    void addFileEntryPoints();
+
+    /**
+     * Returns the blocks reachable from all entry points, ordered by address
+     */
+    std::vector<SCMBasicBlock> getBlocks() const;
+
+    /**
+     * @return true if the instruction after opcode starts a new block, or
+     * the opcode transfers control
+     */
+    static bool endsBlock(SCMOpcode opcode);
+
+    /**
+     * Addresses where decoding failed, these paths fall back to the
+     * interpreter at runtime.
+     */
+    const std::set<SCMAddress>& getInvalidAddresses() const {
+        return invalid;
+    }
+
+private:
+    const SCMFile& file;
+    ScriptModule& module;
+
+    /// Decoded instructions and the base address they were reached with
+    std::map<SCMAddress, std::pair<SCMInstruction, SCMAddress>> instructions;
+    std::set<SCMAddress> leaders;
+    std::set<SCMAddress> invalid;
+
+    SCMAddress resolveLabel(std::int32_t label, SCMAddress baseAddress) const {
+        return static_cast<SCMAddress>(label < 0 ? baseAddress - label
+                                                 : label);
+    }
+};
+
+#endif
@@ -5,6 +5,8 @@
 
 void SCMFile::loadFile(char *data, unsigned int size) {
     _data = new SCMByte[size];
+    _size = size;
+    memory.set(size);
     std::copy(data, data + size, _data);
 
     // Bytes required to hop over a jump opcode.
@@ -4,6 +4,7 @@
 #include "script/ScriptTypes.hpp"
 
 #include <rw/casts.hpp>
+#include <rw/memorystats.hpp>
 
 #include <cstdint>
 #include <string>
@@ -28,6 +29,10 @@ public:
         return _data;
     }
 
+    unsigned int getSize() const {
+        return _size;
+    }
+
     template <class T>
     T read(unsigned int offset) const {
         return bit_cast<T>(*(_data + offset));
@@ -67,6 +72,8 @@ public:
 
 private:
     SCMByte* _data = nullptr;
+    unsigned int _size{0};
+    TrackedMemory<MemoryTag::Script> memory;
 
     SCMTarget _target{NoTarget};
 
@@ -0,0 +1,201 @@
+#include "script/SCMTranslator.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+#include "script/ScriptMachine.hpp"
+#include "script/ScriptNative.hpp"
+
+namespace {
+
+std::string hex(std::uint32_t value, int width) {
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0') << std::setw(width) << value;
+    return ss.str();
+}
+
+std::string blockName(SCMAddress address) {
+    return "block_" + hex(address, 6);
+}
+
+std::string variablePointer(const SCMOperand& operand) {
+    if (operand.type == TGlobal) {
+        return "m.getGlobals() + 0x" + hex(operand.integer, 4);
+    }
+    return "t.locals.data() + 0x" + hex(operand.integer, 4) +
+           " * SCM_VARIABLE_SIZE";
+}
+
+std::string immediate(const SCMOperand& operand) {
+    switch (operand.type) {
+        case TInt8:
+        case TInt16:
+        case TInt32:
+            return std::to_string(operand.integer);
+        case TFloat16:
+            // Same expression as the interpreter so results are identical
+            return "static_cast<ScriptFloat>(" +
+                   std::to_string(operand.fixed) + ") / 16.f";
+        default:
+            return "";
+    }
+}
+
+bool isInteger(const SCMOperand& operand) {
+    return operand.type == TInt8 || operand.type == TInt16 ||
+           operand.type == TInt32;
+}
+
+/**
+ * Emits typed variable access for the arithmetic opcodes 0004 to 0017,
+ * which take a variable and an immediate.
+ * @return false if the instruction needs a full opcode call
+ */
+bool emitTypedArithmetic(std::ostream& out, const SCMInstruction& ins) {
+    if (ins.opcode < 0x0004 || ins.opcode > 0x0017 ||
+        ins.operands.size() != 2) {
+        return false;
+    }
+    const auto& var = ins.operands[0];
+    const auto& value = ins.operands[1];
+
+    // Even opcodes operate on integers, odd ones on floats. Each group of
+    // four covers global int, global float, local int and local float.
+    bool isFloat = (ins.opcode & 1) != 0;
+    bool isLocal = ((ins.opcode - 0x0004) & 2) != 0;
+    if (var.type != (isLocal ? TLocal : TGlobal)) {
+        return false;
+    }
+    if (isFloat ? value.type != TFloat16 : !isInteger(value)) {
+        return false;
+    }
+
+    static const char* operators[] = {"=", "+=", "-=", "*=", "/="};
+    auto op = operators[(ins.opcode - 0x0004) / 4];
+    if (!isFloat && op[0] == '/' && value.integer == 0) {
+        return false;
+    }
+
+    out << "    *reinterpret_cast<" << (isFloat ? "ScriptFloat" : "ScriptInt")
+        << "*>(" << variablePointer(var) << ") " << op << " "
+        << immediate(value) << ";\n";
+    return true;
+}
+
+void emitParameters(std::ostream& out, const SCMInstruction& ins) {
+    out << "    p.resize(" << ins.operands.size() << ");\n";
+    for (auto i = 0u; i < ins.operands.size(); ++i) {
+        const auto& operand = ins.operands[i];
+        std::string param = "p[" + std::to_string(i) + "]";
+        switch (operand.type) {
+            case EndOfArgList:
+                out << "    " << param << ".type = EndOfArgList;\n";
+                break;
+            case TInt8:
+            case TInt16:
+            case TInt32:
+                out << "    " << param << ".type = "
+                    << (operand.type == TInt8
+                            ? "TInt8"
+                            : operand.type == TInt16 ? "TInt16" : "TInt32")
+                    << ";\n";
+                out << "    " << param << ".integer = " << immediate(operand)
+                    << ";\n";
+                break;
+            case TFloat16:
+                out << "    " << param << ".type = TFloat16;\n";
+                out << "    " << param << ".real = " << immediate(operand)
+                    << ";\n";
+                break;
+            case TGlobal:
+            case TLocal:
+                out << "    " << param << ".type = "
+                    << (operand.type == TGlobal ? "TGlobal" : "TLocal")
+                    << ";\n";
+                out << "    " << param
+                    << ".globalPtr = " << variablePointer(operand) << ";\n";
+                break;
+            case TString:
+                out << "    " << param << ".type = TString;\n";
+                out << "    std::memcpy(" << param << ".string, \"";
+                for (auto c : operand.string) {
+                    out << "\\x" << hex(static_cast<std::uint8_t>(c), 2);
+                }
+                out << "\", 8);\n";
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void emitInstruction(std::ostream& out, const SCMInstruction& ins) {
+    out << "    // " << hex(ins.address, 6) << ": "
+        << hex(ins.opcode | (ins.negated ? SCM_NEGATE_CONDITIONAL_MASK : 0),
+               4)
+        << "\n";
+
+    out << "    t.programCounter = 0x" << hex(ins.next, 6) << ";\n";
+    if (!emitTypedArithmetic(out, ins)) {
+        emitParameters(out, ins);
+        out << "    script_bind::do_unpacked_call(&opcode_"
+            << hex(ins.opcode, 4) << ", ScriptArguments(&p, &t, &m));\n";
+    }
+    out << "    if (!m.completeNativeInstruction(t, 0x" << hex(ins.address, 6)
+        << ", 0x" << hex(ins.opcode, 4) << ", "
+        << (ins.negated ? "true" : "false") << ", 0x" << hex(ins.next, 6)
+        << ")) return;\n";
+}
+
+void emitBlock(std::ostream& out, const SCMBasicBlock& block) {
+    size_t maxOperands = 0;
+    for (const auto& ins : block.instructions) {
+        maxOperands = std::max(maxOperands, ins.operands.size());
+    }
+
+    out << "void " << blockName(block.address)
+        << "(ScriptMachine& m, SCMThread& t) {\n";
+    out << "    SCMParams p;\n";
+    out << "    p.reserve(" << maxOperands << ");\n";
+    for (const auto& ins : block.instructions) {
+        emitInstruction(out, ins);
+    }
+    out << "}\n\n";
+}
+
+}  // namespace
+
+void SCMTranslator::write(std::ostream& out,
+                          const std::vector<SCMBasicBlock>& blocks,
+                          const std::string& source,
+                          const std::string& name) const {
+    out << "// Generated by scmtranslate from " << source << ", do not edit.\n";
+    out << "// Build with -DSCRIPT_NATIVE_SOURCE=<this file>\n\n";
+    out << "#include <cstring>\n\n";
+    out << "#include <script/ScriptMachine.hpp>\n";
+    out << "#include <script/ScriptModule.hpp>\n";
+    out << "#include <script/ScriptNative.hpp>\n";
+    out << "#include <script/modules/GTA3ModuleOpcodes.hpp>\n\n";
+    out << "namespace " << name << " {\n\n";
+
+    for (const auto& block : blocks) {
+        emitBlock(out, block);
+    }
+
+    out << "const SCMNativeBlockEntry kBlocks[] = {\n";
+    for (const auto& block : blocks) {
+        out << "    {0x" << hex(block.address, 6) << ", "
+            << blockName(block.address) << "},\n";
+    }
+    out << "};\n\n";
+
+    out << "const ScriptNativeCode& getCode() {\n";
+    out << "    static const ScriptNativeCode code(0x"
+        << hex(ScriptNativeCode::computeChecksum(file), 8) << "u, kBlocks);\n";
+    out << "    return code;\n";
+    out << "}\n\n";
+    out << "}  // namespace " << name << "\n";
+}
@@ -0,0 +1,39 @@
+#ifndef _RWENGINE_SCMTRANSLATOR_HPP_
+#define _RWENGINE_SCMTRANSLATOR_HPP_
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <script/SCMDisassembler.hpp>
+
+class SCMFile;
+
+/**
+ * Writes C++ source for the basic blocks of an SCM file.
+ *
+ * Operands are decoded at translation time, opcode implementations are
+ * called directly and the simple arithmetic opcodes 0004 to 0017 use typed
+ * global and local access. The output calls the opcode functions declared
+ * in GTA3ModuleOpcodes.hpp, so it has to be linked with rwengine.
+ */
+class SCMTranslator {
+public:
+    explicit SCMTranslator(const SCMFile& file) : file(file) {
+    }
+
+    /**
+     * Writes a function for each block and getCode(), which returns the
+     * table of them for the file.
+     * @param source Name of the SCM file, for the header comment
+     * @param name Namespace to put the generated code in
+     */
+    void write(std::ostream& out, const std::vector<SCMBasicBlock>& blocks,
+               const std::string& source,
+               const std::string& name = "scm_native") const;
+
+private:
+    const SCMFile& file;
+};
+
+#endif
@@ -239,7 +239,7 @@ inline void getClosestNode(const ScriptArguments& args, ScriptVec3& coord, AIGra
                            ScriptFloat& xCoord, ScriptFloat& yCoord, ScriptFloat& zCoord) {
     coord = script::getGround(args, coord);
     float closest = 10000.f;
-    std::vector<AIGraphNode*> nodes;
+    TickVector<AIGraphNode*> nodes;
     args.getWorld()->aigraph.gatherExternalNodesNear(coord, closest, nodes, type);
 
     for (const auto &node : nodes) {
@@ -1,6 +1,8 @@
 #include "script/ScriptMachine.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 
@@ -8,11 +10,15 @@
 #include "core/Logger.hpp"
 #include "engine/GameState.hpp"
 #include "engine/GameWorld.hpp"
+#include "script/SCMDisassembler.hpp"
 #include "script/SCMFile.hpp"
 #include "script/ScriptModule.hpp"
+#include "script/ScriptNative.hpp"
+#include "script/ScriptProfiler.hpp"
 
 void ScriptMachine::executeThread(SCMThread& t, int msPassed) {
-    auto player = state->world->getPlayer();
+    // Scripts can run without a world in tests
+    auto player = state->world ? state->world->getPlayer() : nullptr;
 
     if (player) {
         if (t.isMission && t.deathOrArrestCheck &&
@@ -34,8 +40,26 @@ void ScriptMachine::executeThread(SCMThread& t, int msPassed) {
     }
     if (t.wakeCounter > 0) return;
 
+    // Translated blocks are only entered at their first instruction, which is
+    // where a thread resumes or where a branch, call or return leads
+    bool atBlockEntry = true;
     while (t.wakeCounter == 0) {
+        if (nativeCode && atBlockEntry) {
+            if (auto block = nativeCode->find(t.programCounter)) {
+                block(*this, t);
+                continue;
+            }
+        }
+
         auto pc = t.programCounter;
+        const auto instructionAddress = pc;
+
+        bool timed = profiler && profiler->beginInstruction();
+        ScriptProfiler::clock::time_point instructionStart;
+        if (timed) {
+            instructionStart = ScriptProfiler::clock::now();
+        }
+
         auto opcode = file->read<SCMOpcode>(pc);
 
         bool isNegatedConditional = ((opcode & SCM_NEGATE_CONDITIONAL_MASK) ==
@@ -148,29 +172,20 @@ void ScriptMachine::executeThread(SCMThread& t, int msPassed) {
             code.function(sca);
         }
 
-        if (isNegatedConditional) {
-            t.conditionResult = !t.conditionResult;
-        }
+        completeInstruction(t, opcode, isNegatedConditional);
 
-        // Handle conditional results for IF statements.
-        if (t.conditionCount > 0 && opcode != 0x00D6)  /// @todo add conditional
-                                                       /// flag to opcodes
-                                                       /// instead of checking
-                                                       /// for 0x00D6
-        {
-            --t.conditionCount;
-            if (t.conditionAND) {
-                if (t.conditionResult == false) {
-                    t.conditionMask = 0;
-                } else {
-                    // t.conditionMask is already set to 0xFF by the if and
-                    // opcode.
-                }
-            } else {
-                t.conditionMask = t.conditionMask || t.conditionResult;
-            }
+        atBlockEntry =
+            t.programCounter != pc || SCMDisassembler::endsBlock(opcode);
 
-            t.conditionResult = (t.conditionMask != 0);
+        if (profiler) {
+            std::uint64_t elapsed = 0;
+            if (timed) {
+                elapsed = static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        ScriptProfiler::clock::now() - instructionStart)
+                        .count());
+            }
+            profiler->record(t, instructionAddress, opcode, elapsed);
         }
     }
 
@@ -185,6 +200,56 @@ void ScriptMachine::executeThread(SCMThread& t, int msPassed) {
     }
 }
 
+void ScriptMachine::completeInstruction(SCMThread& t, SCMOpcode opcode,
+                                        bool negated) {
+    if (negated) {
+        t.conditionResult = !t.conditionResult;
+    }
+
+    // Handle conditional results for IF statements.
+    if (t.conditionCount > 0 && opcode != 0x00D6)  /// @todo add conditional
+                                                   /// flag to opcodes
+                                                   /// instead of checking
+                                                   /// for 0x00D6
+    {
+        --t.conditionCount;
+        if (t.conditionAND) {
+            if (t.conditionResult == false) {
+                t.conditionMask = 0;
+            } else {
+                // t.conditionMask is already set to 0xFF by the if and
+                // opcode.
+            }
+        } else {
+            t.conditionMask = t.conditionMask || t.conditionResult;
+        }
+
+        t.conditionResult = (t.conditionMask != 0);
+    }
+}
+
+bool ScriptMachine::completeNativeInstruction(SCMThread& t,
+                                              SCMThread::pc_t pc,
+                                              SCMOpcode opcode, bool negated,
+                                              SCMThread::pc_t next) {
+    completeInstruction(t, opcode, negated);
+
+    if (profiler) {
+        profiler->record(t, pc, opcode, 0);
+    }
+
+    return t.wakeCounter == 0 && t.programCounter == next;
+}
+
+bool ScriptMachine::setNativeCode(const ScriptNativeCode* code) {
+    if (code && !code->matches(*file)) {
+        nativeCode = nullptr;
+        return false;
+    }
+    nativeCode = code;
+    return true;
+}
+
 ScriptMachine::ScriptMachine(GameState* _state, SCMFile* file,
                              ScriptModule* ops)
     : file(file)
@@ -195,9 +260,14 @@ ScriptMachine::ScriptMachine(GameState* _state, SCMFile* file,
     // Copy globals
     auto size = file->getGlobalsSize();
     globalData.resize(size);
+    globalMemory.set(size);
     auto offset = file->getGlobalSection();
     std::copy(file->data() + offset, file->data() + offset + size,
               globalData.begin());
+
+    if (module->getNativeCode()) {
+        setNativeCode(module->getNativeCode());
+    }
 }
 
 void ScriptMachine::startThread(SCMThread::pc_t start, bool mission) {
@@ -12,10 +12,13 @@
 #include <utility>
 #include <vector>
 
+#include <rw/memorystats.hpp>
 #include <script/ScriptTypes.hpp>
 
 class GameState;
 class SCMFile;
+class ScriptNativeCode;
+class ScriptProfiler;
 
 #define SCM_NEGATE_CONDITIONAL_MASK 0x8000
 #define SCM_CONDITIONAL_MASK_PASSED 0xFF
@@ -164,6 +167,45 @@ public:
         debugFlag = flag;
     }
 
+    /**
+     * Attaches a profiler that records every executed instruction, or
+     * detaches it when passed nullptr. The profiler is not owned.
+     */
+    void setProfiler(ScriptProfiler* p) {
+        profiler = p;
+    }
+
+    ScriptProfiler* getProfiler() const {
+        return profiler;
+    }
+
+    /**
+     * Uses translated basic blocks where available and interprets the rest.
+     * The module's native code is attached on construction if it matches
+     * the file.
+     * @return false if the code was not translated from this file, in which
+     * case only the interpreter is used
+     */
+    bool setNativeCode(const ScriptNativeCode* code);
+
+    const ScriptNativeCode* getNativeCode() const {
+        return nativeCode;
+    }
+
+    /**
+     * Finishes an instruction executed by translated code, applying
+     * conditional results the same way as the interpreter.
+     * @return true if the thread should continue with the next instruction
+     * in the block
+     */
+    bool completeNativeInstruction(SCMThread& t, SCMThread::pc_t pc,
+                                   SCMOpcode opcode, bool negated,
+                                   SCMThread::pc_t next);
+
+    void setRandomSeed(std::uint32_t seed) {
+        randomNumberGen.seed(seed);
+    }
+
     template <typename T>
     typename std::enable_if<std::is_integral<T>::value, T>::type
     getRandomNumber(T min, T max) {
@@ -189,12 +231,17 @@ private:
     ScriptModule* module = nullptr;
     GameState* state = nullptr;
     bool debugFlag;
+    ScriptProfiler* profiler = nullptr;
+    const ScriptNativeCode* nativeCode = nullptr;
 
     std::list<SCMThread> _activeThreads;
 
     void executeThread(SCMThread& t, int msPassed);
 
+    void completeInstruction(SCMThread& t, SCMOpcode opcode, bool negated);
+
     std::vector<SCMByte> globalData;
+    TrackedMemory<MemoryTag::Script> globalMemory;
 
     std::mt19937 randomNumberGen;
 };
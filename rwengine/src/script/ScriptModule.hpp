@@ -9,6 +9,8 @@
 
 #include <string>
 
+class ScriptNativeCode;
+
 namespace script_bind {
 template <class T>
 struct arg_traits {
@@ -172,7 +174,20 @@ public:
 
     bool findOpcode(ScriptFunctionID id, ScriptFunctionMeta** out);
 
+    /**
+     * @return Translated script code built into this module, or nullptr
+     */
+    const ScriptNativeCode* getNativeCode() const {
+        return nativeCode;
+    }
+
+protected:
+    void setNativeCode(const ScriptNativeCode* code) {
+        nativeCode = code;
+    }
+
 private:
+    const ScriptNativeCode* nativeCode = nullptr;
     const std::string name;
     std::map<ScriptFunctionID, ScriptFunctionMeta> functions;
 };
@@ -0,0 +1,17 @@
+#include "script/ScriptNative.hpp"
+
+#include "script/SCMFile.hpp"
+
+bool ScriptNativeCode::matches(const SCMFile& file) const {
+    return computeChecksum(file) == checksum;
+}
+
+std::uint32_t ScriptNativeCode::computeChecksum(const SCMFile& file) {
+    std::uint32_t hash = 2166136261u;
+    const auto data = file.data();
+    for (auto i = 0u; i < file.getSize(); ++i) {
+        hash ^= static_cast<std::uint8_t>(data[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
@@ -0,0 +1,70 @@
+#ifndef _RWENGINE_SCRIPTNATIVE_HPP_
+#define _RWENGINE_SCRIPTNATIVE_HPP_
+
+#include <cstdint>
+#include <unordered_map>
+
+#include <script/ScriptTypes.hpp>
+
+class SCMFile;
+class ScriptMachine;
+struct SCMThread;
+
+/**
+ * Entry point of a translated basic block. Executes instructions until the
+ * thread yields, branches or reaches the end of the block.
+ */
+using SCMNativeBlock = void (*)(ScriptMachine&, SCMThread&);
+
+struct SCMNativeBlockEntry {
+    SCMAddress address;
+    SCMNativeBlock function;
+};
+
+/**
+ * Table of basic blocks translated ahead of time by scmtranslate.
+ *
+ * The code is only valid for the exact SCM file it was generated from, the
+ * checksum is used to detect a mismatch so ScriptMachine can fall back to the
+ * interpreter.
+ */
+class ScriptNativeCode {
+public:
+    template <size_t N>
+    ScriptNativeCode(std::uint32_t checksum,
+                     const SCMNativeBlockEntry (&entries)[N])
+        : checksum(checksum) {
+        blocks.reserve(N);
+        for (const auto& entry : entries) {
+            blocks.emplace(entry.address, entry.function);
+        }
+    }
+
+    /**
+     * @return true if this code was translated from file
+     */
+    bool matches(const SCMFile& file) const;
+
+    /**
+     * @return The block that starts at address, or nullptr
+     */
+    SCMNativeBlock find(SCMAddress address) const {
+        auto it = blocks.find(address);
+        return it != blocks.end() ? it->second : nullptr;
+    }
+
+    size_t getBlockCount() const {
+        return blocks.size();
+    }
+
+    /**
+     * FNV-1a hash of the file contents
+     */
+    static std::uint32_t computeChecksum(const SCMFile& file);
+
+private:
+    std::uint32_t checksum;
+    std::unordered_map<SCMAddress, SCMNativeBlock> blocks;
+};
+
+#endif
@@ -0,0 +1,195 @@
+#include "script/ScriptProfiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+template <class Key>
+std::vector<std::pair<Key, ScriptProfiler::Counter>> sortedByTime(
+    const std::map<Key, ScriptProfiler::Counter>& counters) {
+    std::vector<std::pair<Key, ScriptProfiler::Counter>> sorted(
+        counters.begin(), counters.end());
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const auto& a, const auto& b) {
+                         return a.second.time > b.second.time;
+                     });
+    return sorted;
+}
+
+void writeRow(std::ostream& out, const ScriptProfiler::Counter& c,
+              std::uint64_t totalTime) {
+    double percent =
+        totalTime > 0 ? 100.0 * static_cast<double>(c.time) /
+                            static_cast<double>(totalTime)
+                      : 0.0;
+    std::uint64_t average = c.count > 0 ? c.time / c.count : 0;
+    out << std::dec << std::setfill(' ') << std::setw(12) << c.count
+        << std::setw(14) << c.time / 1000 << std::setw(10) << average
+        << std::setw(8) << std::fixed << std::setprecision(2) << percent
+        << "  ";
+}
+
+void writeHeader(std::ostream& out, const char* title) {
+    out << std::setfill(' ') << std::setw(12) << "count" << std::setw(14)
+        << "time (us)" << std::setw(10) << "avg (ns)" << std::setw(8) << "%"
+        << "  " << title << "\n";
+}
+}  // namespace
+
+bool ScriptProfiler::StackKey::operator<(const StackKey& other) const {
+    return std::tie(depth, calls, opcode) <
+           std::tie(other.depth, other.calls, other.opcode);
+}
+
+bool ScriptProfiler::InstructionKey::operator==(
+    const InstructionKey& other) const {
+    return pc == other.pc && opcode == other.opcode && depth == other.depth &&
+           std::equal(calls.begin(), calls.begin() + depth,
+                      other.calls.begin());
+}
+
+size_t ScriptProfiler::InstructionKeyHash::operator()(
+    const InstructionKey& key) const {
+    size_t hash = 0;
+    auto combine = [&](size_t value) {
+        hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    };
+    combine(key.pc);
+    combine(key.opcode);
+    for (auto i = 0u; i < key.depth; ++i) {
+        combine(key.calls[i]);
+    }
+    return hash;
+}
+
+ScriptProfiler::ScriptProfiler(Mode mode, unsigned int sampleInterval,
+                               unsigned int rangeSize)
+    : mode(mode)
+    , sampleInterval(std::max(sampleInterval, 1u))
+    , rangeSize(std::max(rangeSize, 1u)) {
+}
+
+void ScriptProfiler::record(const SCMThread& thread, SCMThread::pc_t pc,
+                            SCMOpcode opcode, std::uint64_t ns) {
+    if (mode == Mode::Sample) {
+        ns *= sampleInterval;
+    }
+
+    total.add(1, ns);
+
+    auto& record = threads[thread.baseAddress];
+    std::memcpy(record.name.data(), thread.name, record.name.size());
+
+    InstructionKey key{};
+    key.pc = pc;
+    key.opcode = opcode;
+    key.depth = std::min<unsigned int>(thread.stackDepth, SCM_STACK_DEPTH);
+    std::copy(thread.calls.begin(), thread.calls.begin() + key.depth,
+              key.calls.begin());
+    record.instructions[key].add(1, ns);
+}
+
+void ScriptProfiler::reset() {
+    sampleCounter = 0;
+    total = {};
+    threads.clear();
+}
+
+std::map<SCMOpcode, ScriptProfiler::Counter> ScriptProfiler::getOpcodes()
+    const {
+    std::map<SCMOpcode, Counter> opcodes;
+    for (const auto& thread : threads) {
+        for (const auto& instruction : thread.second.instructions) {
+            const auto& c = instruction.second;
+            opcodes[instruction.first.opcode].add(c.count, c.time);
+        }
+    }
+    return opcodes;
+}
+
+std::map<std::string, ScriptProfiler::ThreadProfile>
+ScriptProfiler::getThreads() const {
+    std::map<std::string, ThreadProfile> profiles;
+    for (const auto& thread : threads) {
+        const auto& name = thread.second.name;
+        auto& profile = profiles[std::string(
+            name.data(), strnlen(name.data(), name.size() - 1))];
+        for (const auto& instruction : thread.second.instructions) {
+            const auto& c = instruction.second;
+            profile.total.add(c.count, c.time);
+
+            StackKey key{};
+            key.depth = instruction.first.depth;
+            key.calls = instruction.first.calls;
+            key.opcode = instruction.first.opcode;
+            profile.stacks[key].add(c.count, c.time);
+        }
+    }
+    return profiles;
+}
+
+std::map<SCMThread::pc_t, ScriptProfiler::Counter> ScriptProfiler::getRanges()
+    const {
+    std::map<SCMThread::pc_t, Counter> ranges;
+    for (const auto& thread : threads) {
+        for (const auto& instruction : thread.second.instructions) {
+            const auto pc = instruction.first.pc;
+            const auto& c = instruction.second;
+            ranges[pc - pc % rangeSize].add(c.count, c.time);
+        }
+    }
+    return ranges;
+}
+
+void ScriptProfiler::dumpFlat(std::ostream& out) const {
+    out << "Script profile: " << total.count << " instructions, "
+        << total.time / 1000 << " us"
+        << (mode == Mode::Sample ? " (sampled)" : "") << "\n\n";
+
+    writeHeader(out, "opcode");
+    for (const auto& entry : sortedByTime(getOpcodes())) {
+        writeRow(out, entry.second, total.time);
+        out << std::hex << std::setfill('0') << std::setw(4) << entry.first
+            << "\n";
+    }
+
+    out << "\n";
+    writeHeader(out, "thread");
+    std::map<std::string, Counter> threadTotals;
+    for (const auto& thread : getThreads()) {
+        threadTotals[thread.first] = thread.second.total;
+    }
+    for (const auto& entry : sortedByTime(threadTotals)) {
+        writeRow(out, entry.second, total.time);
+        out << entry.first << "\n";
+    }
+
+    out << "\n";
+    writeHeader(out, "pc range");
+    for (const auto& entry : sortedByTime(getRanges())) {
+        writeRow(out, entry.second, total.time);
+        out << std::hex << std::setfill('0') << std::setw(6) << entry.first
+            << "-" << std::setw(6) << entry.first + rangeSize - 1 << "\n";
+    }
+    out << std::dec;
+}
+
+void ScriptProfiler::dumpFolded(std::ostream& out) const {
+    for (const auto& thread : getThreads()) {
+        for (const auto& stack : thread.second.stacks) {
+            const auto& key = stack.first;
+            out << thread.first;
+            for (auto i = 0u; i < key.depth; ++i) {
+                out << ";gosub_" << std::hex << std::setfill('0')
+                    << std::setw(6) << key.calls[i];
+            }
+            out << ";op_" << std::hex << std::setfill('0') << std::setw(4)
+                << key.opcode << " " << std::dec << stack.second.time << "\n";
+        }
+    }
+}
@@ -0,0 +1,172 @@
+#ifndef _RWENGINE_SCRIPTPROFILER_HPP_
+#define _RWENGINE_SCRIPTPROFILER_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include <script/ScriptMachine.hpp>
+#include <script/ScriptTypes.hpp>
+
+/**
+ * Collects instruction counts and wall time for the script virtual machine.
+ *
+ * Attach to a ScriptMachine with ScriptMachine::setProfiler(). Every executed
+ * instruction is counted per opcode, per thread name, per call stack and per
+ * program counter range. In Instrument mode every instruction is timed, in
+ * Sample mode only every Nth instruction is timed and the measurement is
+ * weighted by N, which keeps the clock overhead low on long runs.
+ *
+ * Instructions are recorded per thread (by base address), keyed on their
+ * address, opcode and call stack. The per opcode, thread name and range
+ * tables are only built from those records when they are requested.
+ *
+ * The results can be written as a flat, human readable profile or as a
+ * folded stack file that can be fed to flamegraph.pl.
+ */
+class ScriptProfiler {
+public:
+    using clock = std::chrono::steady_clock;
+
+    enum class Mode { Instrument, Sample };
+
+    struct Counter {
+        /// Number of executed instructions
+        std::uint64_t count = 0;
+        /// Wall time in nanoseconds (weighted in Sample mode)
+        std::uint64_t time = 0;
+
+        void add(std::uint64_t instructions, std::uint64_t ns) {
+            count += instructions;
+            time += ns;
+        }
+    };
+
+    /**
+     * Identifies an instruction within its call stack, used to build
+     * the folded stack output.
+     */
+    struct StackKey {
+        unsigned int depth;
+        std::array<SCMThread::pc_t, SCM_STACK_DEPTH> calls;
+        SCMOpcode opcode;
+
+        bool operator<(const StackKey& other) const;
+    };
+
+    struct ThreadProfile {
+        Counter total;
+        std::map<StackKey, Counter> stacks;
+    };
+
+    /**
+     * Identifies an executed instruction within a thread
+     */
+    struct InstructionKey {
+        SCMThread::pc_t pc;
+        SCMOpcode opcode;
+        unsigned int depth;
+        std::array<SCMThread::pc_t, SCM_STACK_DEPTH> calls;
+
+        bool operator==(const InstructionKey& other) const;
+    };
+
+    struct InstructionKeyHash {
+        size_t operator()(const InstructionKey& key) const;
+    };
+
+    struct ThreadRecord {
+        /// Thread name when it last executed an instruction
+        std::array<char, sizeof(SCMThread::name)> name;
+        std::unordered_map<InstructionKey, Counter, InstructionKeyHash>
+            instructions;
+    };
+
+    /**
+     * @param mode Instrument to time all instructions, Sample to time only
+     * every sampleInterval instructions.
+     * @param sampleInterval instructions between timed samples
+     * @param rangeSize size in bytes of each program counter bucket
+     */
+    ScriptProfiler(Mode mode = Mode::Instrument,
+                   unsigned int sampleInterval = 64,
+                   unsigned int rangeSize = 256);
+
+    Mode getMode() const {
+        return mode;
+    }
+
+    unsigned int getSampleInterval() const {
+        return sampleInterval;
+    }
+
+    unsigned int getRangeSize() const {
+        return rangeSize;
+    }
+
+    /**
+     * Called by the ScriptMachine before executing an instruction.
+     * @return true if this instruction should be timed
+     */
+    bool beginInstruction() {
+        if (mode == Mode::Instrument) {
+            return true;
+        }
+        if (++sampleCounter >= sampleInterval) {
+            sampleCounter = 0;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Records one executed instruction.
+     * @param thread the thread that executed the instruction
+     * @param pc the address of the instruction
+     * @param opcode the opcode, without the negation bit
+     * @param ns measured duration, or 0 if the instruction was not timed
+     */
+    void record(const SCMThread& thread, SCMThread::pc_t pc, SCMOpcode opcode,
+                std::uint64_t ns);
+
+    void reset();
+
+    const Counter& getTotal() const {
+        return total;
+    }
+
+    std::map<SCMOpcode, Counter> getOpcodes() const;
+
+    /// Profiles keyed by thread name, threads sharing a name are merged
+    std::map<std::string, ThreadProfile> getThreads() const;
+
+    /// Counters keyed by the first address of each program counter range
+    std::map<SCMThread::pc_t, Counter> getRanges() const;
+
+    /**
+     * Writes opcode, thread and program counter range tables, sorted by time
+     */
+    void dumpFlat(std::ostream& out) const;
+
+    /**
+     * Writes one "thread;gosub_xxxxxx;...;op_xxxx nanoseconds" line per
+     * unique call stack, compatible with flamegraph.pl
+     */
+    void dumpFolded(std::ostream& out) const;
+
+private:
+    Mode mode;
+    unsigned int sampleInterval;
+    unsigned int rangeSize;
+    unsigned int sampleCounter = 0;
+
+    Counter total;
+    /// Records keyed by thread base address
+    std::unordered_map<SCMThread::pc_t, ThreadRecord> threads;
+};
+
+#endif
@@ -9,6 +9,7 @@
 
 #include <glm/glm.hpp>
 
+#include <rw/arena.hpp>
 #include <rw/debug.hpp>
 
 #include "audio/Sound.hpp"
@@ -233,7 +234,8 @@ struct SCMOpcodeParameter {
     }
 };
 
-typedef std::vector<SCMOpcodeParameter> SCMParams;
+/// Decoded for each instruction, so it lives in the tick arena
+typedef TickVector<SCMOpcodeParameter> SCMParams;
 
 class ScriptArguments {
     const SCMParams* parameters;
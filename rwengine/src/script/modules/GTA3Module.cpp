@@ -2,6 +2,7 @@
 
 #include "script/ScriptModule.hpp"
 #include "script/ScriptTypes.hpp"
+#include "script/modules/GTA3ModuleOpcodes.hpp"
 
 
 #ifdef RW_DEBUG_OPCODES
@@ -13,6 +14,11 @@
 
 #include "GTA3ModuleImpl.inl"
 
+#ifdef RW_SCRIPT_NATIVE_SOURCE
+// Code generated by scmtranslate, calls the opcodes above directly
+#include RW_SCRIPT_NATIVE_SOURCE
+#endif
+
 GTA3Module::GTA3Module() : ScriptModule("GTA3") {
     bind(0x0000, 0, opcode_0000);
     bind(0x0001, 1, opcode_0001);
@@ -918,4 +924,8 @@ GTA3Module::GTA3Module() : ScriptModule("GTA3") {
     bind(0x0463, 3, opcode_0463);
     bind(0x0477, 3, opcode_0477);
     bind(0x0494, 5, opcode_0494);
+
+#ifdef RW_SCRIPT_NATIVE_SOURCE
+    setNativeCode(&scm_native::getCode());
+#endif
 }
@@ -4298,7 +4298,8 @@ void opcode_018c(const ScriptArguments& args, ScriptVec3 coord, const ScriptSoun
 void opcode_018d(const ScriptArguments& args, ScriptVec3 coord, const ScriptSoundType sound0, ScriptSound& sound1) {
     auto world = args.getWorld();
     auto metaData = getSoundInstanceData(sound0);
-    auto bufferName = world->sound.createSfxInstance(metaData->sfx);
+    // The script keeps this one, so it shouldn't be stolen by one-off effects
+    auto bufferName = world->sound.createSfxInstance(metaData->sfx, 1);
     world->sound.playSfx(bufferName, coord, true, metaData->range);
     sound1 = &world->sound.getSoundRef(bufferName);
 }
@@ -5233,8 +5234,7 @@ void opcode_01d3(const ScriptArguments& args, const ScriptCharacter character, c
     RW_UNUSED(vehicle);
     RW_UNUSED(args);
     character->controller->skipActivity();
-    character->controller->setNextActivity(
-            std::make_unique<Activities::ExitVehicle>());
+    character->controller->setNextActivity<Activities::ExitVehicle>();
 }
 
 /**
@@ -5247,9 +5247,8 @@ void opcode_01d3(const ScriptArguments& args, const ScriptCharacter character, c
 void opcode_01d4(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle) {
     RW_UNUSED(args);
     character->controller->skipActivity();
-    character->controller->setNextActivity(
-            std::make_unique<Activities::EnterVehicle>(
-                vehicle,Activities::EnterVehicle::ANY_SEAT));
+    character->controller->setNextActivity<Activities::EnterVehicle>(
+                vehicle,Activities::EnterVehicle::ANY_SEAT);
 }
 
 /**
@@ -5261,8 +5260,7 @@ void opcode_01d4(const ScriptArguments& args, const ScriptCharacter character, c
 */
 void opcode_01d5(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle) {
     RW_UNUSED(args);
-    character->controller->setNextActivity(
-            std::make_unique<Activities::EnterVehicle>(vehicle));
+    character->controller->setNextActivity<Activities::EnterVehicle>(vehicle);
 }
 
 /**
@@ -6004,12 +6002,10 @@ void opcode_0211(const ScriptArguments& args, const ScriptCharacter character, S
     if( character->getCurrentVehicle() )
     {
     	// Since we just cleared the Activities, this will become current immediatley.
-    	character->controller->setNextActivity(
-                    std::make_unique<Activities::ExitVehicle>());
+    	character->controller->setNextActivity<Activities::ExitVehicle>();
     }
 
-    character->controller->setNextActivity(
-            std::make_unique<Activities::GoTo>(target));
+    character->controller->setNextActivity<Activities::GoTo>(target);
 }
 
 /**
@@ -6433,8 +6429,7 @@ void opcode_0237(const ScriptArguments& args, const ScriptGang gangID, const Scr
 */
 void opcode_0239(const ScriptArguments& args, const ScriptCharacter character, ScriptVec2 coord) {
     auto target = script::getGround(args, glm::vec3(coord, -100.f));
-    character->controller->setNextActivity(
-            std::make_unique<Activities::GoTo>(target, true));
+    character->controller->setNextActivity<Activities::GoTo>(target, true);
 }
 
 /**
@@ -7849,6 +7844,8 @@ void opcode_02e3(const ScriptArguments& args, const ScriptVehicle vehicle, Scrip
     @arg arg1 
 */
 void opcode_02e4(const ScriptArguments& args, const ScriptString arg1) {
+    // Read the animations while the tracks are being parsed
+    args.getWorld()->prefetchCutscene(arg1);
     args.getWorld()->loadCutscene(arg1);
     args.getState()->cutsceneStartTime = -1.f;
 
@@ -0,0 +1,934 @@
+#ifndef _RWENGINE_GTA3MODULEOPCODES_HPP_
+#define _RWENGINE_GTA3MODULEOPCODES_HPP_
+
+#include <script/ScriptTypes.hpp>
+
+/**
+ * Declarations of the opcode implementations in GTA3ModuleImpl.inl, so code
+ * translated by scmtranslate can call them directly from outside
+ * GTA3Module.cpp.
+ */
+
+void opcode_0000(const ScriptArguments& args);
+void opcode_0001(const ScriptArguments& args, const ScriptInt time);
+void opcode_0002(const ScriptArguments& args, const ScriptLabel arg1);
+void opcode_0003(const ScriptArguments& args, const ScriptInt time);
+void opcode_0004(const ScriptArguments& args, ScriptInt& arg1G, const ScriptInt arg2);
+void opcode_0005(const ScriptArguments& args, ScriptFloat& arg1G, const ScriptFloat arg2);
+void opcode_0006(const ScriptArguments& args, ScriptInt& arg1L, const ScriptInt arg2);
+void opcode_0007(const ScriptArguments& args, ScriptFloat& arg1L, const ScriptFloat arg2);
+void opcode_0008(const ScriptArguments& args, ScriptInt& arg1G, const ScriptInt arg2);
+void opcode_0009(const ScriptArguments& args, ScriptFloat& arg1G, const ScriptFloat arg2);
+void opcode_000a(const ScriptArguments& args, ScriptInt& arg1L, const ScriptInt arg2);
+void opcode_000b(const ScriptArguments& args, ScriptFloat& arg1L, const ScriptFloat arg2);
+void opcode_000c(const ScriptArguments& args, ScriptInt& arg1G, const ScriptInt arg2);
+void opcode_000d(const ScriptArguments& args, ScriptFloat& arg1G, const ScriptFloat arg2);
+void opcode_000e(const ScriptArguments& args, ScriptInt& arg1L, const ScriptInt arg2);
+void opcode_000f(const ScriptArguments& args, ScriptFloat& arg1L, const ScriptFloat arg2);
+void opcode_0010(const ScriptArguments& args, ScriptInt& arg1G, const ScriptInt arg2);
+void opcode_0011(const ScriptArguments& args, ScriptFloat& arg1G, const ScriptFloat arg2);
+void opcode_0012(const ScriptArguments& args, ScriptInt& arg1L, const ScriptInt arg2);
+void opcode_0013(const ScriptArguments& args, ScriptFloat& arg1L, const ScriptFloat arg2);
+void opcode_0014(const ScriptArguments& args, ScriptInt& arg1G, const ScriptInt arg2);
+void opcode_0015(const ScriptArguments& args, ScriptFloat& arg1G, const ScriptFloat arg2);
+void opcode_0016(const ScriptArguments& args, ScriptInt& arg1L, const ScriptInt arg2);
+void opcode_0017(const ScriptArguments& args, ScriptFloat& arg1L, const ScriptFloat arg2);
+bool opcode_0018(const ScriptArguments& args, ScriptInt& arg1G, const ScriptInt arg2);
+bool opcode_0019(const ScriptArguments& args, ScriptInt& arg1L, const ScriptInt arg2);
+bool opcode_001a(const ScriptArguments& args, const ScriptInt arg1, ScriptInt& arg2G);
+bool opcode_001b(const ScriptArguments& args, const ScriptInt arg1, ScriptInt& arg2L);
+bool opcode_001c(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2G);
+bool opcode_001d(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2L);
+bool opcode_001e(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2L);
+bool opcode_001f(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2G);
+bool opcode_0020(const ScriptArguments& args, ScriptFloat& arg1G, const ScriptFloat arg2);
+bool opcode_0021(const ScriptArguments& args, ScriptFloat& arg1L, const ScriptFloat arg2);
+bool opcode_0022(const ScriptArguments& args, const ScriptFloat arg1, ScriptFloat& arg2G);
+bool opcode_0023(const ScriptArguments& args, const ScriptFloat arg1, ScriptFloat& arg2L);
+bool opcode_0024(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2G);
+bool opcode_0025(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2L);
+bool opcode_0026(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2L);
+bool opcode_0027(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2G);
+bool opcode_0028(const ScriptArguments& args, ScriptInt& arg1G, const ScriptInt arg2);
+bool opcode_0029(const ScriptArguments& args, ScriptInt& arg1L, const ScriptInt arg2);
+bool opcode_002a(const ScriptArguments& args, const ScriptInt arg1, ScriptInt& arg2G);
+bool opcode_002b(const ScriptArguments& args, const ScriptInt arg1, ScriptInt& arg2L);
+bool opcode_002c(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2G);
+bool opcode_002d(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2L);
+bool opcode_002e(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2L);
+bool opcode_002f(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2G);
+bool opcode_0030(const ScriptArguments& args, ScriptFloat& arg1G, const ScriptFloat arg2);
+bool opcode_0031(const ScriptArguments& args, ScriptFloat& arg1L, const ScriptFloat arg2);
+bool opcode_0032(const ScriptArguments& args, const ScriptFloat arg1, ScriptFloat& arg2G);
+bool opcode_0033(const ScriptArguments& args, const ScriptFloat arg1, ScriptFloat& arg2L);
+bool opcode_0034(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2G);
+bool opcode_0035(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2L);
+bool opcode_0036(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2L);
+bool opcode_0037(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2G);
+bool opcode_0038(const ScriptArguments& args, ScriptInt& arg1G, const ScriptInt arg2);
+bool opcode_0039(const ScriptArguments& args, ScriptInt& arg1L, const ScriptInt arg2);
+bool opcode_003a(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2G);
+bool opcode_003b(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2L);
+bool opcode_003c(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2L);
+bool opcode_0042(const ScriptArguments& args, ScriptFloat& arg1G, const ScriptFloat arg2);
+bool opcode_0043(const ScriptArguments& args, ScriptFloat& arg1L, const ScriptFloat arg2);
+bool opcode_0044(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2G);
+bool opcode_0045(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2L);
+bool opcode_0046(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2L);
+void opcode_004c(const ScriptArguments& args, const ScriptLabel arg1);
+void opcode_004d(const ScriptArguments& args, const ScriptLabel arg1);
+void opcode_004e(const ScriptArguments& args);
+void opcode_004f(const ScriptArguments& args, const ScriptLabel arg1);
+void opcode_0050(const ScriptArguments& args, const ScriptLabel arg1);
+void opcode_0051(const ScriptArguments& args);
+void opcode_0053(const ScriptArguments& args, const ScriptInt index, ScriptVec3 coord, ScriptPlayer& player);
+void opcode_0054(const ScriptArguments& args, const ScriptPlayer player, ScriptFloat& xCoord, ScriptFloat& yCoord, ScriptFloat& zCoord);
+void opcode_0055(const ScriptArguments& args, const ScriptPlayer player, ScriptVec3 coord);
+bool opcode_0056(const ScriptArguments& args, const ScriptPlayer player, ScriptVec2 coord0, ScriptVec2 coord1, const ScriptBoolean arg6);
+bool opcode_0057(const ScriptArguments& args, const ScriptPlayer player, ScriptVec3 coord0, ScriptVec3 coord1, const ScriptBoolean arg8);
+void opcode_0058(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2G);
+void opcode_0059(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2G);
+void opcode_005a(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2L);
+void opcode_005b(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2L);
+void opcode_005c(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2G);
+void opcode_005d(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2G);
+void opcode_005e(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2L);
+void opcode_005f(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2L);
+void opcode_0060(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2G);
+void opcode_0061(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2G);
+void opcode_0062(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2L);
+void opcode_0063(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2L);
+void opcode_0064(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2G);
+void opcode_0065(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2G);
+void opcode_0066(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2L);
+void opcode_0067(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2L);
+void opcode_0068(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2G);
+void opcode_0069(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2G);
+void opcode_006a(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2L);
+void opcode_006b(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2L);
+void opcode_006c(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2L);
+void opcode_006d(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2L);
+void opcode_006e(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2G);
+void opcode_006f(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2G);
+void opcode_0070(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2G);
+void opcode_0071(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2G);
+void opcode_0072(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2L);
+void opcode_0073(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2L);
+void opcode_0074(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2L);
+void opcode_0075(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2L);
+void opcode_0076(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2G);
+void opcode_0077(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2G);
+void opcode_0078(const ScriptArguments& args, ScriptFloat& arg1G, const ScriptFloat arg2);
+void opcode_0079(const ScriptArguments& args, ScriptFloat& arg1L, const ScriptFloat arg2);
+void opcode_007a(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2G);
+void opcode_007b(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2L);
+void opcode_007c(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2L);
+void opcode_007d(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2G);
+void opcode_007e(const ScriptArguments& args, ScriptFloat& arg1G, const ScriptFloat arg2);
+void opcode_007f(const ScriptArguments& args, ScriptFloat& arg1L, const ScriptFloat arg2);
+void opcode_0080(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2G);
+void opcode_0081(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2L);
+void opcode_0082(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2L);
+void opcode_0083(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2G);
+void opcode_0084(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2G);
+void opcode_0085(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2L);
+void opcode_0086(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2G);
+void opcode_0087(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2L);
+void opcode_0088(const ScriptArguments& args, ScriptFloat& arg1G, ScriptFloat& arg2L);
+void opcode_0089(const ScriptArguments& args, ScriptFloat& arg1L, ScriptFloat& arg2G);
+void opcode_008a(const ScriptArguments& args, ScriptInt& arg1G, ScriptInt& arg2L);
+void opcode_008b(const ScriptArguments& args, ScriptInt& arg1L, ScriptInt& arg2G);
+void opcode_008c(const ScriptArguments& args, ScriptInt& arg1G, ScriptFloat& arg2G);
+void opcode_008d(const ScriptArguments& args, ScriptFloat& arg1G, ScriptInt& arg2G);
+void opcode_008e(const ScriptArguments& args, ScriptInt& arg1L, ScriptFloat& arg2G);
+void opcode_008f(const ScriptArguments& args, ScriptFloat& arg1L, ScriptInt& arg2G);
+void opcode_0090(const ScriptArguments& args, ScriptInt& arg1G, ScriptFloat& arg2L);
+void opcode_0091(const ScriptArguments& args, ScriptFloat& arg1G, ScriptInt& arg2L);
+void opcode_0092(const ScriptArguments& args, ScriptInt& arg1L, ScriptFloat& arg2L);
+void opcode_0093(const ScriptArguments& args, ScriptFloat& arg1L, ScriptInt& arg2L);
+void opcode_0094(const ScriptArguments& args, ScriptInt& arg1G);
+void opcode_0095(const ScriptArguments& args, ScriptInt& arg1L);
+void opcode_0096(const ScriptArguments& args, ScriptFloat& arg1G);
+void opcode_0097(const ScriptArguments& args, ScriptFloat& arg1L);
+void opcode_0098(const ScriptArguments& args, ScriptFloat& arg1G);
+void opcode_0099(const ScriptArguments& args, ScriptInt& arg1G);
+void opcode_009a(const ScriptArguments& args, const ScriptPedType pedType, const ScriptModelID model, ScriptVec3 coord, ScriptCharacter& character);
+void opcode_009b(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_009c(const ScriptArguments& args, const ScriptCharacter character, const ScriptInt arg2);
+void opcode_009d(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_009e(const ScriptArguments& args, const ScriptCharacter character, ScriptVec3 coord);
+void opcode_009f(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_00a0(const ScriptArguments& args, const ScriptCharacter character, ScriptFloat& xCoord, ScriptFloat& yCoord, ScriptFloat& zCoord);
+void opcode_00a1(const ScriptArguments& args, const ScriptCharacter character, ScriptVec3 coord);
+bool opcode_00a2(const ScriptArguments& args, const ScriptCharacter character);
+bool opcode_00a3(const ScriptArguments& args, const ScriptCharacter character, const ScriptVec2 coord0, const ScriptVec2 coord1, const ScriptBoolean arg6);
+bool opcode_00a4(const ScriptArguments& args, const ScriptCharacter character, const ScriptVec3 coord0, const ScriptVec3 coord1, const ScriptBoolean arg8);
+void opcode_00a5(const ScriptArguments& args, const ScriptModelID model, ScriptVec3 coord, ScriptVehicle& vehicle);
+void opcode_00a6(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_00a7(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptVec3 coord);
+void opcode_00a8(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_00a9(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_00aa(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptFloat& xCoord, ScriptFloat& yCoord, ScriptFloat& zCoord);
+void opcode_00ab(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptVec3 coord);
+bool opcode_00ac(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_00ad(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptFloat arg2);
+void opcode_00ae(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptDrivingMode arg2);
+void opcode_00af(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptMission arg2);
+bool opcode_00b0(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptVec2 coord0, const ScriptVec2 coord1, const ScriptBoolean arg6);
+bool opcode_00b1(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptVec3 coord0, const ScriptVec3 coord1, const ScriptBoolean arg8);
+void opcode_00ba(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt time, const ScriptInt style);
+void opcode_00bb(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt time, const ScriptInt flags);
+void opcode_00bc(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt time, const ScriptInt arg3);
+void opcode_00bd(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt time, const ScriptInt arg3);
+void opcode_00be(const ScriptArguments& args);
+void opcode_00bf(const ScriptArguments& args, ScriptInt& hour, ScriptInt& minute);
+void opcode_00c0(const ScriptArguments& args, const ScriptInt hour, const ScriptInt minute);
+void opcode_00c1(const ScriptArguments& args, const ScriptInt hour, const ScriptInt minute, ScriptInt& minutesUntil);
+bool opcode_00c2(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloat radius);
+void opcode_00c3(const ScriptArguments& args);
+void opcode_00c4(const ScriptArguments& args);
+bool opcode_00c5(const ScriptArguments& args);
+bool opcode_00c6(const ScriptArguments& args);
+void opcode_00d6(const ScriptArguments& args, const ScriptInt arg1);
+void opcode_00d7(const ScriptArguments& args, const ScriptLabel arg1);
+void opcode_00d8(const ScriptArguments& args);
+void opcode_00d9(const ScriptArguments& args, const ScriptCharacter character, ScriptVehicle& vehicle);
+void opcode_00da(const ScriptArguments& args, const ScriptPlayer player, ScriptVehicle& vehicle);
+bool opcode_00db(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle);
+bool opcode_00dc(const ScriptArguments& args, const ScriptPlayer player, const ScriptVehicle vehicle);
+bool opcode_00dd(const ScriptArguments& args, const ScriptCharacter character, const ScriptModelID model);
+bool opcode_00de(const ScriptArguments& args, const ScriptPlayer player, const ScriptModelID model);
+bool opcode_00df(const ScriptArguments& args, const ScriptCharacter character);
+bool opcode_00e0(const ScriptArguments& args, const ScriptPlayer player);
+bool opcode_00e1(const ScriptArguments& args, const ScriptPad player,
+                 const ScriptButton buttonID);
+void opcode_00e2(const ScriptArguments& args, const ScriptPad padID, const ScriptButton buttonID, ScriptInt& arg3);
+bool opcode_00e3(const ScriptArguments& args, const ScriptPlayer player, const ScriptVec2 center, const ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00e4(const ScriptArguments& args, const ScriptPlayer player, const ScriptVec2 center, const ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00e5(const ScriptArguments& args, const ScriptPlayer player, ScriptVec2 center, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00e6(const ScriptArguments& args, const ScriptPlayer player, ScriptVec2 center, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00e7(const ScriptArguments& args, const ScriptPlayer player, ScriptVec2 center, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00e8(const ScriptArguments& args, const ScriptPlayer player, ScriptVec2 center, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00e9(const ScriptArguments& args, const ScriptPlayer player, const ScriptCharacter character, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00ea(const ScriptArguments& args, const ScriptPlayer player, const ScriptCharacter character, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00eb(const ScriptArguments& args, const ScriptPlayer player, const ScriptCharacter character, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00ec(const ScriptArguments& args, const ScriptCharacter character, ScriptVec2 center, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00ed(const ScriptArguments& args, const ScriptCharacter character, ScriptVec2 center, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00ee(const ScriptArguments& args, const ScriptCharacter character, ScriptVec2 center, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00ef(const ScriptArguments& args, const ScriptCharacter character, ScriptVec2 center, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00f0(const ScriptArguments& args, const ScriptCharacter character, ScriptVec2 center, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00f1(const ScriptArguments& args, const ScriptCharacter character, ScriptVec2 center, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00f2(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00f3(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00f4(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_00f5(const ScriptArguments& args, const ScriptPlayer player, ScriptVec3 center, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_00f6(const ScriptArguments& args, const ScriptPlayer player, ScriptVec3 center, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_00f7(const ScriptArguments& args, const ScriptPlayer player, ScriptVec3 center, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_00f8(const ScriptArguments& args, const ScriptPlayer player, ScriptVec3 center, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_00f9(const ScriptArguments& args, const ScriptPlayer player, ScriptVec3 center, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_00fa(const ScriptArguments& args, const ScriptPlayer player, ScriptVec3 center, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_00fb(const ScriptArguments& args, const ScriptPlayer player, const ScriptCharacter character, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_00fc(const ScriptArguments& args, const ScriptPlayer player, const ScriptCharacter character, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_00fd(const ScriptArguments& args, const ScriptPlayer player, const ScriptCharacter character, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_00fe(const ScriptArguments& args, const ScriptCharacter character, ScriptVec3 center, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_00ff(const ScriptArguments& args, const ScriptCharacter character, ScriptVec3 center, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_0100(const ScriptArguments& args, const ScriptCharacter character, ScriptVec3 center, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_0101(const ScriptArguments& args, const ScriptCharacter character, ScriptVec3 center, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_0102(const ScriptArguments& args, const ScriptCharacter character, ScriptVec3 center, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_0103(const ScriptArguments& args, const ScriptCharacter character, ScriptVec3 center, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_0104(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_0105(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1, ScriptVec3 radius, const ScriptBoolean showMarker);
+bool opcode_0106(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1, ScriptVec3 radius, const ScriptBoolean showMarker);
+void opcode_0107(const ScriptArguments& args, const ScriptModel model, ScriptVec3 coord, ScriptObject& object);
+void opcode_0108(const ScriptArguments& args, const ScriptObject object);
+void opcode_0109(const ScriptArguments& args, const ScriptPlayer player, const ScriptInt money);
+bool opcode_010a(const ScriptArguments& args, const ScriptPlayer player, const ScriptInt money);
+void opcode_010b(const ScriptArguments& args, const ScriptPlayer player, ScriptInt& money);
+void opcode_010c(const ScriptArguments& args, const ScriptPlayer player, ScriptVec3 coord, const ScriptFloat arg5);
+void opcode_010d(const ScriptArguments& args, const ScriptPlayer player, const ScriptInt arg2);
+void opcode_010e(const ScriptArguments& args, const ScriptPlayer player, const ScriptInt arg2);
+bool opcode_010f(const ScriptArguments& args, const ScriptPlayer player, const ScriptInt arg2);
+void opcode_0110(const ScriptArguments& args, const ScriptPlayer player);
+void opcode_0111(const ScriptArguments& args, const ScriptBoolean arg1);
+bool opcode_0112(const ScriptArguments& args);
+void opcode_0113(const ScriptArguments& args, const ScriptPlayer player, const ScriptWeaponType weaponID, const ScriptInt arg3);
+void opcode_0114(const ScriptArguments& args, const ScriptCharacter character, const ScriptWeaponType weaponID, const ScriptInt arg3);
+bool opcode_0117(const ScriptArguments& args, const ScriptPlayer player);
+bool opcode_0118(const ScriptArguments& args, const ScriptCharacter character);
+bool opcode_0119(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_011a(const ScriptArguments& args, const ScriptCharacter character, const ScriptThreat arg2);
+void opcode_011c(const ScriptArguments& args, const ScriptCharacter character);
+bool opcode_0121(const ScriptArguments& args, const ScriptPlayer player, const ScriptString areaName);
+bool opcode_0122(const ScriptArguments& args, const ScriptPlayer player);
+bool opcode_0123(const ScriptArguments& args, const ScriptCharacter character, const ScriptPlayer player);
+bool opcode_0126(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_0129(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptPedType pedType, const ScriptModelID model, ScriptCharacter& character);
+void opcode_012a(const ScriptArguments& args, const ScriptPlayer player, const ScriptVec3 coord);
+bool opcode_0130(const ScriptArguments& args, const ScriptPlayer player);
+void opcode_0135(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptCarLock arg2);
+void opcode_0136(const ScriptArguments& args, const ScriptInt arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4);
+bool opcode_0137(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptModelID model);
+bool opcode_0149(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_014b(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloat angle, const ScriptModelID model, const ScriptCarColour carColour0, const ScriptCarColour carColour1, const ScriptBoolean force, const ScriptInt alarmChance, const ScriptInt lockChance, const ScriptInt time0, const ScriptInt time1, ScriptVehicleGenerator& carGen);
+void opcode_014c(const ScriptArguments& args, const ScriptVehicleGenerator carGen, const ScriptInt arg2);
+void opcode_014d(const ScriptArguments& args, const ScriptString arg1, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4);
+void opcode_014e(const ScriptArguments& args, ScriptInt& timer);
+void opcode_014f(const ScriptArguments& args, ScriptInt& unused);
+void opcode_0151(const ScriptArguments& args, ScriptInt& arg1G);
+void opcode_0152(const ScriptArguments& args, const ScriptString arg1, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt arg6, const ScriptInt arg7, const ScriptInt arg8, const ScriptInt arg9, const ScriptInt arg10, const ScriptInt arg11, const ScriptInt arg12, const ScriptInt arg13, const ScriptInt arg14, const ScriptInt arg15, const ScriptInt arg16, const ScriptInt arg17);
+bool opcode_0154(const ScriptArguments& args, const ScriptCharacter character, const ScriptString areaName);
+void opcode_0156(const ScriptArguments& args, const ScriptString arg1, const ScriptInt arg2, const ScriptInt arg3);
+void opcode_0157(const ScriptArguments& args, const ScriptPlayer player,
+                 const ScriptCamMode cameraModeID,
+                 const ScriptChangeCamMode cameraChangeModeID);
+void opcode_0158(const ScriptArguments& args, const ScriptVehicle vehicle,
+                 const ScriptCamMode cameraModeID,
+                 const ScriptChangeCamMode cameraChangeModeID);
+void opcode_0159(const ScriptArguments& args, const ScriptCharacter character,
+                 const ScriptCamMode cameraModeID,
+                 const ScriptChangeCamMode cameraChangeModeID);
+void opcode_015a(const ScriptArguments& args);
+void opcode_015c(const ScriptArguments& args, const ScriptString areaName, const ScriptBoolean arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt arg6, const ScriptInt arg7, const ScriptInt arg8, const ScriptInt arg9, const ScriptInt arg10, const ScriptInt arg11);
+void opcode_015d(const ScriptArguments& args, const ScriptFloat scale);
+bool opcode_015e(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_015f(const ScriptArguments& args, ScriptVec3 coord, ScriptVec3 rotation);
+void opcode_0160(const ScriptArguments& args, ScriptVec3 coord, const ScriptChangeCamMode arg4);
+void opcode_0161(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptBlipColour colour, const ScriptBlipDisplay display, ScriptBlip& blip);
+void opcode_0162(const ScriptArguments& args, const ScriptCharacter character, const ScriptBlipColour colour, const ScriptBlipDisplay display, ScriptBlip& blip);
+void opcode_0163(const ScriptArguments& args, const ScriptObject instance, const ScriptBlipColour colour, const ScriptBlipDisplay display, ScriptBlip& blip);
+void opcode_0164(const ScriptArguments& args, const ScriptBlip blip);
+void opcode_0165(const ScriptArguments& args, const ScriptBlip blip, const ScriptBlipColour colour);
+void opcode_0166(const ScriptArguments& args, const ScriptBlip blip, const ScriptInt brightness);
+void opcode_0167(const ScriptArguments& args, ScriptVec3 coord, const ScriptBlipColour colour, const ScriptBlipDisplay display, ScriptBlip& blip);
+void opcode_0168(const ScriptArguments& args, const ScriptBlip blip, const ScriptInt size);
+void opcode_0169(const ScriptArguments& args, ScriptRGB colour);
+void opcode_016a(const ScriptArguments& args, const ScriptInt time, const ScriptBoolean fadeIn);
+bool opcode_016b(const ScriptArguments& args);
+void opcode_016c(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloat heading);
+void opcode_016d(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloat heading);
+void opcode_016e(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloat heading);
+void opcode_016f(const ScriptArguments& args, const ScriptShadow arg1, ScriptVec3 coord, const ScriptFloat angle, const ScriptFloat arg6, const ScriptInt arg7, ScriptRGB colour);
+void opcode_0170(const ScriptArguments& args, const ScriptPlayer player, ScriptFloat& angle);
+void opcode_0171(const ScriptArguments& args, const ScriptPlayer player, const ScriptFloat angle);
+void opcode_0172(const ScriptArguments& args, const ScriptCharacter character, ScriptFloat& angle);
+void opcode_0173(const ScriptArguments& args, const ScriptCharacter character, const ScriptFloat angle);
+void opcode_0174(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptFloat& angle);
+void opcode_0175(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptFloat angle);
+void opcode_0176(const ScriptArguments& args, const ScriptObject object, ScriptFloat& angle);
+void opcode_0177(const ScriptArguments& args, const ScriptObject object, const ScriptFloat angle);
+bool opcode_0178(const ScriptArguments& args, const ScriptPlayer player, const ScriptObject object);
+bool opcode_0179(const ScriptArguments& args, const ScriptCharacter character, const ScriptObject object);
+void opcode_017a(const ScriptArguments& args, const ScriptPlayer player,
+                 const ScriptWeaponType weaponID, const ScriptInt ammo);
+void opcode_017b(const ScriptArguments& args, const ScriptCharacter character, const ScriptWeaponType weaponID, const ScriptInt arg3);
+void opcode_0180(const ScriptArguments& args, ScriptInt& arg1G);
+void opcode_0181(const ScriptArguments& args, const ScriptContact arg1, ScriptInt& arg2G);
+void opcode_0182(const ScriptArguments& args, const ScriptContact arg1, const ScriptInt arg2);
+bool opcode_0183(const ScriptArguments& args, const ScriptPlayer player, const ScriptInt value);
+bool opcode_0184(const ScriptArguments& args, const ScriptCharacter character, const ScriptInt value);
+bool opcode_0185(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptInt arg2);
+void opcode_0186(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptBlip& blip);
+void opcode_0187(const ScriptArguments& args, const ScriptCharacter character, ScriptBlip& blip);
+void opcode_0188(const ScriptArguments& args, const ScriptObject object, ScriptBlip& blip);
+void opcode_0189(const ScriptArguments& args, const ScriptVec3 coord, ScriptBlip& blip);
+void opcode_018a(const ScriptArguments& args, const ScriptVec3 coord, ScriptBlip& blip);
+void opcode_018b(const ScriptArguments& args, const ScriptBlip blip, const ScriptBlipDisplay display);
+void opcode_018c(const ScriptArguments& args, ScriptVec3 coord, const ScriptSoundType sound);
+void opcode_018d(const ScriptArguments& args, ScriptVec3 coord, const ScriptSoundType sound0, ScriptSound& sound1);
+void opcode_018e(const ScriptArguments& args, const ScriptSound sound);
+bool opcode_018f(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_0190(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_0191(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_0192(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_0193(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_0194(const ScriptArguments& args, const ScriptCharacter character, ScriptVec3 coord);
+void opcode_0195(const ScriptArguments& args, const ScriptCharacter character, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5);
+void opcode_0196(const ScriptArguments& args, const ScriptCharacter character);
+bool opcode_0197(const ScriptArguments& args, const ScriptPlayer player, const ScriptVec2 coord0, const ScriptVec2 coord1, const ScriptBoolean arg6);
+bool opcode_0198(const ScriptArguments& args, const ScriptPlayer player, const ScriptVec2 coord0, const ScriptVec2 coord1, const ScriptBoolean arg6);
+bool opcode_0199(const ScriptArguments& args, const ScriptPlayer player, const ScriptVec2 coord0, const ScriptVec2 coord1, const ScriptBoolean arg6);
+bool opcode_019a(const ScriptArguments& args, const ScriptPlayer player, const ScriptVec2 coord0, const ScriptVec2 coord1, const ScriptInt arg6);
+bool opcode_019b(const ScriptArguments& args, const ScriptPlayer player, const ScriptVec2 coord0, const ScriptVec2 coord1, const ScriptInt arg6);
+bool opcode_019c(const ScriptArguments& args, const ScriptPlayer player, const ScriptVec3 coord0, const ScriptVec3 coord1, const ScriptInt arg8);
+bool opcode_019d(const ScriptArguments& args, const ScriptPlayer player, const ScriptVec3 coord0, const ScriptVec3 coord1, const ScriptInt arg8);
+bool opcode_019e(const ScriptArguments& args, const ScriptPlayer player, const ScriptVec3 coord0, const ScriptVec3 coord1, const ScriptInt arg8);
+bool opcode_019f(const ScriptArguments& args, const ScriptPlayer player, const ScriptVec3 coord0, const ScriptVec3 coord1, const ScriptInt arg8);
+bool opcode_01a0(const ScriptArguments& args, const ScriptPlayer player, const ScriptVec3 coord0, const ScriptVec3 coord1, const ScriptInt arg8);
+bool opcode_01a1(const ScriptArguments& args, const ScriptCharacter character, const ScriptVec2 coord0, const ScriptVec2 coord1, const ScriptBoolean arg6);
+bool opcode_01a2(const ScriptArguments& args, const ScriptCharacter character, const ScriptVec2 coord0, const ScriptVec2 coord1, const ScriptBoolean arg6);
+bool opcode_01a3(const ScriptArguments& args, const ScriptCharacter character, const ScriptVec2 coord0, const ScriptVec2 coord1, const ScriptBoolean arg6);
+bool opcode_01a4(const ScriptArguments& args, const ScriptCharacter character, const ScriptVec2 coord0, const ScriptVec2 coord1, const ScriptBoolean arg6);
+bool opcode_01a5(const ScriptArguments& args, const ScriptCharacter character, const ScriptVec2 coord0, const ScriptVec2 coord1, const ScriptBoolean arg6);
+bool opcode_01a6(const ScriptArguments& args, const ScriptCharacter character, const ScriptVec3 coord0, const ScriptVec3 coord1, const ScriptBoolean arg8);
+bool opcode_01a7(const ScriptArguments& args, const ScriptCharacter character, const ScriptVec3 coord0, const ScriptVec3 coord1, const ScriptBoolean arg8);
+bool opcode_01a8(const ScriptArguments& args, const ScriptCharacter character, const ScriptVec3 coord0, const ScriptVec3 coord1, const ScriptBoolean arg8);
+bool opcode_01a9(const ScriptArguments& args, const ScriptCharacter character, const ScriptVec3 coord0, const ScriptVec3 coord1, const ScriptBoolean arg8);
+bool opcode_01aa(const ScriptArguments& args, const ScriptCharacter character, const ScriptVec3 coord0, const ScriptVec3 coord1, const ScriptBoolean arg8);
+bool opcode_01ab(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptVec2 coord0, const ScriptVec2 coord1, const ScriptBoolean arg6);
+bool opcode_01ac(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptVec3 coord0, const ScriptVec3 coord1, const ScriptBoolean arg8);
+bool opcode_01ad(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptVec2 coord, const ScriptVec2 radius, const ScriptBoolean arg6);
+bool opcode_01ae(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptVec2 coord, const ScriptVec2 radius, const ScriptBoolean arg6);
+bool opcode_01af(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptVec3 coord, const ScriptVec3 radius, const ScriptBoolean arg8);
+bool opcode_01b0(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptVec3 coord, const ScriptVec3 radius, const ScriptBoolean arg8);
+void opcode_01b1(const ScriptArguments& args, const ScriptPlayer player, const ScriptWeaponType weaponID, const ScriptInt bullets);
+void opcode_01b2(const ScriptArguments& args, const ScriptCharacter character, const ScriptWeaponType weaponID, const ScriptInt bullets);
+void opcode_01b4(const ScriptArguments& args, const ScriptPlayer player,
+                 const ScriptBoolean control);
+void opcode_01b5(const ScriptArguments& args, const ScriptWeather weatherID);
+void opcode_01b6(const ScriptArguments& args, const ScriptWeather weatherID);
+void opcode_01b7(const ScriptArguments& args);
+void opcode_01b8(const ScriptArguments& args, const ScriptPlayer player, const ScriptWeaponType weaponId);
+void opcode_01b9(const ScriptArguments& args, const ScriptCharacter character, const ScriptWeaponType weaponID);
+void opcode_01bb(const ScriptArguments& args, const ScriptObject object, ScriptFloat& xCoord, ScriptFloat& yCoord, ScriptFloat& zCoord);
+void opcode_01bc(const ScriptArguments& args, const ScriptObject object, ScriptVec3 coord);
+void opcode_01bd(const ScriptArguments& args, ScriptInt& time);
+void opcode_01be(const ScriptArguments& args, const ScriptCharacter character,
+                 const ScriptVec3 coord);
+void opcode_01c0(const ScriptArguments& args, const ScriptPlayer player, ScriptInt& wantedLevel);
+bool opcode_01c1(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_01c2(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_01c3(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_01c4(const ScriptArguments& args, const ScriptObject object);
+void opcode_01c5(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_01c6(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_01c7(const ScriptArguments& args, const ScriptObject object);
+void opcode_01c8(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptPedType pedType, const ScriptModelID model, const ScriptInt arg4, ScriptCharacter& character);
+void opcode_01c9(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1);
+void opcode_01ca(const ScriptArguments& args, const ScriptCharacter character, const ScriptPlayer player);
+void opcode_01cb(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1);
+void opcode_01cc(const ScriptArguments& args, const ScriptCharacter character, const ScriptPlayer player);
+void opcode_01ce(const ScriptArguments& args, const ScriptCharacter character, const ScriptPlayer player);
+void opcode_01cf(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1);
+void opcode_01d0(const ScriptArguments& args, const ScriptCharacter character, const ScriptPlayer player);
+void opcode_01d1(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1);
+void opcode_01d2(const ScriptArguments& args, const ScriptCharacter character, const ScriptPlayer player);
+void opcode_01d3(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle);
+void opcode_01d4(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle);
+void opcode_01d5(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle);
+void opcode_01d8(const ScriptArguments& args, const ScriptCharacter character, const ScriptObject object);
+void opcode_01d9(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle);
+void opcode_01de(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1);
+void opcode_01df(const ScriptArguments& args, const ScriptCharacter character, const ScriptPlayer player);
+void opcode_01e0(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_01e1(const ScriptArguments& args, const ScriptCharacter character, const ScriptInt arg2, const ScriptFollowRoute arg3);
+void opcode_01e2(const ScriptArguments& args, const ScriptInt arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4);
+void opcode_01e3(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt time, const ScriptInt style);
+void opcode_01e4(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt time, const ScriptInt arg4);
+void opcode_01e5(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt time, const ScriptInt arg4);
+void opcode_01e7(const ScriptArguments& args, ScriptVec3 coord0, ScriptVec3 coord1);
+void opcode_01e8(const ScriptArguments& args, ScriptVec3 coord0, ScriptVec3 coord1);
+void opcode_01e9(const ScriptArguments& args, const ScriptVehicle vehicle,
+                 ScriptInt& numOfPassengers);
+void opcode_01ea(const ScriptArguments& args, const ScriptVehicle vehicle,
+                 ScriptInt& maxNumOfPassengers);
+void opcode_01eb(const ScriptArguments& args, const ScriptFloat arg1);
+void opcode_01ec(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptBoolean arg2);
+void opcode_01ed(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_01ee(const ScriptArguments& args, const ScriptFloat arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptFloat arg7, const ScriptFloat arg8, const ScriptFloat arg9, const ScriptFloat arg10);
+void opcode_01ef(const ScriptArguments& args, const ScriptFloat arg1, const ScriptFloat arg2);
+void opcode_01f0(const ScriptArguments& args, const ScriptInt wantedLevel);
+bool opcode_01f3(const ScriptArguments& args, const ScriptVehicle vehicle);
+bool opcode_01f4(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_01f5(const ScriptArguments& args, const ScriptPlayer player, ScriptCharacter& character);
+void opcode_01f6(const ScriptArguments& args);
+void opcode_01f7(const ScriptArguments& args, const ScriptPlayer player, const ScriptBoolean arg2);
+void opcode_01f9(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptWeaponType weaponID, const ScriptInt time, const ScriptInt arg4, const ScriptModelID model0, const ScriptModelID model1, const ScriptModelID model2, const ScriptModelID model3, const ScriptBoolean arg9);
+void opcode_01fa(const ScriptArguments& args, ScriptInt& arg1);
+void opcode_01fb(const ScriptArguments& args, const ScriptFloat arg1, ScriptFloat& arg2);
+bool opcode_01fc(const ScriptArguments& args, const ScriptPlayer player, const ScriptVehicle vehicle, const ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_01fd(const ScriptArguments& args, const ScriptPlayer player, const ScriptVehicle vehicle, const ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_01fe(const ScriptArguments& args, const ScriptPlayer player, const ScriptVehicle vehicle, const ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_01ff(const ScriptArguments& args, const ScriptPlayer player, const ScriptVehicle vehicle, ScriptVec3 radius, const ScriptBoolean arg6);
+bool opcode_0200(const ScriptArguments& args, const ScriptPlayer player, const ScriptVehicle vehicle, ScriptVec3 radius, const ScriptBoolean arg6);
+bool opcode_0201(const ScriptArguments& args, const ScriptPlayer player, const ScriptVehicle vehicle, ScriptVec3 radius, const ScriptBoolean arg6);
+bool opcode_0202(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_0203(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_0204(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle, ScriptVec2 radius, const ScriptBoolean showMarker);
+bool opcode_0205(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle, ScriptVec3 radius, const ScriptBoolean arg6);
+bool opcode_0206(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle, ScriptVec3 radius, const ScriptBoolean arg6);
+bool opcode_0207(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle, ScriptVec3 radius, const ScriptBoolean arg6);
+void opcode_0208(const ScriptArguments& args, const ScriptFloat min, const ScriptFloat max, ScriptFloat& result);
+void opcode_0209(const ScriptArguments& args, const ScriptInt min, const ScriptInt max, ScriptInt& result);
+void opcode_020a(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptCarLock arg2);
+void opcode_020b(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_020c(const ScriptArguments& args, ScriptVec3 coord, const ScriptExplosion explosionID);
+bool opcode_020d(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_020e(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1);
+void opcode_020f(const ScriptArguments& args, const ScriptCharacter character, const ScriptPlayer player);
+void opcode_0210(const ScriptArguments& args, const ScriptPlayer player, const ScriptCharacter character);
+void opcode_0211(const ScriptArguments& args, const ScriptCharacter character, ScriptVec2 coord);
+void opcode_0213(const ScriptArguments& args, const ScriptModel model, const ScriptPickupType pickup0, ScriptVec3 coord, ScriptPickup& pickup1);
+bool opcode_0214(const ScriptArguments& args, const ScriptPickup pickup);
+void opcode_0215(const ScriptArguments& args, const ScriptPickup pickup);
+void opcode_0216(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptBoolean arg2);
+void opcode_0217(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt time, const ScriptInt arg3);
+void opcode_0218(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt time, const ScriptInt arg4);
+void opcode_0219(const ScriptArguments& args, const ScriptVec3 coord0,
+                 const ScriptVec3 coord1, const ScriptGarageType type,
+                 ScriptGarage& garage);
+void opcode_021b(const ScriptArguments& args, const ScriptGarage garage, const ScriptVehicle vehicle);
+bool opcode_021c(const ScriptArguments& args, const ScriptGarage garage);
+void opcode_021d(const ScriptArguments& args, const ScriptInt arg1);
+bool opcode_0220(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_0221(const ScriptArguments& args, const ScriptPlayer player, const ScriptBoolean arg2);
+void opcode_0222(const ScriptArguments& args, const ScriptPlayer player, const ScriptInt health);
+void opcode_0223(const ScriptArguments& args, const ScriptCharacter character, const ScriptInt health);
+void opcode_0224(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptInt arg2);
+void opcode_0225(const ScriptArguments& args, const ScriptPlayer player, ScriptInt& health);
+void opcode_0226(const ScriptArguments& args, const ScriptCharacter character, ScriptInt& health);
+void opcode_0227(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptInt& arg2);
+bool opcode_0228(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptCarBomb arg2);
+void opcode_0229(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptCarColour carColour0, const ScriptCarColour carColour1);
+void opcode_022a(const ScriptArguments& args, ScriptVec3 coord0, ScriptVec3 coord1);
+void opcode_022b(const ScriptArguments& args, ScriptVec3 coord0, ScriptVec3 coord1);
+void opcode_022c(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1);
+void opcode_022d(const ScriptArguments& args, const ScriptCharacter character, const ScriptPlayer player);
+void opcode_022e(const ScriptArguments& args, const ScriptPlayer player, const ScriptCharacter character);
+void opcode_022f(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_0230(const ScriptArguments& args, const ScriptPlayer player);
+void opcode_0231(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_0235(const ScriptArguments& args, const ScriptGang gangID, const ScriptModelID model0, const ScriptModelID model1);
+void opcode_0236(const ScriptArguments& args, const ScriptGang gangID, const ScriptModelID model);
+void opcode_0237(const ScriptArguments& args, const ScriptGang gangID, const ScriptWeaponType weaponID0, const ScriptWeaponType weaponID1);
+void opcode_0239(const ScriptArguments& args, const ScriptCharacter character, ScriptVec2 coord);
+void opcode_023a(const ScriptArguments& args, const ScriptPlayer player, const ScriptObject object);
+void opcode_023b(const ScriptArguments& args, const ScriptCharacter character, const ScriptObject object);
+void opcode_023c(const ScriptArguments& args, const ScriptInt arg1, const ScriptString arg2);
+bool opcode_023d(const ScriptArguments& args, const ScriptInt arg1);
+void opcode_0240(const ScriptArguments& args, const ScriptObject object, const ScriptBoolean arg2);
+bool opcode_0241(const ScriptArguments& args, const ScriptPlayer player);
+void opcode_0242(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptCarBomb arg2);
+void opcode_0243(const ScriptArguments& args, const ScriptCharacter character, const ScriptPedStat arg2);
+void opcode_0244(const ScriptArguments& args, ScriptVec3 coord);
+void opcode_0245(const ScriptArguments& args, const ScriptCharacter character, const ScriptAnim arg2);
+void opcode_0247(const ScriptArguments& args, const ScriptModel model);
+bool opcode_0248(const ScriptArguments& args, const ScriptModel model);
+void opcode_0249(const ScriptArguments& args, const ScriptModel model);
+void opcode_024a(const ScriptArguments& args, const ScriptVec2 coord, ScriptPayphone& payphone);
+void opcode_024b(const ScriptArguments& args, const ScriptPayphone payphone, const ScriptString arg2);
+void opcode_024c(const ScriptArguments& args, const ScriptPayphone payphone, const ScriptString text);
+bool opcode_024d(const ScriptArguments& args, const ScriptPayphone payphone);
+void opcode_024e(const ScriptArguments& args, const ScriptPayphone payphone);
+void opcode_024f(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloat radius, const ScriptCoronaType arg5, const ScriptBoolean arg6, ScriptRGB colour);
+void opcode_0250(const ScriptArguments& args, ScriptVec3 coord, ScriptRGB colour);
+void opcode_0253(const ScriptArguments& args);
+void opcode_0254(const ScriptArguments& args);
+void opcode_0255(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloat heading);
+bool opcode_0256(const ScriptArguments& args, const ScriptPlayer player);
+void opcode_0291(const ScriptArguments& args, const ScriptCharacter character, const ScriptBoolean arg2);
+void opcode_0293(const ScriptArguments& args, ScriptInt& arg1);
+void opcode_0294(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptBoolean arg2);
+void opcode_0296(const ScriptArguments& args, const ScriptInt arg1);
+void opcode_0297(const ScriptArguments& args);
+void opcode_0298(const ScriptArguments& args, const ScriptModelID model0, ScriptInt& model1);
+void opcode_0299(const ScriptArguments& args, const ScriptGarage garage);
+void opcode_029b(const ScriptArguments& args, const ScriptModel model, ScriptVec3 coord, ScriptObject& object);
+bool opcode_029c(const ScriptArguments& args, const ScriptVehicle vehicle);
+bool opcode_029f(const ScriptArguments& args, const ScriptPlayer player);
+bool opcode_02a0(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_02a1(const ScriptArguments& args, const ScriptInt time, const ScriptBoolean waitSkip);
+void opcode_02a2(const ScriptArguments& args, const ScriptPObject arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptInt arg5);
+void opcode_02a3(const ScriptArguments& args, const ScriptBoolean flag);
+void opcode_02a7(const ScriptArguments& args, ScriptVec3 coord, const ScriptRadarSprite blipSprite, ScriptBlip& blip);
+void opcode_02a8(const ScriptArguments& args, ScriptVec3 coord, const ScriptRadarSprite blipSprite, ScriptBlip& blip);
+void opcode_02a9(const ScriptArguments& args, const ScriptCharacter character, const ScriptBoolean arg2);
+void opcode_02aa(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptBoolean arg2);
+void opcode_02ab(const ScriptArguments& args, const ScriptCharacter character, const ScriptBoolean arg2, const ScriptBoolean arg3, const ScriptBoolean arg4, const ScriptBoolean arg5, const ScriptBoolean arg6);
+void opcode_02ac(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptBoolean arg2, const ScriptBoolean arg3, const ScriptBoolean arg4, const ScriptBoolean arg5, const ScriptBoolean arg6);
+bool opcode_02ad(const ScriptArguments& args, const ScriptPlayer player, ScriptVec2 coord0, ScriptVec2 coord1, const ScriptFloat radius, const ScriptBoolean arg7);
+bool opcode_02ae(const ScriptArguments& args, const ScriptPlayer player, ScriptVec2 coord0, ScriptVec2 coord1, const ScriptFloat radius, const ScriptBoolean arg7);
+bool opcode_02af(const ScriptArguments& args, const ScriptPlayer player, ScriptVec2 coord0, ScriptVec2 coord1, const ScriptFloat radius, const ScriptBoolean arg7);
+bool opcode_02b0(const ScriptArguments& args, const ScriptPlayer player, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptInt arg7);
+bool opcode_02b1(const ScriptArguments& args, const ScriptPlayer player, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptInt arg7);
+bool opcode_02b2(const ScriptArguments& args, const ScriptPlayer player, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptInt arg7);
+bool opcode_02b3(const ScriptArguments& args, const ScriptPlayer player, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptFloat arg7, const ScriptFloat arg8, const ScriptInt arg9);
+bool opcode_02b4(const ScriptArguments& args, const ScriptPlayer player, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptFloat arg7, const ScriptFloat arg8, const ScriptInt arg9);
+bool opcode_02b5(const ScriptArguments& args, const ScriptPlayer player, ScriptVec3 coord0, ScriptVec3 coord1, const ScriptFloat radius, const ScriptBoolean arg9);
+bool opcode_02b6(const ScriptArguments& args, const ScriptPlayer player, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptFloat arg7, const ScriptFloat arg8, const ScriptInt arg9);
+bool opcode_02b7(const ScriptArguments& args, const ScriptPlayer player, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptFloat arg7, const ScriptFloat arg8, const ScriptInt arg9);
+bool opcode_02b8(const ScriptArguments& args, const ScriptPlayer player, ScriptVec3 coord0, ScriptVec3 coord1, const ScriptFloat radius, const ScriptBoolean arg9);
+void opcode_02b9(const ScriptArguments& args, const ScriptGarage garage);
+void opcode_02bc(const ScriptArguments& args, const ScriptInt arg1);
+bool opcode_02bf(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_02c0(const ScriptArguments& args, ScriptVec3 coord, ScriptFloat& xCoord, ScriptFloat& yCoord, ScriptFloat& zCoord);
+void opcode_02c1(const ScriptArguments& args, ScriptVec3 coord, ScriptFloat& xCoord, ScriptFloat& yCoord, ScriptFloat& zCoord);
+void opcode_02c2(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptVec3 coord);
+void opcode_02c3(const ScriptArguments& args, const ScriptInt unused);
+void opcode_02c5(const ScriptArguments& args, ScriptInt& collected);
+void opcode_02c6(const ScriptArguments& args);
+void opcode_02c7(const ScriptArguments& args, const ScriptFloat arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptInt arg5);
+void opcode_02c8(const ScriptArguments& args, ScriptInt& arg1);
+void opcode_02c9(const ScriptArguments& args);
+bool opcode_02ca(const ScriptArguments& args, const ScriptVehicle vehicle);
+bool opcode_02cb(const ScriptArguments& args, const ScriptCharacter character);
+bool opcode_02cc(const ScriptArguments& args, const ScriptObject object);
+void opcode_02cd(const ScriptArguments& args, const ScriptLabel pc, const ScriptLabel unused);
+void opcode_02ce(const ScriptArguments& args, ScriptVec3 coord, ScriptFloat& groundZ);
+void opcode_02cf(const ScriptArguments& args, ScriptVec3 coord, ScriptFire& fire);
+bool opcode_02d0(const ScriptArguments& args, const ScriptFire fire);
+void opcode_02d1(const ScriptArguments& args, const ScriptFire fire);
+void opcode_02d3(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptVec3 coord);
+void opcode_02d4(const ScriptArguments& args, const ScriptVehicle vehicle);
+bool opcode_02d5(const ScriptArguments& args, const ScriptPlayer player, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptInt arg6);
+bool opcode_02d7(const ScriptArguments& args, const ScriptPlayer player, const ScriptWeaponType weaponId);
+bool opcode_02d8(const ScriptArguments& args, const ScriptCharacter character, const ScriptWeaponType weaponID);
+void opcode_02d9(const ScriptArguments& args);
+void opcode_02db(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptFloat arg2);
+void opcode_02dd(const ScriptArguments& args, const ScriptString areaName, ScriptCharacter& character);
+bool opcode_02de(const ScriptArguments& args, const ScriptPlayer player);
+void opcode_02df(const ScriptArguments& args, const ScriptPlayer player);
+bool opcode_02e0(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_02e1(const ScriptArguments& args, ScriptVec3 coord, const ScriptInt money, ScriptPickup& pickup);
+void opcode_02e2(const ScriptArguments& args, const ScriptCharacter character, const ScriptInt arg2);
+void opcode_02e3(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptFloat& arg2);
+void opcode_02e4(const ScriptArguments& args, const ScriptString arg1);
+void opcode_02e5(const ScriptArguments& args, const ScriptModelID model, ScriptObject& object);
+void opcode_02e6(const ScriptArguments& args, const ScriptObject object, const ScriptString arg2);
+void opcode_02e7(const ScriptArguments& args);
+void opcode_02e8(const ScriptArguments& args, ScriptInt& arg1);
+bool opcode_02e9(const ScriptArguments& args);
+void opcode_02ea(const ScriptArguments& args);
+void opcode_02eb(const ScriptArguments& args);
+void opcode_02ec(const ScriptArguments& args, ScriptVec3 coord);
+void opcode_02ed(const ScriptArguments& args, const ScriptInt arg1);
+bool opcode_02ee(const ScriptArguments& args, ScriptVec3 coord0, ScriptVec3 coord1);
+void opcode_02ef(const ScriptArguments& args, const ScriptFloat arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6);
+void opcode_02f1(const ScriptArguments& args, ScriptVec3 coord);
+bool opcode_02f2(const ScriptArguments& args, const ScriptCharacter character, const ScriptModelID model);
+void opcode_02f3(const ScriptArguments& args, const ScriptModelID model, const ScriptString arg2);
+void opcode_02f4(const ScriptArguments& args, const ScriptObject object0, const ScriptModelID model, ScriptObject& object1);
+void opcode_02f5(const ScriptArguments& args, const ScriptObject object, const ScriptString arg2);
+void opcode_02f6(const ScriptArguments& args, const ScriptFloat angle, ScriptFloat& xOffset);
+void opcode_02f7(const ScriptArguments& args, const ScriptFloat angle, ScriptFloat& yOffset);
+void opcode_02f8(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptFloat& arg2);
+void opcode_02f9(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptFloat& arg2);
+void opcode_02fa(const ScriptArguments& args, const ScriptGarage garage, const ScriptGarageType garageType);
+void opcode_02fb(const ScriptArguments& args, const ScriptFloat arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptFloat arg7, const ScriptFloat arg8, const ScriptFloat arg9, const ScriptFloat arg10);
+void opcode_02fc(const ScriptArguments& args, const ScriptString arg1, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5);
+void opcode_02fd(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt time, const ScriptInt arg5);
+void opcode_02fe(const ScriptArguments& args, const ScriptString arg1, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5);
+void opcode_02ff(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt time, const ScriptInt arg6);
+void opcode_0300(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt time, const ScriptInt arg6);
+void opcode_0301(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt time, const ScriptInt arg6);
+void opcode_0302(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt time, const ScriptInt arg7);
+void opcode_0303(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt time, const ScriptInt arg7);
+void opcode_0304(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt time, const ScriptInt arg7);
+void opcode_0305(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt arg6, const ScriptInt time, const ScriptInt arg8);
+void opcode_0306(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt arg6, const ScriptInt time, const ScriptInt arg8);
+void opcode_0307(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt arg6, const ScriptInt time, const ScriptInt arg8);
+void opcode_0308(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt arg6, const ScriptInt arg7, const ScriptInt time, const ScriptInt arg9);
+void opcode_0309(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt arg6, const ScriptInt arg7, const ScriptInt time, const ScriptInt arg9);
+void opcode_030a(const ScriptArguments& args, const ScriptString arg1, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt arg6, const ScriptInt arg7, const ScriptInt arg8, const ScriptInt arg9);
+void opcode_030c(const ScriptArguments& args, const ScriptInt progress);
+void opcode_030d(const ScriptArguments& args, const ScriptInt progress);
+void opcode_030e(const ScriptArguments& args, const ScriptFloat distance);
+void opcode_030f(const ScriptArguments& args, const ScriptFloat height);
+void opcode_0310(const ScriptArguments& args, const ScriptInt flips);
+void opcode_0311(const ScriptArguments& args, const ScriptInt rotation);
+void opcode_0312(const ScriptArguments& args, const ScriptInt best);
+void opcode_0313(const ScriptArguments& args);
+void opcode_0314(const ScriptArguments& args, const ScriptInt stunts);
+void opcode_0315(const ScriptArguments& args);
+void opcode_0316(const ScriptArguments& args, const ScriptInt money);
+void opcode_0317(const ScriptArguments& args);
+void opcode_0318(const ScriptArguments& args, const ScriptString gxtEntry);
+void opcode_0319(const ScriptArguments& args, const ScriptCharacter character, const ScriptBoolean arg2);
+void opcode_031a(const ScriptArguments& args);
+bool opcode_031d(const ScriptArguments& args, const ScriptCharacter character, const ScriptWeaponType weaponID);
+bool opcode_031e(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptWeaponType weaponID);
+bool opcode_031f(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1);
+bool opcode_0320(const ScriptArguments& args, const ScriptCharacter character, const ScriptPlayer player);
+void opcode_0321(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_0322(const ScriptArguments& args, const ScriptPlayer player);
+void opcode_0323(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptBoolean arg2);
+void opcode_0324(const ScriptArguments& args, const ScriptString arg1, const ScriptBoolean arg2, const ScriptPedGrp arg3);
+void opcode_0325(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptFire& fire);
+void opcode_0326(const ScriptArguments& args, const ScriptCharacter character, ScriptFire& fire);
+void opcode_0327(const ScriptArguments& args, ScriptVec2 coord0, ScriptVec2 coord1, const ScriptModelID model, ScriptVehicle& vehicle);
+bool opcode_0329(const ScriptArguments& args, const ScriptGarage garage);
+void opcode_032a(const ScriptArguments& args, const ScriptCamZoom arg1);
+void opcode_032b(const ScriptArguments& args, const ScriptModel model, const ScriptPickupType pickup0, const ScriptInt arg3, ScriptVec3 coord, ScriptPickup& pickup1);
+void opcode_032c(const ScriptArguments& args, const ScriptVehicle vehicle0, const ScriptVehicle vehicle1);
+void opcode_032d(const ScriptArguments& args, const ScriptVehicle vehicle0, const ScriptVehicle vehicle1);
+void opcode_0330(const ScriptArguments& args, const ScriptPlayer player, const ScriptBoolean arg2);
+void opcode_0331(const ScriptArguments& args, const ScriptPlayer player, const ScriptBoolean arg2);
+void opcode_0332(const ScriptArguments& args, const ScriptCharacter character, const ScriptBoolean arg2);
+void opcode_0335(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_0336(const ScriptArguments& args, const ScriptPlayer player, const ScriptBoolean arg2);
+void opcode_0337(const ScriptArguments& args, const ScriptCharacter character, const ScriptBoolean arg2);
+bool opcode_0339(const ScriptArguments& args, ScriptVec3 coord0, ScriptVec3 coord1, const ScriptBoolean solids, const ScriptBoolean cars, const ScriptBoolean actors, const ScriptBoolean objects, const ScriptBoolean particles);
+void opcode_033a(const ScriptArguments& args);
+bool opcode_033b(const ScriptArguments& args);
+bool opcode_033c(const ScriptArguments& args);
+void opcode_033e(const ScriptArguments& args, const ScriptFloat pixelX, const ScriptFloat pixelY, const ScriptString gxtEntry);
+void opcode_033f(const ScriptArguments& args, const ScriptFloat arg1, const ScriptFloat arg2);
+void opcode_0340(const ScriptArguments& args, ScriptRGBA colour);
+void opcode_0341(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_0342(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_0343(const ScriptArguments& args, const ScriptFloat pixelX);
+void opcode_0344(const ScriptArguments& args, const ScriptFloat arg1);
+void opcode_0345(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_0346(const ScriptArguments& args, ScriptRGBA colour);
+void opcode_0348(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_0349(const ScriptArguments& args, const ScriptFont arg1);
+void opcode_034a(const ScriptArguments& args);
+void opcode_034b(const ScriptArguments& args);
+void opcode_034c(const ScriptArguments& args);
+bool opcode_034d(const ScriptArguments& args, const ScriptObject object, const ScriptFloat angle0, const ScriptFloat angle1, const ScriptBoolean arg4);
+bool opcode_034e(const ScriptArguments& args, const ScriptObject object, ScriptVec3 coord, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptFloat arg7, const ScriptBoolean arg8);
+void opcode_034f(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_0350(const ScriptArguments& args, const ScriptCharacter character, const ScriptBoolean arg2);
+bool opcode_0351(const ScriptArguments& args);
+void opcode_0352(const ScriptArguments& args, const ScriptCharacter character, const ScriptString arg2);
+void opcode_0353(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_0354(const ScriptArguments& args, const ScriptFloat arg1);
+void opcode_0355(const ScriptArguments& args);
+bool opcode_0356(const ScriptArguments& args, const ScriptExplosion explosionID, ScriptVec3 coord0, ScriptVec3 coord1);
+void opcode_0357(const ScriptArguments& args, const ScriptExplosion explosionID, const ScriptString areaName);
+void opcode_0358(const ScriptArguments& args);
+bool opcode_0359(const ScriptArguments& args);
+void opcode_035a(const ScriptArguments& args, ScriptFloat& arg1, ScriptFloat& arg2, ScriptFloat& arg3);
+void opcode_035b(const ScriptArguments& args, ScriptVec3 coord, ScriptPickup& pickup);
+void opcode_035c(const ScriptArguments& args, const ScriptObject object, const ScriptVehicle vehicle, ScriptVec3 offset);
+void opcode_035d(const ScriptArguments& args, const ScriptObject object);
+void opcode_035e(const ScriptArguments& args, const ScriptPlayer player, const ScriptInt arg2);
+void opcode_035f(const ScriptArguments& args, const ScriptCharacter character, const ScriptInt arg2);
+void opcode_0360(const ScriptArguments& args, const ScriptGarage garage);
+void opcode_0361(const ScriptArguments& args, const ScriptGarage garage);
+void opcode_0362(const ScriptArguments& args, const ScriptCharacter character,
+                 ScriptVec3 coord);
+void opcode_0363(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloat radius, const ScriptModel model, const ScriptBoolean visible);
+void opcode_0365(const ScriptArguments& args, const ScriptCharacter character);
+bool opcode_0366(const ScriptArguments& args, const ScriptObject object);
+void opcode_0367(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptWeaponType arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptModelID model0, const ScriptModelID model1, const ScriptModelID model2, const ScriptModelID model3, const ScriptBoolean arg9);
+void opcode_0368(const ScriptArguments& args, ScriptVec2 coord0, ScriptVec2 coord1, ScriptVec2 coord2, ScriptVec2 coord3, const ScriptFloat arg9, const ScriptFloat arg10);
+void opcode_0369(const ScriptArguments& args, const ScriptPlayer player, const ScriptVehicle vehicle);
+void opcode_036a(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle);
+void opcode_036d(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt time, const ScriptInt arg5);
+void opcode_036e(const ScriptArguments& args, const ScriptString arg1, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt arg6);
+void opcode_036f(const ScriptArguments& args, const ScriptString arg1, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt arg6, const ScriptInt arg7);
+void opcode_0370(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt arg6, const ScriptInt time, const ScriptInt arg8);
+void opcode_0371(const ScriptArguments& args, const ScriptString gxtEntry, const ScriptInt arg2, const ScriptInt arg3, const ScriptInt arg4, const ScriptInt arg5, const ScriptInt arg6, const ScriptInt arg7, const ScriptInt time, const ScriptInt arg9);
+void opcode_0372(const ScriptArguments& args, const ScriptCharacter character, const ScriptWaitState arg2, const ScriptInt time);
+void opcode_0373(const ScriptArguments& args);
+void opcode_0374(const ScriptArguments& args, const ScriptMotionBlur arg1);
+void opcode_0375(const ScriptArguments& args, const ScriptString gxtEntry0, const ScriptString gxtEntry1, const ScriptInt time, const ScriptInt arg4);
+void opcode_0376(const ScriptArguments& args, ScriptVec3 coord,
+                 ScriptCharacter& character);
+void opcode_0377(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_0378(const ScriptArguments& args, const ScriptPayphone payphone, const ScriptString arg2, const ScriptString arg3);
+void opcode_0379(const ScriptArguments& args, const ScriptPayphone payphone, const ScriptString arg2, const ScriptString arg3);
+void opcode_037a(const ScriptArguments& args, const ScriptPayphone payphone, const ScriptString arg2, const ScriptString arg3, const ScriptString arg4);
+void opcode_037b(const ScriptArguments& args, const ScriptPayphone payphone, const ScriptString arg2, const ScriptString arg3, const ScriptString arg4);
+void opcode_037c(const ScriptArguments& args, const ScriptPayphone payphone, const ScriptString arg2, const ScriptString arg3, const ScriptString arg4, const ScriptString arg5);
+void opcode_037d(const ScriptArguments& args, const ScriptPayphone payphone, const ScriptString arg2, const ScriptString arg3, const ScriptString arg4, const ScriptString arg5);
+bool opcode_037e(const ScriptArguments& args, ScriptVec3 coord0, ScriptVec3 coord1);
+void opcode_037f(const ScriptArguments& args);
+void opcode_0381(const ScriptArguments& args, const ScriptObject object, ScriptVec3 offset);
+void opcode_0382(const ScriptArguments& args, const ScriptObject object, const ScriptBoolean arg2);
+bool opcode_0383(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_0384(const ScriptArguments& args, const ScriptString gxtEntry0, const ScriptString gxtEntry1, const ScriptInt time, const ScriptInt arg4);
+void opcode_0385(const ScriptArguments& args, const ScriptString gxtEntry0, const ScriptString gxtEntry1, const ScriptInt time, const ScriptInt arg4);
+void opcode_0386(const ScriptArguments& args, const ScriptPayphone payphone, const ScriptString arg2, const ScriptString arg3, const ScriptString arg4, const ScriptString arg5, const ScriptString arg6);
+void opcode_0387(const ScriptArguments& args, const ScriptPayphone payphone, const ScriptString arg2, const ScriptString arg3, const ScriptString arg4, const ScriptString arg5, const ScriptString arg6);
+void opcode_0388(const ScriptArguments& args, const ScriptPayphone payphone, const ScriptString arg2, const ScriptString arg3, const ScriptString arg4, const ScriptString arg5, const ScriptString arg6, const ScriptString arg7);
+void opcode_0389(const ScriptArguments& args, const ScriptPayphone payphone, const ScriptString arg2, const ScriptString arg3, const ScriptString arg4, const ScriptString arg5, const ScriptString arg6, const ScriptString arg7);
+bool opcode_038a(const ScriptArguments& args, ScriptVec3 coord, ScriptVec3 radius);
+void opcode_038b(const ScriptArguments& args);
+void opcode_038c(const ScriptArguments& args, const ScriptObject object, ScriptVec3 offset);
+void opcode_038d(const ScriptArguments& args, const ScriptInt arg1, const ScriptFloat pixelX, const ScriptFloat pixelY, const ScriptFloat arg4, const ScriptFloat arg5, ScriptRGBA colour);
+void opcode_038f(const ScriptArguments& args, const ScriptInt arg1, const ScriptString arg2);
+void opcode_0390(const ScriptArguments& args, const ScriptString arg1);
+void opcode_0391(const ScriptArguments& args);
+void opcode_0392(const ScriptArguments& args, const ScriptObject object, const ScriptBoolean dynamic);
+void opcode_0394(const ScriptArguments& args, const ScriptInt arg1);
+void opcode_0395(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloat radius, const ScriptBoolean clearParticles);
+void opcode_0396(const ScriptArguments& args, const ScriptBoolean paused);
+void opcode_0397(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptBoolean arg2);
+void opcode_0398(const ScriptArguments& args, const ScriptFloat arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptFloat arg7);
+void opcode_0399(const ScriptArguments& args, const ScriptFloat arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptFloat arg7);
+void opcode_039a(const ScriptArguments& args, const ScriptFloat arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptFloat arg7);
+void opcode_039b(const ScriptArguments& args, const ScriptFloat arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptFloat arg7);
+void opcode_039c(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptBoolean arg2);
+void opcode_039d(const ScriptArguments& args, const ScriptPObject arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptFloat arg7, const ScriptFloat arg8, const ScriptInt arg9, const ScriptInt arg10, const ScriptInt arg11, const ScriptInt arg12);
+void opcode_039e(const ScriptArguments& args, const ScriptCharacter character, const ScriptBoolean arg2);
+void opcode_039f(const ScriptArguments& args, const ScriptVehicle vehicle,
+                 ScriptVec2 coord);
+bool opcode_03a0(const ScriptArguments& args, const ScriptFloat arg1, const ScriptFloat arg2, const ScriptVehicle vehicle);
+void opcode_03a1(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloat radius);
+void opcode_03a2(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptStatus arg2);
+bool opcode_03a3(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_03a4(const ScriptArguments& args, const ScriptString name);
+void opcode_03a5(const ScriptArguments& args, const ScriptGarage garage, const ScriptGarageType garageType, const ScriptModelID model);
+void opcode_03a6(const ScriptArguments& args, ScriptFloat& arg1, ScriptFloat& arg2, ScriptFloat& arg3);
+void opcode_03aa(const ScriptArguments& args, ScriptVec3 coord);
+void opcode_03ab(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptBoolean arg2);
+void opcode_03ac(const ScriptArguments& args, const ScriptInt arg1);
+void opcode_03ad(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_03ae(const ScriptArguments& args, const ScriptFloat arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6);
+void opcode_03af(const ScriptArguments& args, const ScriptBoolean arg1);
+bool opcode_03b0(const ScriptArguments& args, const ScriptGarage garage);
+bool opcode_03b1(const ScriptArguments& args, const ScriptGarage garage);
+void opcode_03b2(const ScriptArguments& args);
+void opcode_03b3(const ScriptArguments& args);
+void opcode_03b4(const ScriptArguments& args);
+bool opcode_03b5(const ScriptArguments& args);
+void opcode_03b6(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloat radius, const ScriptModel model0, const ScriptModel model1);
+void opcode_03b7(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_03b8(const ScriptArguments& args, const ScriptPlayer player);
+void opcode_03b9(const ScriptArguments& args, ScriptVehicle& vehicle);
+void opcode_03ba(const ScriptArguments& args, ScriptVec3 coord0, ScriptVec3 coord1);
+void opcode_03bb(const ScriptArguments& args, const ScriptGarage garage);
+void opcode_03bc(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloat radius, ScriptSphere& sphere);
+void opcode_03bd(const ScriptArguments& args, const ScriptSphere sphere);
+void opcode_03be(const ScriptArguments& args);
+void opcode_03bf(const ScriptArguments& args, const ScriptPlayer player, const ScriptBoolean arg2);
+void opcode_03c0(const ScriptArguments& args, const ScriptCharacter character, ScriptVehicle& vehicle);
+void opcode_03c1(const ScriptArguments& args, const ScriptPlayer player, ScriptVehicle& vehicle);
+bool opcode_03c2(const ScriptArguments& args, const ScriptPayphone payphone);
+void opcode_03c3(const ScriptArguments& args, ScriptInt& arg1G, const ScriptTimer arg2, const ScriptString gxtEntry);
+void opcode_03c4(const ScriptArguments& args, ScriptInt& arg1G, const ScriptBoolean arg2, const ScriptString gxtEntry);
+void opcode_03c5(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloat angle);
+bool opcode_03c6(const ScriptArguments& args, const ScriptLevel island);
+void opcode_03c7(const ScriptArguments& args, const ScriptFloat arg1);
+void opcode_03c8(const ScriptArguments& args);
+bool opcode_03c9(const ScriptArguments& args, const ScriptVehicle vehicle);
+bool opcode_03ca(const ScriptArguments& args, const ScriptObject object);
+void opcode_03cb(const ScriptArguments& args, ScriptVec3 coord);
+void opcode_03cc(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptFloat radius, const ScriptInt time);
+void opcode_03cd(const ScriptArguments& args, const ScriptVehicle vehicle);
+bool opcode_03ce(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_03cf(const ScriptArguments& args, const ScriptString soundID);
+bool opcode_03d0(const ScriptArguments& args);
+void opcode_03d1(const ScriptArguments& args);
+bool opcode_03d2(const ScriptArguments& args);
+void opcode_03d3(const ScriptArguments& args, ScriptVec3 coord, ScriptFloat& xCoord, ScriptFloat& yCoord, ScriptFloat& zCoord, ScriptFloat& angle);
+bool opcode_03d4(const ScriptArguments& args, const ScriptGarage garage, const ScriptInt index);
+void opcode_03d5(const ScriptArguments& args, const ScriptString gxtEntry);
+void opcode_03d6(const ScriptArguments& args, const ScriptString gxtEntry);
+void opcode_03d7(const ScriptArguments& args, ScriptVec3 coord);
+void opcode_03d8(const ScriptArguments& args);
+bool opcode_03d9(const ScriptArguments& args);
+void opcode_03da(const ScriptArguments& args, const ScriptGarage garage);
+void opcode_03dc(const ScriptArguments& args, const ScriptPickup pickup, ScriptBlip& blip);
+void opcode_03dd(const ScriptArguments& args, const ScriptPickup pickup, const ScriptRadarSprite blipSprite, ScriptBlip& blip);
+void opcode_03de(const ScriptArguments& args, const ScriptFloat arg1);
+void opcode_03df(const ScriptArguments& args, const ScriptPedType pedType);
+void opcode_03e0(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_03e1(const ScriptArguments& args, ScriptInt& arg1);
+void opcode_03e2(const ScriptArguments& args, const ScriptInt time);
+void opcode_03e3(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_03e4(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_03e5(const ScriptArguments& args, const ScriptString gxtEntry);
+void opcode_03e6(const ScriptArguments& args);
+void opcode_03e7(const ScriptArguments& args, const ScriptHudFlash arg1);
+void opcode_03ea(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_03eb(const ScriptArguments& args);
+bool opcode_03ec(const ScriptArguments& args);
+void opcode_03ed(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptBoolean arg2);
+bool opcode_03ee(const ScriptArguments& args, const ScriptPlayer player);
+void opcode_03ef(const ScriptArguments& args, const ScriptPlayer player);
+void opcode_03f0(const ScriptArguments& args, const ScriptInt arg1);
+void opcode_03f1(const ScriptArguments& args, const ScriptPedType pedType, const ScriptThreat arg2);
+void opcode_03f2(const ScriptArguments& args, const ScriptPedType pedType, const ScriptThreat arg2);
+void opcode_03f3(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptInt& carColour0, ScriptInt& carColour1);
+void opcode_03f4(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_03f5(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptBoolean arg2);
+void opcode_03f7(const ScriptArguments& args, const ScriptLevel arg1);
+void opcode_03f8(const ScriptArguments& args, ScriptInt& arg1);
+void opcode_03f9(const ScriptArguments& args, const ScriptCharacter character0, const ScriptCharacter character1, const ScriptInt arg3);
+void opcode_03fb(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptInt arg2);
+void opcode_03fc(const ScriptArguments& args, const ScriptCharacter character, const ScriptInt arg2);
+void opcode_03fd(const ScriptArguments& args, const ScriptInt newTime);
+void opcode_03fe(const ScriptArguments& args, const ScriptInt newTime);
+void opcode_03ff(const ScriptArguments& args, const ScriptInt newTime);
+void opcode_0400(const ScriptArguments& args, const ScriptInt newTime);
+void opcode_0401(const ScriptArguments& args);
+void opcode_0402(const ScriptArguments& args);
+void opcode_0403(const ScriptArguments& args, const ScriptInt level);
+void opcode_0404(const ScriptArguments& args);
+void opcode_0405(const ScriptArguments& args, const ScriptPayphone payphone);
+void opcode_0406(const ScriptArguments& args, const ScriptInt newTime);
+void opcode_0407(const ScriptArguments& args, const ScriptInt newTime);
+void opcode_0408(const ScriptArguments& args, const ScriptInt total);
+void opcode_0409(const ScriptArguments& args);
+void opcode_040a(const ScriptArguments& args, const ScriptInt arg1);
+bool opcode_040b(const ScriptArguments& args);
+bool opcode_040c(const ScriptArguments& args);
+void opcode_040d(const ScriptArguments& args);
+void opcode_040e(const ScriptArguments& args, const ScriptInt arg1);
+void opcode_040f(const ScriptArguments& args, const ScriptInt arg1);
+void opcode_0410(const ScriptArguments& args, const ScriptGang arg1, const ScriptInt model);
+void opcode_0411(const ScriptArguments& args, const ScriptCharacter character, const ScriptBoolean arg2);
+void opcode_0412(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptInt arg2);
+void opcode_0413(const ScriptArguments& args, const ScriptPlayer player, const ScriptBoolean arg2);
+void opcode_0414(const ScriptArguments& args, const ScriptPlayer player, const ScriptBoolean arg2);
+void opcode_0415(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptDoor arg2);
+void opcode_0417(const ScriptArguments& args, const ScriptInt arg1);
+void opcode_0418(const ScriptArguments& args, const ScriptObject object, const ScriptBoolean arg2);
+void opcode_0419(const ScriptArguments& args, const ScriptPlayer player0, const ScriptWeaponType player1, ScriptInt& arg3);
+void opcode_041a(const ScriptArguments& args, const ScriptCharacter character0, const ScriptWeaponType character1, ScriptInt& arg3);
+void opcode_041c(const ScriptArguments& args, const ScriptCharacter character, const ScriptSoundType sound);
+void opcode_041d(const ScriptArguments& args, const ScriptFloat arg1);
+void opcode_041e(const ScriptArguments& args, const ScriptRadio arg1, const ScriptInt arg2);
+void opcode_041f(const ScriptArguments& args, const ScriptLevel arg1);
+void opcode_0420(const ScriptArguments& args, const ScriptLevel arg1);
+void opcode_0421(const ScriptArguments& args, const ScriptBoolean arg1);
+bool opcode_0422(const ScriptArguments& args, const ScriptGarage garage, const ScriptVehicle vehicle);
+void opcode_0423(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptFloat arg2);
+bool opcode_0424(const ScriptArguments& args);
+void opcode_0425(const ScriptArguments& args, const ScriptFloat arg1, ScriptFloat& arg2);
+void opcode_0426(const ScriptArguments& args, ScriptVec3 coord0, ScriptVec3 coord1);
+void opcode_0427(const ScriptArguments& args, ScriptVec3 coord0, ScriptVec3 coord1);
+void opcode_0428(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptBoolean arg2);
+bool opcode_042a(const ScriptArguments& args, const ScriptPedType pedType, const ScriptThreat arg2);
+void opcode_042b(const ScriptArguments& args, ScriptVec3 coord0, ScriptVec3 coord1);
+void opcode_042c(const ScriptArguments& args, const ScriptInt arg1);
+void opcode_042d(const ScriptArguments& args, const ScriptInt arg1, ScriptInt& arg2);
+void opcode_042e(const ScriptArguments& args, const ScriptInt statID, const ScriptInt arg2);
+void opcode_042f(const ScriptArguments& args, const ScriptInt statID, const ScriptInt value);
+bool opcode_0431(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptInt arg2);
+void opcode_0432(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptInt arg2, ScriptCharacter& character);
+void opcode_0433(const ScriptArguments& args, const ScriptCharacter character, const ScriptBoolean arg2);
+void opcode_0434(const ScriptArguments& args);
+void opcode_0435(const ScriptArguments& args);
+bool opcode_0436(const ScriptArguments& args);
+void opcode_0437(const ScriptArguments& args, const ScriptParticle arg1, const ScriptFloat arg2, const ScriptFloat arg3, const ScriptFloat arg4, const ScriptFloat arg5, const ScriptFloat arg6, const ScriptFloat arg7, const ScriptFloat arg8);
+void opcode_0438(const ScriptArguments& args, const ScriptCharacter character, const ScriptBoolean arg2);
+void opcode_043a(const ScriptArguments& args);
+void opcode_043b(const ScriptArguments& args, const ScriptObject object);
+void opcode_043c(const ScriptArguments& args, const ScriptBoolean arg1);
+void opcode_043d(const ScriptArguments& args, const ScriptInt arg1);
+void opcode_043f(const ScriptArguments& args);
+void opcode_0440(const ScriptArguments& args);
+void opcode_0441(const ScriptArguments& args, const ScriptVehicle vehicle, ScriptInt& model);
+bool opcode_0442(const ScriptArguments& args, const ScriptPlayer player, const ScriptVehicle vehicle);
+bool opcode_0443(const ScriptArguments& args, const ScriptPlayer player);
+void opcode_0444(const ScriptArguments& args, const ScriptFire fire, const ScriptBoolean arg2);
+bool opcode_0445(const ScriptArguments& args);
+void opcode_0446(const ScriptArguments& args, const ScriptCharacter character, const ScriptBoolean arg2);
+bool opcode_0447(const ScriptArguments& args, const ScriptPlayer player);
+bool opcode_0448(const ScriptArguments& args, const ScriptCharacter character, const ScriptVehicle vehicle);
+bool opcode_0449(const ScriptArguments& args, const ScriptCharacter character);
+bool opcode_044a(const ScriptArguments& args, const ScriptPlayer player);
+bool opcode_044b(const ScriptArguments& args, const ScriptCharacter character);
+void opcode_044c(const ScriptArguments& args, const ScriptLevel arg1);
+void opcode_044d(const ScriptArguments& args, const ScriptString arg1);
+void opcode_044e(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptInt arg2);
+void opcode_044f(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptInt arg2);
+void opcode_0450(const ScriptArguments& args, const ScriptVehicle vehicle);
+void opcode_0451(const ScriptArguments& args);
+void opcode_0452(const ScriptArguments& args);
+void opcode_0453(const ScriptArguments& args, const ScriptObject object, ScriptVec2 rotation, const ScriptFloat angle);
+void opcode_0454(const ScriptArguments& args, ScriptFloat& xCoord, ScriptFloat& yCoord, ScriptFloat& zCoord);
+void opcode_0455(const ScriptArguments& args, ScriptFloat& arg1, ScriptFloat& arg2, ScriptFloat& arg3);
+bool opcode_0456(const ScriptArguments& args, const ScriptPlayer player);
+bool opcode_0457(const ScriptArguments& args, const ScriptPlayer player, const ScriptCharacter character);
+bool opcode_0458(const ScriptArguments& args, const ScriptPlayer player, const ScriptObject object);
+void opcode_0459(const ScriptArguments& args, const ScriptString arg1);
+void opcode_045b(const ScriptArguments& args, const ScriptFloat pixelX, const ScriptFloat pixelY, const ScriptString gxtEntry, const ScriptInt arg4, const ScriptInt arg5);
+void opcode_0463(const ScriptArguments& args, ScriptFloat& xCoord, ScriptFloat& yCoord, ScriptFloat& zCoord);
+void opcode_0477(const ScriptArguments& args, const ScriptVehicle vehicle, const ScriptTempact vehicleActionID, const ScriptInt time);
+void opcode_0494(const ScriptArguments& args);
+
+#endif
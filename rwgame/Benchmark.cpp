@@ -0,0 +1,166 @@
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <istream>
+#include <numeric>
+#include <sstream>
+
+namespace pt = boost::property_tree;
+
+bool BenchmarkTrack::load(std::istream& in) {
+    *this = BenchmarkTrack();
+
+    char separator;
+    in >> hour >> separator >> minute;
+    if (!in) {
+        return false;
+    }
+
+    float time = 0.f;
+    glm::vec3 lastPosition{};
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream ss(line);
+        std::string word;
+        if (!(ss >> word) || word[0] == '#') {
+            continue;
+        }
+
+        if (word == "weather") {
+            ss >> weather;
+            continue;
+        } else if (word == "traffic") {
+            ss >> trafficDensity;
+            continue;
+        } else if (word == "seed") {
+            fixedSeed = static_cast<bool>(ss >> seed);
+            continue;
+        }
+
+        Point point;
+        ss.clear();
+        ss.str(line);
+        ss >> point.time >> point.position.x >> point.position.y >>
+            point.position.z >> point.angle.x >> point.angle.y >>
+            point.angle.z >> point.angle.w;
+        if (!ss) {
+            continue;
+        }
+
+        // The camera moves at a steady speed between points
+        if (points.empty()) {
+            lastPosition = point.position;
+        }
+        float pointDist = glm::distance(lastPosition, point.position);
+        lastPosition = point.position;
+        point.time = time + pointDist / 50.f;
+        time = point.time;
+        duration = std::max(duration, point.time);
+        points.push_back(point);
+    }
+
+    return !points.empty();
+}
+
+void BenchmarkTrack::sample(float time, glm::vec3& position,
+                            glm::quat& angle) const {
+    if (points.empty()) {
+        return;
+    }
+
+    auto next = std::upper_bound(
+        points.begin(), points.end(), time,
+        [](float t, const Point& point) { return t < point.time; });
+    if (next == points.begin()) {
+        position = next->position;
+        angle = next->angle;
+        return;
+    }
+    if (next == points.end()) {
+        position = points.back().position;
+        angle = points.back().angle;
+        return;
+    }
+
+    const auto& a = *(next - 1);
+    const auto& b = *next;
+    float alpha = (time - a.time) / (b.time - a.time);
+    position = glm::mix(a.position, b.position, alpha);
+    angle = glm::slerp(a.angle, b.angle, alpha);
+}
+
+const BenchmarkStats::PhaseName BenchmarkStats::kPhases[6] = {
+    {"total", &FrameTimings::total},   {"update", &FrameTimings::update},
+    {"cull", &FrameTimings::cull},     {"sort", &FrameTimings::sort},
+    {"submit", &FrameTimings::submit}, {"swap", &FrameTimings::swap},
+};
+
+BenchmarkStats::Summary BenchmarkStats::summarise(Phase phase) const {
+    std::vector<float> values;
+    values.reserve(frames.size());
+    for (const auto& frame : frames) {
+        values.push_back(frame.*phase);
+    }
+    return summarise(std::move(values));
+}
+
+BenchmarkStats::Summary BenchmarkStats::summarise(std::vector<float> values) {
+    Summary summary;
+    if (values.empty()) {
+        return summary;
+    }
+
+    std::sort(values.begin(), values.end());
+    auto percentile = [&](float p) {
+        auto rank = static_cast<size_t>(
+            std::ceil(p / 100.f * static_cast<float>(values.size())));
+        return values[std::max<size_t>(rank, 1) - 1];
+    };
+
+    summary.mean = std::accumulate(values.begin(), values.end(), 0.f) /
+                   static_cast<float>(values.size());
+    summary.p50 = percentile(50.f);
+    summary.p95 = percentile(95.f);
+    summary.p99 = percentile(99.f);
+    summary.worst = values.back();
+    return summary;
+}
+
+pt::ptree BenchmarkStats::toTree() const {
+    pt::ptree tree;
+    for (const auto& phase : kPhases) {
+        const auto summary = summarise(phase.phase);
+        pt::ptree node;
+        node.put("mean", summary.mean);
+        node.put("p50", summary.p50);
+        node.put("p95", summary.p95);
+        node.put("p99", summary.p99);
+        node.put("worst", summary.worst);
+        tree.add_child(phase.name, node);
+    }
+    tree.put("frames", frames.size());
+    return tree;
+}
+
+std::vector<std::string> BenchmarkStats::findRegressions(
+    const pt::ptree& baseline, float threshold) const {
+    std::vector<std::string> regressions;
+    const auto summary = summarise(&FrameTimings::total);
+    const std::pair<const char*, float> percentiles[] = {
+        {"p50", summary.p50}, {"p95", summary.p95}, {"p99", summary.p99}};
+    for (const auto& percentile : percentiles) {
+        auto before = baseline.get_optional<float>(
+            std::string("total.") + percentile.first);
+        if (!before) {
+            continue;
+        }
+        if (percentile.second > *before * (1.f + threshold)) {
+            std::ostringstream ss;
+            ss << "total " << percentile.first << " " << percentile.second
+               << "ms, baseline " << *before << "ms";
+            regressions.push_back(ss.str());
+        }
+    }
+    return regressions;
+}
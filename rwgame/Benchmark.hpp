@@ -0,0 +1,143 @@
+#ifndef _RWGAME_BENCHMARK_HPP_
+#define _RWGAME_BENCHMARK_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+/**
+ * A camera path to fly along, and the world settings to fly it in.
+ *
+ * The file starts with the clock time as HH:MM. It is followed by optional
+ * settings, one per line:
+ *   weather ID     Forces the weather for the whole run
+ *   traffic D      Spawns traffic around the camera at density D
+ *   seed N         Seeds the world's random number generator
+ * After that come the points, as "time x y z qx qy qz qw". Lines starting
+ * with # are ignored.
+ */
+struct BenchmarkTrack {
+    struct Point {
+        float time = 0.f;
+        glm::vec3 position{};
+        glm::quat angle{1.0f, 0.0f, 0.0f, 0.0f};
+    };
+
+    int hour = 0;
+    int minute = 0;
+    /// Weather to force, or -1 to leave it alone
+    int weather = -1;
+    /// 0 spawns no traffic
+    float trafficDensity = 0.f;
+    bool fixedSeed = false;
+    std::uint32_t seed = 0;
+
+    std::vector<Point> points;
+    float duration = 0.f;
+
+    /**
+     * @return False if the file has no points
+     */
+    bool load(std::istream& in);
+
+    /**
+     * Finds the camera at a time along the track
+     */
+    void sample(float time, glm::vec3& position, glm::quat& angle) const;
+};
+
+/**
+ * How to run a benchmark and what to do with the results
+ */
+struct BenchmarkOptions {
+    /// Measured runs
+    size_t runs = 1;
+    /// Runs before those that aren't measured
+    size_t warmup = 0;
+    /// Where to write the results as JSON, if anywhere
+    std::string jsonPath;
+    /// Results of an earlier run to compare against
+    std::string baselinePath;
+    /// Fraction the total frame time can grow by before failing
+    float threshold = 0.05f;
+};
+
+/**
+ * Where the time of one frame went, in milliseconds
+ */
+struct FrameTimings {
+    float update = 0.f;
+    float cull = 0.f;
+    float sort = 0.f;
+    float submit = 0.f;
+    float swap = 0.f;
+    float total = 0.f;
+};
+
+/**
+ * Frame timings collected over one or more runs of a benchmark
+ */
+class BenchmarkStats {
+public:
+    struct Summary {
+        float mean = 0.f;
+        float p50 = 0.f;
+        float p95 = 0.f;
+        float p99 = 0.f;
+        float worst = 0.f;
+    };
+
+    using Phase = float FrameTimings::*;
+
+    struct PhaseName {
+        const char* name;
+        Phase phase;
+    };
+
+    /// Each phase with the name used in reports
+    static const PhaseName kPhases[6];
+
+    void add(const FrameTimings& frame) {
+        frames.push_back(frame);
+    }
+
+    void merge(const BenchmarkStats& other) {
+        frames.insert(frames.end(), other.frames.begin(), other.frames.end());
+    }
+
+    size_t getFrameCount() const {
+        return frames.size();
+    }
+
+    Summary summarise(Phase phase) const;
+
+    /**
+     * Percentiles use the nearest rank
+     */
+    static Summary summarise(std::vector<float> values);
+
+    /**
+     * @return Every phase's summary, then the number of frames
+     */
+    boost::property_tree::ptree toTree() const;
+
+    /**
+     * Compares the total frame time percentiles against an earlier
+     * result from toTree()
+     * @param threshold Fraction a percentile can grow by
+     * @return Descriptions of the percentiles that grew too much
+     */
+    std::vector<std::string> findRegressions(
+        const boost::property_tree::ptree& baseline, float threshold) const;
+
+private:
+    std::vector<FrameTimings> frames;
+};
+
+#endif
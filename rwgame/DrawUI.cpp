@@ -91,6 +91,8 @@ void drawMap(ViewCamera& currentView, PlayerController* player,
         map.screenPosition = (mapTop + mapBottom) / 2.f;
         map.screenSize = ui_mapSize * 0.95f;
 
+        // Keep on screen text below the radar
+        render->text.flush();
         render->map.draw(world, map);
     }
 }
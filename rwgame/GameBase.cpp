@@ -2,6 +2,7 @@
 
 //#include <rw/filesystem.hpp>
 
+#include <cstdint>
 #include <iostream>
 
 #include <SDL.h>
@@ -42,7 +43,17 @@ GameBase::GameBase(Logger &inlog, int argc, char *argv[]) :
     po::options_description desc_devel("Developer options");
     desc_devel.add_options()(
         "test,t", "Starts a new game in a test location")(
-        "benchmark,b", po::value<std::string>()->value_name("PATH"), "Run benchmark from file");
+        "benchmark,b", po::value<std::string>()->value_name("PATH"), "Run benchmark from file")(
+        "benchmark-runs", po::value<size_t>()->value_name("COUNT"), "Number of measured benchmark runs")(
+        "benchmark-warmup", po::value<size_t>()->value_name("COUNT"), "Number of benchmark runs before measuring")(
+        "benchmark-json", po::value<std::string>()->value_name("PATH"), "Write benchmark results to file")(
+        "benchmark-baseline", po::value<std::string>()->value_name("PATH"), "Compare benchmark results with an earlier --benchmark-json file")(
+        "benchmark-threshold", po::value<float>()->value_name("PERCENT"), "Allowed frame time regression against the baseline, default 5")(
+        "headless", "Simulate without rendering, as fast as possible")(
+        "ticks", po::value<size_t>()->value_name("COUNT"), "Number of ticks to simulate in headless mode")(
+        "seed", po::value<std::uint32_t>()->value_name("SEED"), "Use a fixed seed for all random number generators")(
+        "record-input", po::value<std::string>()->value_name("PATH"), "Record input for each tick to file")(
+        "replay-input", po::value<std::string>()->value_name("PATH"), "Replay input recorded with --record-input");
     po::options_description desc("Generic options");
     desc.add_options()(
         "config,c", po::value<rwfs::path>()->value_name("PATH"), "Path of configuration file")(
@@ -71,6 +82,7 @@ GameBase::GameBase(Logger &inlog, int argc, char *argv[]) :
     if (vm.count("fullscreen")) {
         fullscreen = true;
     }
+    const bool headless = vm.count("headless");
     if (vm.count("config")) {
         configPath = vm["config"].as<rwfs::path>();
     } else {
@@ -99,7 +111,10 @@ GameBase::GameBase(Logger &inlog, int argc, char *argv[]) :
     if (SDL_Init(SDL_INIT_VIDEO) < 0)
         throw std::runtime_error("Failed to initialize SDL2!");
 
-    window.create(kWindowTitle + " [" + kBuildStr + "]", w, h, fullscreen);
+    // Loaders still upload to GL, so headless mode keeps a hidden window for
+    // its context
+    window.create(kWindowTitle + " [" + kBuildStr + "]", w, h,
+                  fullscreen && !headless, !headless);
 
     SET_RW_ABORT_CB([this]() {window.showCursor();},
             [this]() {window.hideCursor();});
@@ -70,6 +70,39 @@ rwfs::path GameConfig::getDefaultConfigPath() {
     return rwfs::path();
 }
 
+rwfs::path GameConfig::getDefaultCachePath() {
+#if defined(RW_LINUX) || defined(RW_FREEBSD) || defined(RW_NETBSD) || \
+    defined(RW_OPENBSD)
+    char *cache_home = getenv("XDG_CACHE_HOME");
+    if (cache_home != nullptr) {
+        return rwfs::path(cache_home) / kConfigDirectoryName;
+    }
+    char *home = getenv("HOME");
+    if (home != nullptr) {
+        return rwfs::path(home) / ".cache/" / kConfigDirectoryName;
+    }
+
+#elif defined(RW_OSX)
+    char *home = getenv("HOME");
+    if (home)
+        return rwfs::path(home) / "Library/Caches/" / kConfigDirectoryName;
+
+#elif defined(RW_WINDOWS)
+    wchar_t *widePath;
+    auto res = SHGetKnownFolderPath(FOLDERID_LocalAppData, KF_FLAG_DEFAULT,
+                                    nullptr, &widePath);
+    if (SUCCEEDED(res)) {
+        auto utf8Path = wideStringToACP(widePath);
+        return rwfs::path(utf8Path) / kConfigDirectoryName;
+    }
+#else
+    return rwfs::path();
+#endif
+
+    RW_ERROR("No default cache path found.");
+    return rwfs::path();
+}
+
 std::string stripComments(const std::string &str) {
     auto s = std::string(str, 0, str.find_first_of(";#"));
     return s.erase(s.find_last_not_of(" \n\r\t") + 1);
@@ -242,6 +275,12 @@ GameConfig::ParseResult GameConfig::parseConfig(GameConfig::ParseType srcType,
     read_config("window.height", this->m_windowHeight, 600, intt);
     read_config("window.fullscreen", this->m_windowFullscreen, false, boolt);
 
+    read_config("memory.texture_budget", this->m_textureBudget, 256, intt);
+    read_config("memory.model_budget", this->m_modelBudget, 128, intt);
+
+    read_config("graphics.texture_compression", this->m_textureCompression,
+                false, boolt);
+
     // Build the unknown key/value map from the correct source
     switch (srcType) {
         case ParseType::FILE:
@@ -231,8 +231,31 @@ public:
     bool getWindowFullscreen() const {
         return m_windowFullscreen;
     }
+    /**
+     * @return Texture memory budget in MiB, 0 disables unloading
+     */
+    int getTextureBudget() const {
+        return m_textureBudget;
+    }
+    /**
+     * @return Model geometry budget in MiB, 0 disables unloading
+     */
+    int getModelBudget() const {
+        return m_modelBudget;
+    }
+    /**
+     * @return true to load textures from a compressed cache
+     */
+    bool getTextureCompression() const {
+        return m_textureCompression;
+    }
 
     static rwfs::path getDefaultConfigPath();
+
+    /**
+     * @return Directory for generated files that can be deleted at any time
+     */
+    static rwfs::path getDefaultCachePath();
 private:
 
     /**
@@ -272,6 +295,15 @@ private:
     
     /// Set the window to fullscreen
     bool m_windowFullscreen = false;
+
+    /// Texture memory budget in MiB
+    int m_textureBudget{256};
+
+    /// Model geometry budget in MiB
+    int m_modelBudget{128};
+
+    /// Transcode textures to compressed formats
+    bool m_textureCompression{false};
 };
 
 #endif
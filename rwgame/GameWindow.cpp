@@ -2,7 +2,7 @@
 #include <core/Logger.hpp>
 
 void GameWindow::create(const std::string& title, size_t w, size_t h,
-                        bool fullscreen) {
+                        bool fullscreen, bool visible) {
     Uint32 style = SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE | SDL_WINDOW_HIDDEN;
     if (fullscreen) style |= SDL_WINDOW_FULLSCREEN;
 
@@ -52,7 +52,9 @@ void GameWindow::create(const std::string& title, size_t w, size_t h,
         rmask, gmask, bmask, amask);
     SDL_SetWindowIcon(window, icon);
 
-    SDL_ShowWindow(window);
+    if (visible) {
+        SDL_ShowWindow(window);
+    }
 }
 
 void GameWindow::close() {
@@ -14,7 +14,12 @@ class GameWindow {
 public:
     GameWindow() = default;
 
-    void create(const std::string& title, size_t w, size_t h, bool fullscreen);
+    /**
+     * Creates the window and its GL context. A window that isn't visible
+     * still provides a context for loading resources.
+     */
+    void create(const std::string& title, size_t w, size_t h, bool fullscreen,
+                bool visible = true);
     void close();
 
     void showCursor();
@@ -14,6 +14,8 @@
 
 #include <engine/SaveGame.hpp>
 #include <objects/GameObject.hpp>
+#include <rw/arena.hpp>
+#include <rw/memorystats.hpp>
 
 #include <script/SCMFile.hpp>
 
@@ -22,9 +24,11 @@
 #include <objects/VehicleObject.hpp>
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <algorithm>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
 
 const std::map<GameRenderer::SpecialModel, std::pair<std::string, std::string>>
     kSpecialModels = {
@@ -37,6 +41,8 @@ const std::map<GameRenderer::SpecialModel, std::pair<std::string, std::string>>
 
 namespace {
 constexpr float kMaxPhysicsSubSteps = 2;
+// Five minutes of game time
+constexpr size_t kDefaultHeadlessTicks = 5 * 60 * 60;
 }  // namespace
 
 #define MOUSE_SENSITIVITY_SCALE 2.5f
@@ -52,6 +58,53 @@ RWGame::RWGame(Logger& log, int argc, char* argv[])
     std::string benchFile(options.count("benchmark")
                               ? options["benchmark"].as<std::string>()
                               : "");
+    BenchmarkOptions benchOptions;
+    if (options.count("benchmark-runs")) {
+        benchOptions.runs =
+            std::max<size_t>(1, options["benchmark-runs"].as<size_t>());
+    }
+    if (options.count("benchmark-warmup")) {
+        benchOptions.warmup = options["benchmark-warmup"].as<size_t>();
+    }
+    if (options.count("benchmark-json")) {
+        benchOptions.jsonPath = options["benchmark-json"].as<std::string>();
+    }
+    if (options.count("benchmark-baseline")) {
+        benchOptions.baselinePath =
+            options["benchmark-baseline"].as<std::string>();
+    }
+    if (options.count("benchmark-threshold")) {
+        benchOptions.threshold =
+            options["benchmark-threshold"].as<float>() / 100.f;
+    }
+
+    // There is no menu to interact with in headless mode
+    if (options.count("headless") && !test && startSave.empty() &&
+        benchFile.empty()) {
+        newgame = true;
+    }
+
+    if (options.count("seed")) {
+        fixedSeed = true;
+        randomSeed = options["seed"].as<std::uint32_t>();
+        log.info("Game", "Random seed: " + std::to_string(randomSeed));
+    }
+
+    if (options.count("record-input")) {
+        inputRecording = std::make_unique<InputLog>();
+    }
+
+    if (options.count("replay-input")) {
+        const auto replayFile = options["replay-input"].as<std::string>();
+        inputReplay = std::make_unique<InputLog>();
+        if (!inputReplay->load(replayFile)) {
+            throw std::runtime_error("Failed to load input replay: " +
+                                     replayFile);
+        }
+        log.info("Game", "Replaying " +
+                             std::to_string(inputReplay->getTickCount()) +
+                             " ticks of input from " + replayFile);
+    }
 
     log.info("Game", "Game directory: " + config.getGameDataPath().string());
 
@@ -60,6 +113,19 @@ RWGame::RWGame(Logger& log, int argc, char* argv[])
                                  config.getGameDataPath().string());
     }
 
+    if (config.getTextureBudget() > 0) {
+        data.textureResidency.setBudget(
+            static_cast<size_t>(config.getTextureBudget()) * 1024 * 1024);
+    }
+    if (config.getModelBudget() > 0) {
+        data.modelResidency.setBudget(
+            static_cast<size_t>(config.getModelBudget()) * 1024 * 1024);
+    }
+    if (config.getTextureCompression()) {
+        data.textureCache = std::make_unique<TextureCache>(
+            GameConfig::getDefaultCachePath() / "textures");
+    }
+
     data.load();
 
     for (const auto& p : kSpecialModels) {
@@ -93,7 +159,8 @@ RWGame::RWGame(Logger& log, int argc, char* argv[])
 
     StateManager::get().enter<LoadingState>(this, [=]() {
         if (!benchFile.empty()) {
-            StateManager::get().enter<BenchmarkState>(this, benchFile);
+            StateManager::get().enter<BenchmarkState>(this, benchFile,
+                                                     benchOptions);
         } else if (test) {
             StateManager::get().enter<IngameState>(this, true, "test");
         } else if (newgame) {
@@ -117,8 +184,23 @@ void RWGame::newGame() {
     state = GameState();
 
     // Destroy the current world and start over
+    snapshot.clear();
     world = std::make_unique<GameWorld>(&log, &data);
     world->dynamicsWorld->setDebugDrawer(&debug);
+    if (fixedSeed) {
+        world->randomEngine.seed(randomSeed);
+    }
+
+    clockAccumulator = 0.f;
+    scriptTimerAccumulator = 0.f;
+    beepTime = std::numeric_limits<ScriptInt>::max();
+
+    // Recordings and replays count ticks from the start of the game, not
+    // from the menu
+    tickCount = 0;
+    if (inputRecording) {
+        inputRecording->clear();
+    }
 
     // Associate the new world with the new state and vice versa
     state.world = world.get();
@@ -128,6 +210,11 @@ void RWGame::newGame() {
         world->data->loadZone(ipl.second);
         world->placeItems(ipl.second);
     }
+    world->buildGroundMap();
+    log.info("Game", "Ground map uses " +
+                         std::to_string(world->groundMap.getMemoryBytes() /
+                                        1024) +
+                         " KiB");
 }
 
 void RWGame::saveGame(const std::string& savename) {
@@ -155,6 +242,9 @@ void RWGame::startScript(const std::string& name) {
     script.reset(data.loadSCM(name));
     if (script) {
         vm = std::make_unique<ScriptMachine>(&state, script.get(), &opcodes);
+        if (fixedSeed) {
+            vm->setRandomSeed(randomSeed);
+        }
 
         state.script = vm.get();
     } else {
@@ -358,14 +448,28 @@ void RWGame::handleCheatInput(char symbol) {
 int RWGame::run() {
     namespace chrono = std::chrono;
 
+    if (options.count("headless")) {
+        return runHeadless();
+    }
+
     auto lastFrame = chrono::steady_clock::now();
     const float deltaTime = GAME_TIMESTEP;
     float accumulatedTime = 0.0f;
 
+    using Clock = chrono::steady_clock;
+    auto getMilliseconds = [](Clock::duration duration) {
+        return chrono::duration<float, std::milli>(duration).count();
+    };
+
     // Loop until we run out of states.
     bool running = true;
     while (StateManager::currentState() && running) {
         RW_PROFILE_FRAME_BOUNDARY();
+        const auto frameStart = Clock::now();
+        const auto frameAllocationStart =
+            MemoryStats::get().getHeapAllocationCount();
+        FrameTimings timings;
+        getTransientArena(ArenaScope::Frame).reset();
 
         RW_PROFILE_BEGIN("Input");
         SDL_Event event;
@@ -412,6 +516,9 @@ int RWGame::run() {
             chrono::duration<float>(currentFrame - lastFrame).count();
         lastFrame = currentFrame;
 
+        // How far into the next tick this frame is drawn
+        float alpha = 1.f;
+
         if (!world->isPaused()) {
             accumulatedTime += frameTime;
 
@@ -424,34 +531,30 @@ int RWGame::run() {
                 deltaTime * world->state->basic.timeScale;
 
             RW_PROFILE_BEGIN("Update");
+            const auto updateStart = Clock::now();
+            bool stepped = false;
             while (accumulatedTime >= deltaTime) {
                 if (!StateManager::currentState()) {
                     break;
                 }
 
-                RW_PROFILE_BEGIN("physics");
-                world->dynamicsWorld->stepSimulation(
-                    deltaTimeWithTimeScale, kMaxPhysicsSubSteps, deltaTime);
-                RW_PROFILE_END();
-
-                RW_PROFILE_BEGIN("state");
-                StateManager::get().tick(deltaTimeWithTimeScale);
-                RW_PROFILE_END();
-
-                RW_PROFILE_BEGIN("engine");
-                tick(deltaTimeWithTimeScale);
-                RW_PROFILE_END();
-
-                getState()->swapInputState();
+                step(deltaTimeWithTimeScale);
+                stepped = true;
 
                 accumulatedTime -= deltaTime;
             }
+            if (stepped) {
+                snapshot.capture(world->allObjects);
+            }
+            timings.update = getMilliseconds(Clock::now() - updateStart);
             RW_PROFILE_END();
+
+            alpha = glm::clamp(accumulatedTime / deltaTime, 0.f, 1.f);
         }
 
         RW_PROFILE_BEGIN("Render");
         RW_PROFILE_BEGIN("engine");
-        render(1, frameTime);
+        render(alpha, frameTime);
         RW_PROFILE_END();
 
         RW_PROFILE_BEGIN("state");
@@ -463,7 +566,20 @@ int RWGame::run() {
 
         renderProfile();
 
+        renderer.text.flush();
+
+        const auto& worldTimings = renderer.getWorldTimings();
+        timings.cull = worldTimings.cull;
+        timings.sort = worldTimings.sort;
+        timings.submit = worldTimings.submit;
+
+        const auto swapStart = Clock::now();
         getWindow().swap();
+        timings.swap = getMilliseconds(Clock::now() - swapStart);
+        timings.total = getMilliseconds(Clock::now() - frameStart);
+        frameTimings = timings;
+        frameAllocations =
+            MemoryStats::get().getHeapAllocationCount() - frameAllocationStart;
 
         // Make sure the topmost state is the correct state
         StateManager::get().updateStack();
@@ -473,15 +589,117 @@ int RWGame::run() {
 
     StateManager::get().clear();
 
+    saveInputRecording();
+
+    return exitCode;
+}
+
+int RWGame::runHeadless() {
+    namespace chrono = std::chrono;
+
+    size_t maxTicks = kDefaultHeadlessTicks;
+    if (options.count("ticks")) {
+        maxTicks = options["ticks"].as<size_t>();
+    } else if (inputReplay) {
+        maxTicks = inputReplay->getTickCount();
+    }
+
+    log.info("Game", "Running " + std::to_string(maxTicks) +
+                         " ticks without rendering");
+
+    const auto start = chrono::steady_clock::now();
+
+    size_t ticks = 0;
+    while (StateManager::currentState() && ticks < maxTicks) {
+        RW_PROFILE_FRAME_BOUNDARY();
+
+        // Only keep the window responsive, input comes from the replay
+        SDL_Event event;
+        while (SDL_PollEvent(&event)) {
+            if (event.type == SDL_QUIT) {
+                maxTicks = ticks;
+            }
+        }
+
+        if (!world->isPaused()) {
+            step(GAME_TIMESTEP * world->state->basic.timeScale);
+        }
+        ++ticks;
+
+        // Traffic is placed around the camera, which is otherwise updated
+        // while rendering
+        if (!StateManager::get().states.empty()) {
+            currentCam = StateManager::get().states.back()->getCamera(1.f);
+        }
+
+        StateManager::get().updateStack();
+    }
+
+    const auto seconds =
+        chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    std::ostringstream ss;
+    ss << ticks << " ticks in " << std::fixed << std::setprecision(3)
+       << seconds << "s, "
+       << (seconds > 0. ? static_cast<double>(ticks) / seconds : 0.)
+       << " ticks/s";
+    log.info("Game", ss.str());
+
+    window.close();
+
+    StateManager::get().clear();
+
+    saveInputRecording();
+
     return 0;
 }
 
+void RWGame::step(float dt) {
+    getTransientArena(ArenaScope::Tick).reset();
+
+    if (inputReplay) {
+        getState()->input[0] = inputReplay->getInput(tickCount);
+    }
+    if (inputRecording) {
+        inputRecording->record(getState()->input[0]);
+    }
+
+    world->updateLastTransforms();
+
+    RW_PROFILE_BEGIN("physics");
+    world->dynamicsWorld->stepSimulation(dt, kMaxPhysicsSubSteps,
+                                         GAME_TIMESTEP);
+    RW_PROFILE_END();
+
+    RW_PROFILE_BEGIN("state");
+    StateManager::get().tick(dt);
+    RW_PROFILE_END();
+
+    RW_PROFILE_BEGIN("engine");
+    tick(dt);
+    RW_PROFILE_END();
+
+    getState()->swapInputState();
+    ++tickCount;
+}
+
+void RWGame::saveInputRecording() {
+    if (!inputRecording) {
+        return;
+    }
+
+    const auto file = options["record-input"].as<std::string>();
+    if (inputRecording->save(file)) {
+        log.info("Game", "Recorded " +
+                             std::to_string(inputRecording->getTickCount()) +
+                             " ticks of input to " + file);
+    } else {
+        log.error("Game", "Failed to write input recording to " + file);
+    }
+}
+
 void RWGame::tick(float dt) {
     State* currState = StateManager::get().states.back().get();
 
-    static float clockAccumulator = 0.f;
-    static float scriptTimerAccumulator = 0.f;
-    static ScriptInt beepTime = std::numeric_limits<ScriptInt>::max();
     if (currState->shouldWorldUpdate()) {
         world->chase.update(dt);
 
@@ -531,7 +749,6 @@ void RWGame::tick(float dt) {
         world->updateEffects();
 
         for (auto& object : world->allObjects) {
-            object->_updateLastTransform();
             object->tick(dt);
         }
 
@@ -543,6 +760,8 @@ void RWGame::tick(float dt) {
             p->tick(dt);
         }
 
+        world->processPhysicsQueries();
+
         world->destroyQueuedObjects();
 
         state.text.tick(dt);
@@ -601,7 +820,7 @@ void RWGame::render(float alpha, float time) {
     renderer.getRenderer()->pushDebugGroup("World");
 
     RW_PROFILE_BEGIN("world");
-    renderer.renderWorld(world.get(), viewCam, alpha);
+    renderer.renderWorld(world.get(), viewCam, alpha, &snapshot);
     RW_PROFILE_END();
 
     renderer.getRenderer()->popDebugGroup();
@@ -654,6 +873,10 @@ void RWGame::renderDebugStats(float time) {
        << renderer.getCulledCount() << "/"
        << renderer.getRenderer()->getTextureCount() << "/"
        << renderer.getRenderer()->getBufferCount() << "\n"
+       << "Texture slots/MiB: " << data.textureResidency.getSlots().size()
+       << "/" << (data.textureResidency.getGPUBytes() / (1024 * 1024)) << "\n"
+       << "Models/MiB: " << data.modelResidency.getResidentCount() << "/"
+       << (data.modelResidency.getBytes() / (1024 * 1024)) << "\n"
        << "Timescale: " << world->state->basic.timeScale;
 
     TextRenderer::TextInfo ti;
@@ -2,6 +2,8 @@
 #define RWGAME_RWGAME_HPP
 
 #include <chrono>
+#include <cstdint>
+#include <limits>
 
 // FIXME: should be in rwengine, deeply hidden
 #include <BulletDynamics/Dynamics/btDiscreteDynamicsWorld.h>
@@ -9,10 +11,13 @@
 #include <engine/GameData.hpp>
 #include <engine/GameState.hpp>
 #include <engine/GameWorld.hpp>
+#include <engine/InputLog.hpp>
 #include <render/DebugDraw.hpp>
 #include <render/GameRenderer.hpp>
+#include <render/RenderSnapshot.hpp>
 #include <script/ScriptMachine.hpp>
 #include <script/modules/GTA3Module.hpp>
+#include "Benchmark.hpp"
 #include "game.hpp"
 
 #include "GameBase.hpp"
@@ -27,6 +32,9 @@ class RWGame final : public GameBase {
 
     std::unique_ptr<GameWorld> world;
 
+    /// Object motion through the last tick, for interpolated rendering
+    RenderSnapshot snapshot;
+
     GTA3Module opcodes;
     std::unique_ptr<ScriptMachine> vm;
     std::unique_ptr<SCMFile> script;
@@ -47,12 +55,53 @@ class RWGame final : public GameBase {
 
     std::string cheatInputWindow = std::string(32, ' ');
 
+    /// Seed for the world and script random number generators, when fixed
+    bool fixedSeed = false;
+    std::uint32_t randomSeed = 0;
+
+    std::unique_ptr<InputLog> inputRecording;
+    std::unique_ptr<InputLog> inputReplay;
+    /// Number of fixed steps simulated since the game started
+    size_t tickCount = 0;
+
+    float clockAccumulator = 0.f;
+    float scriptTimerAccumulator = 0.f;
+    ScriptInt beepTime = std::numeric_limits<ScriptInt>::max();
+
+    /// Where the time of the last complete frame went
+    FrameTimings frameTimings;
+
+    /// Heap allocations made during the last complete frame
+    size_t frameAllocations = 0;
+
+    /// Returned from run()
+    int exitCode = 0;
+
 public:
     RWGame(Logger& log, int argc, char* argv[]);
     ~RWGame() override;
 
     int run();
 
+    /**
+     * Sets the value run() returns once the game exits
+     */
+    void setExitCode(int code) {
+        exitCode = code;
+    }
+
+    const FrameTimings& getFrameTimings() const {
+        return frameTimings;
+    }
+
+    /**
+     * @return Heap allocations of the last frame, always 0 unless built
+     * with ENABLE_MEMORY_TRACKING
+     */
+    size_t getFrameAllocations() const {
+        return frameAllocations;
+    }
+
     /**
      * Initalizes a new game
      */
@@ -121,6 +170,19 @@ public:
     void loadGame(const std::string& savename);
 
 private:
+    /**
+     * Runs fixed steps as fast as possible without rendering, until the
+     * tick limit is reached or there are no states left.
+     */
+    int runHeadless();
+
+    /**
+     * Advances physics, states and the world by one fixed step
+     */
+    void step(float dt);
+
+    void saveInputRecording();
+
     void tick(float dt);
     void render(float alpha, float dt);
 
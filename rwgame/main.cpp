@@ -10,6 +10,7 @@ int main(int argc, char* argv[]) {
     // Initialise Logging before anything else happens
     StdOutReceiver logstdout;
     Logger logger({ &logstdout });
+    logger.startWriterThread();
 
     try {
         RWGame game(logger, argc, argv);
@@ -29,6 +30,7 @@ int main(int argc, char* argv[]) {
         const char* kErrorTitle = "Fatal Error";
 
         logger.error("exception", ex.what());
+        logger.flush();
 
         if (SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR, kErrorTitle,
                                      ex.what(), nullptr) < 0) {
@@ -1,63 +1,73 @@
 #include "BenchmarkState.hpp"
 #include <engine/GameState.hpp>
+#include <engine/GameWorld.hpp>
+#include <objects/GameObject.hpp>
 #include "RWGame.hpp"
 
+#include <boost/property_tree/json_parser.hpp>
+
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 
-BenchmarkState::BenchmarkState(RWGame* game, const std::string& benchfile)
-    : State(game), benchfile(benchfile) {
+namespace pt = boost::property_tree;
+
+BenchmarkState::BenchmarkState(RWGame* game, const std::string& benchfile,
+                               const BenchmarkOptions& options)
+    : State(game), options(options), benchfile(benchfile) {
 }
 
 void BenchmarkState::enter() {
     getWindow().hideCursor();
 
     std::ifstream benchstream(benchfile);
+    track.load(benchstream);
+
+    std::cout << "Loaded " << track.points.size() << " points" << std::endl;
+
+    startRun();
+}
+
+void BenchmarkState::startRun() {
+    auto world = game->getWorld();
+    auto state = world->state;
+
+    benchmarkTime = 0.f;
+    firstFrame = true;
+
+    state->basic.gameHour = static_cast<uint8_t>(track.hour);
+    state->basic.gameMinute = static_cast<uint8_t>(track.minute);
+    state->basic.gameMinuteMS = 0;
+
+    if (track.weather >= 0) {
+        auto weather = static_cast<uint16_t>(track.weather);
+        state->basic.lastWeather = weather;
+        state->basic.nextWeather = weather;
+        state->basic.forcedWeather = weather;
+    }
+
+    if (track.fixedSeed) {
+        world->randomEngine.seed(track.seed);
+    }
 
-    unsigned int clockHour;
-    unsigned int clockMinute;
-    benchstream >> clockHour;
-    benchstream.seekg(1, std::ios_base::cur);
-    benchstream >> clockMinute;
-
-    game->getWorld()->state->basic.gameHour = clockHour;
-    game->getWorld()->state->basic.gameMinute = clockMinute;
-
-    float time = 0.f;
-    glm::vec3 tmpPos{};
-    while (benchstream) {
-        TrackPoint point;
-        benchstream >> point.time;
-        if (!benchstream) break;
-        benchstream >> point.position.x;
-        if (!benchstream) break;
-        benchstream >> point.position.y;
-        if (!benchstream) break;
-        benchstream >> point.position.z;
-        if (!benchstream) break;
-        benchstream >> point.angle.x;
-        if (!benchstream) break;
-        benchstream >> point.angle.y;
-        if (!benchstream) break;
-        benchstream >> point.angle.z;
-        if (!benchstream) break;
-        benchstream >> point.angle.w;
-        if (!benchstream) break;
-        if (track.empty()) {
-            tmpPos = point.position;
+    // Every run starts from an empty street
+    for (auto pool : {&world->pedestrianPool, &world->vehiclePool}) {
+        for (auto& p : pool->objects) {
+            if (p.second->getLifetime() == GameObject::TrafficLifetime) {
+                world->destroyObjectQueued(p.second);
+            }
         }
-        float pointDist = glm::distance(tmpPos, point.position);
-        tmpPos = point.position;
-        point.time = time + pointDist / 50.f;
-        time = point.time;
-        duration = std::max(duration, point.time);
-        track.push_back(point);
     }
+    world->destroyQueuedObjects();
+    world->trafficDensity = track.trafficDensity;
 
-    std::cout << "Loaded " << track.size() << " points" << std::endl;
+    if (run >= options.warmup) {
+        results.emplace_back();
+    }
 }
 
 void BenchmarkState::exit() {
+    const auto duration = track.duration * (options.warmup + options.runs);
     std::cout << "Results =============\n"
               << "Benchmark: " << benchfile << "\n"
               << "Frames: " << frameCounter << "\n"
@@ -65,32 +75,115 @@ void BenchmarkState::exit() {
               << "Avg frametime: " << std::setprecision(3)
               << (duration / frameCounter) << " (" << (frameCounter / duration)
               << " fps)" << std::endl;
+
+    reportResults();
 }
 
-void BenchmarkState::tick(float dt) {
-    if (!track.empty()) {
-        TrackPoint& a = track.front();
-        TrackPoint& b = track.back();
-        for (TrackPoint& p : track) {
-            if (benchmarkTime < p.time) {
-                b = p;
-                break;
-            }
-            a = p;
+void BenchmarkState::reportResults() {
+    BenchmarkStats all;
+    for (const auto& stats : results) {
+        all.merge(stats);
+    }
+    if (all.getFrameCount() == 0) {
+        return;
+    }
+
+    std::cout << "Runs: " << results.size() << " (+" << options.warmup
+              << " warmup)\n"
+              << std::setw(8) << "ms" << std::setw(9) << "mean"
+              << std::setw(9) << "p50" << std::setw(9) << "p95"
+              << std::setw(9) << "p99" << std::setw(9) << "worst\n"
+              << std::fixed << std::setprecision(3);
+    for (const auto& phase : BenchmarkStats::kPhases) {
+        auto summary = all.summarise(phase.phase);
+        std::cout << std::setw(8) << phase.name << std::setw(9)
+                  << summary.mean << std::setw(9) << summary.p50
+                  << std::setw(9) << summary.p95 << std::setw(9)
+                  << summary.p99 << std::setw(9) << summary.worst << "\n";
+    }
+    std::cout << std::defaultfloat << std::flush;
+
+    if (!options.jsonPath.empty()) {
+        pt::ptree tree;
+        tree.put("track", benchfile);
+        tree.put("warmup", options.warmup);
+        pt::ptree runs;
+        for (const auto& stats : results) {
+            runs.push_back(std::make_pair("", stats.toTree()));
         }
-        if (benchmarkTime > duration) {
-            done();
+        tree.add_child("runs", runs);
+        tree.add_child("all", all.toTree());
+
+        try {
+            pt::write_json(options.jsonPath, tree);
+        } catch (pt::json_parser_error& e) {
+            std::cerr << "Failed to write results: " << e.what()
+                      << std::endl;
+        }
+    }
+
+    if (!options.baselinePath.empty()) {
+        pt::ptree baseline;
+        try {
+            pt::read_json(options.baselinePath, baseline);
+        } catch (pt::json_parser_error& e) {
+            std::cerr << "Failed to read baseline: " << e.what() << std::endl;
+            game->setExitCode(1);
+            return;
         }
-        if (b.time != a.time) {
-            float alpha = (benchmarkTime - a.time) / (b.time - a.time);
-            trackCam.position = glm::mix(a.position, b.position, alpha);
-            trackCam.rotation = glm::slerp(a.angle, b.angle, alpha);
+
+        // Either a whole results file or just one set of stats
+        auto combined = baseline.get_child_optional("all");
+        auto regressions = all.findRegressions(
+            combined ? *combined : baseline, options.threshold);
+        for (const auto& regression : regressions) {
+            std::cout << "Regression: " << regression << "\n";
         }
-        benchmarkTime += dt;
+        if (!regressions.empty()) {
+            game->setExitCode(1);
+        } else {
+            std::cout << "No regressions against " << options.baselinePath
+                      << "\n";
+        }
+        std::cout << std::flush;
     }
 }
 
+void BenchmarkState::tick(float dt) {
+    if (track.points.empty()) {
+        done();
+        return;
+    }
+
+    if (benchmarkTime > track.duration) {
+        if (++run >= options.warmup + options.runs) {
+            done();
+            return;
+        }
+        startRun();
+    }
+
+    track.sample(benchmarkTime, trackCam.position, trackCam.rotation);
+
+    if (track.trafficDensity > 0.f) {
+        auto world = game->getWorld();
+        trackCam.frustum.update(trackCam.frustum.projection() *
+                                trackCam.getView());
+        world->cleanupTraffic(trackCam);
+        world->createTraffic(trackCam);
+    }
+
+    benchmarkTime += dt;
+}
+
 void BenchmarkState::draw(GameRenderer* r) {
+    // The timings are from the frame before, which may belong to the
+    // previous run
+    if (!firstFrame && run >= options.warmup && !results.empty()) {
+        results.back().add(game->getFrameTimings());
+    }
+    firstFrame = false;
+
     frameCounter++;
     State::draw(r);
 }
@@ -3,24 +3,36 @@
 
 #include "State.hpp"
 
+#include "Benchmark.hpp"
+
 class BenchmarkState final : public State {
-    struct TrackPoint {
-        float time;
-        glm::vec3 position{};
-        glm::quat angle{1.0f,0.0f,0.0f,0.0f};
-    };
-    std::vector<TrackPoint> track;
+    BenchmarkTrack track;
+    BenchmarkOptions options;
 
     ViewCamera trackCam;
 
     std::string benchfile;
 
     float benchmarkTime{0.f};
-    float duration{0.f};
     uint32_t frameCounter{0};
 
+    /// Includes the warmup runs
+    size_t run{0};
+    bool firstFrame{true};
+
+    /// One for each measured run
+    std::vector<BenchmarkStats> results;
+
+    /**
+     * Resets the clock, weather and traffic to what the track asks for
+     */
+    void startRun();
+
+    void reportResults();
+
 public:
-    BenchmarkState(RWGame* game, const std::string& benchfile);
+    BenchmarkState(RWGame* game, const std::string& benchfile,
+                   const BenchmarkOptions& options = {});
 
     void enter() override;
 
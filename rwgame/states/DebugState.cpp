@@ -8,6 +8,7 @@
 #include <objects/CharacterObject.hpp>
 #include <objects/InstanceObject.hpp>
 #include <objects/VehicleObject.hpp>
+#include <rw/memorystats.hpp>
 #include <script/SCMFile.hpp>
 #include <sstream>
 #include "RWGame.hpp"
@@ -15,7 +16,7 @@
 constexpr float kDebugEntryHeight = 14.f;
 constexpr float kDebugEntryHeightMissions = 12.f;
 constexpr int kDebugFont = 2;
-const glm::vec2 kDebugMenuOffset = glm::vec2(10.f, 50.f);
+const glm::vec2 kDebugMenuOffset = glm::vec2(10.f, 60.f);
 
 static void jumpCharacter(RWGame* game, CharacterObject* player,
                           const glm::vec3& target, bool ground = true) {
@@ -59,7 +60,8 @@ std::shared_ptr<Menu> DebugState::createDebugMenu() {
          {"Full Health", [=] { player->getCurrentState().health = 100.f; }},
          {"Full Armour", [=] { player->getCurrentState().armour = 100.f; }},
          {"Cull Here",
-          [=] { game->getRenderer().setCullOverride(true, _debugCam); }}},
+          [=] { game->getRenderer().setCullOverride(true, _debugCam); }},
+         {"Dump Memory", [=] { printMemoryStats(); }}},
         kDebugFont, kDebugEntryHeight);
 
     menu->offset = kDebugMenuOffset;
@@ -375,6 +377,12 @@ void DebugState::draw(GameRenderer* r) {
     ss << "Camera Position: " << glm::to_string(_debugCam.position) << "\n";
     auto zone = getWorld()->data->findZoneAt(_debugCam.position);
     ss << (zone ? zone->name : "No Zone") << "\n";
+    ss << "Memory: " << MemoryStats::get().getTotalBytes() / (1024 * 1024)
+       << " MiB";
+    if (MemoryStats::isHeapTracked()) {
+        ss << ", " << game->getFrameAllocations() << " allocations per frame";
+    }
+    ss << "\n";
 
     TextRenderer::TextInfo ti;
     ti.font = FONT_ARIAL;
@@ -416,6 +424,9 @@ void DebugState::handleEvent(const SDL_Event& event) {
                 case SDLK_p:
                     printCameraDetails();
                     break;
+                case SDLK_m:
+                    printMemoryStats();
+                    break;
                 case SDLK_LSHIFT:
                     _sonicMode = true;
                     break;
@@ -473,6 +484,10 @@ void DebugState::printCameraDetails() {
               << " " << _debugCam.rotation.w << std::endl;
 }
 
+void DebugState::printMemoryStats() {
+    MemoryStats::get().dump(std::cout);
+}
+
 void DebugState::spawnVehicle(unsigned int id) {
     auto ch = game->getWorld()->getPlayer()->getCharacter();
     if (!ch) return;
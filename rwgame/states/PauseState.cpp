@@ -40,6 +40,7 @@ void PauseState::draw(GameRenderer* r) {
     map.screenPosition = glm::vec2(vp.x / 2, vp.y / 2);
     map.screenSize = std::max(vp.x, vp.y);
 
+    r->text.flush();
     game->getRenderer().map.draw(getWorld(), map);
 
     State::draw(r);
@@ -0,0 +1,80 @@
+#include <script/SCMDisassembler.hpp>
+#include <script/SCMFile.hpp>
+#include <script/SCMTranslator.hpp>
+#include <script/modules/GTA3Module.hpp>
+#include <rw/filesystem.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+int main(int argc, const char* argv[]) {
+    namespace po = boost::program_options;
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help", "Show this help message")
+        ("scm,s", po::value<rwfs::path>()->value_name("PATH")->required(), "Path to main.scm")
+        ("output,o", po::value<rwfs::path>()->value_name("PATH")->required(), "Output C++ file")
+    ;
+
+    po::variables_map vm;
+    try {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help")) {
+            std::cout << desc;
+            return EXIT_SUCCESS;
+        }
+        po::notify(vm);
+    } catch (po::error &ex) {
+        std::cerr << "Error parsing arguments: " << ex.what() << std::endl;
+        std::cerr << desc;
+        return EXIT_FAILURE;
+    }
+
+    const auto scmPath = vm["scm"].as<rwfs::path>();
+    std::ifstream scmStream(scmPath.string(), std::ios::binary);
+    if (!scmStream) {
+        std::cerr << "Failed to open " << scmPath << "\n";
+        return EXIT_FAILURE;
+    }
+    std::vector<char> data((std::istreambuf_iterator<char>(scmStream)),
+                           std::istreambuf_iterator<char>());
+
+    SCMFile file;
+    file.loadFile(data.data(), static_cast<unsigned int>(data.size()));
+
+    GTA3Module module;
+    SCMDisassembler disassembler(file, module);
+    disassembler.addFileEntryPoints();
+    auto blocks = disassembler.getBlocks();
+
+    const auto outPath = vm["output"].as<rwfs::path>();
+    std::ofstream out(outPath.string());
+    if (!out) {
+        std::cerr << "Failed to open " << outPath << " for writing\n";
+        return EXIT_FAILURE;
+    }
+
+    SCMTranslator translator(file);
+    translator.write(out, blocks, scmPath.filename().string());
+
+    size_t instructionCount = 0;
+    for (const auto& block : blocks) {
+        instructionCount += block.instructions.size();
+    }
+
+    std::cout << "Translated " << instructionCount << " instructions in "
+              << blocks.size() << " blocks\n";
+    for (auto address : disassembler.getInvalidAddresses()) {
+        std::cout << "Left to the interpreter: undecodable code at "
+                  << std::hex << std::setfill('0') << std::setw(6) << address
+                  << std::dec << "\n";
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,110 @@
+#include <gl/TextureCompression.hpp>
+#include <loaders/TextureCache.hpp>
+#include <platform/FileHandle.hpp>
+#include <platform/FileIndex.hpp>
+#include <rw/filesystem.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Size of an image uploaded as RGBA8 with every mipmap level
+size_t uncompressedSize(const TextureImage& image) {
+    size_t bytes = 0;
+    int width = image.width;
+    int height = image.height;
+    for (size_t i = 0; i < image.levels.size(); ++i) {
+        bytes += TextureCompression::getLevelSize(
+            TextureCompression::Format::RGBA8, width, height);
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+    }
+    return bytes;
+}
+
+size_t storedSize(const TextureImage& image) {
+    size_t bytes = 0;
+    for (const auto& level : image.levels) {
+        bytes += level.size();
+    }
+    return bytes;
+}
+
+std::string megabytes(size_t bytes) {
+    return std::to_string(bytes / (1024 * 1024)) + "." +
+           std::to_string((bytes % (1024 * 1024)) * 10 / (1024 * 1024)) +
+           " MiB";
+}
+
+}  // namespace
+
+int main(int argc, const char* argv[]) {
+    namespace po = boost::program_options;
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help", "Show this help message")
+        ("data,d", po::value<rwfs::path>()->value_name("PATH")->required(), "Path to the game data")
+        ("cache,c", po::value<rwfs::path>()->value_name("PATH")->required(), "Texture cache directory")
+    ;
+
+    po::variables_map vm;
+    try {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help")) {
+            std::cout << desc;
+            return EXIT_SUCCESS;
+        }
+        po::notify(vm);
+    } catch (po::error &ex) {
+        std::cerr << "Error parsing arguments: " << ex.what() << std::endl;
+        std::cerr << desc;
+        return EXIT_FAILURE;
+    }
+
+    FileIndex index;
+    try {
+        index.indexTree(vm["data"].as<rwfs::path>());
+        index.indexArchive("models/gta3.img");
+    } catch (std::exception& ex) {
+        std::cerr << "Failed to index game data: " << ex.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    TextureCache cache(vm["cache"].as<rwfs::path>());
+
+    size_t textureCount = 0;
+    size_t before = 0;
+    size_t after = 0;
+    size_t failed = 0;
+    for (const auto& name : index.listFiles(".txd")) {
+        auto file = index.openFile(name);
+        std::vector<TextureImage> images;
+        if (!file.data || !cache.load(name, file, images)) {
+            std::cerr << "Failed to transcode " << name << "\n";
+            failed++;
+            continue;
+        }
+
+        for (const auto& image : images) {
+            before += uncompressedSize(image);
+            after += storedSize(image);
+        }
+        textureCount += images.size();
+    }
+
+    std::cout << "Transcoded " << textureCount << " textures\n";
+    std::cout << "Texture memory as RGBA8: " << megabytes(before) << "\n";
+    std::cout << "Texture memory compressed: " << megabytes(after) << "\n";
+    if (failed > 0) {
+        std::cout << failed << " dictionaries could not be read\n";
+    }
+
+    return failed > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
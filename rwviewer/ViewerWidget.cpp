@@ -132,6 +132,7 @@ void ViewerWidget::drawText(GameRenderer& r) {
     for(auto &textInfo : textInfos) {
         _renderer->text.renderText(textInfo, false);
     }
+    _renderer->text.flush();
     r.renderPostProcess();
 }
 
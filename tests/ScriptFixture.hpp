@@ -0,0 +1,146 @@
+#ifndef _TESTSCRIPTFIXTURE_HPP_
+#define _TESTSCRIPTFIXTURE_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <script/ScriptTypes.hpp>
+
+class ScriptNativeCode;
+
+/**
+ * A small SCM file that only uses opcodes that don't need a world.
+ *
+ * rwtests_translate runs it through SCMTranslator at build time, and the
+ * result is built into the tests so the translated code can be compared
+ * with the interpreter without game data.
+ */
+namespace script_fixture {
+
+/// Bytes of global variables
+constexpr std::int32_t kGlobalsSize = 32;
+
+/// Offsets of the globals the script writes to
+enum class Variable : std::uint16_t {
+    Counter = 0,
+    Real = 4,
+    Random = 8,
+    Countdown = 12,
+    RandomSum = 16,
+    Copy = 20,
+};
+
+/// Number of times the script runs its loop
+constexpr ScriptInt kIterations = 21;
+
+class Writer {
+public:
+    std::vector<char> data;
+
+    std::int32_t address() const {
+        return static_cast<std::int32_t>(data.size());
+    }
+
+    template <class T>
+    void put(T value) {
+        const auto bytes = reinterpret_cast<const char*>(&value);
+        data.insert(data.end(), bytes, bytes + sizeof(T));
+    }
+
+    Writer& op(std::uint16_t opcode) {
+        put(opcode);
+        return *this;
+    }
+
+    Writer& i8(std::int8_t value) {
+        return operand(TInt8, value);
+    }
+
+    Writer& i16(std::int16_t value) {
+        return operand(TInt16, value);
+    }
+
+    Writer& i32(std::int32_t value) {
+        return operand(TInt32, value);
+    }
+
+    Writer& f16(float value) {
+        return operand(TFloat16, static_cast<std::int16_t>(value * 16.f));
+    }
+
+    Writer& global(Variable offset) {
+        return operand(TGlobal, static_cast<std::uint16_t>(offset));
+    }
+
+    Writer& local(std::uint16_t index) {
+        return operand(TLocal, index);
+    }
+
+private:
+    template <class T>
+    Writer& operand(SCMType type, T value) {
+        put(static_cast<std::uint8_t>(type));
+        put(value);
+        return *this;
+    }
+};
+
+inline std::vector<char> build() {
+    // Each header section is behind a jump to the next one
+    const std::int32_t models = 8 + kGlobalsSize;
+    const std::int32_t missions = models + 12;
+    const std::int32_t code = missions + 20;
+
+    Writer w;
+    w.op(0x0002).i32(models);
+    w.put<char>(0);
+    w.data.resize(static_cast<size_t>(models), 0);
+
+    w.op(0x0002).i32(missions);
+    w.put<char>(0);
+    w.put<std::uint32_t>(0);  // Models
+
+    w.op(0x0002).i32(code);
+    w.put<char>(0);
+    w.put<std::uint32_t>(0);  // Main size
+    w.put<std::uint32_t>(0);  // Largest mission
+    w.put<std::uint32_t>(0);  // Missions
+
+    // Typed arithmetic, opcode calls, random numbers and a conditional loop
+    w.op(0x0004).global(Variable::Counter).i8(0);
+    w.op(0x0005).global(Variable::Real).f16(1.5f);
+    w.op(0x0004).global(Variable::Countdown).i16(1000);
+    w.op(0x0006).local(0).i8(3);
+    w.op(0x0209).i8(0).i8(100).global(Variable::Random);
+
+    const auto loop = w.address();
+    w.op(0x0008).global(Variable::Counter).i8(1);
+    w.op(0x0009).global(Variable::Real).f16(0.25f);
+    w.op(0x000C).global(Variable::Countdown).i8(7);
+    w.op(0x000A).local(0).i8(2);
+    w.op(0x0209).i8(0).i16(1000).global(Variable::Random);
+    w.op(0x0058).global(Variable::RandomSum).global(Variable::Random);
+    w.op(0x008A).global(Variable::Copy).local(0);
+    w.op(0x0001).i8(0);
+    w.op(0x00D6).i8(0);
+    w.op(0x0018).global(Variable::Counter).i8(kIterations - 1);
+    w.op(0x004D).i32(loop);
+
+    const auto end = w.address();
+    w.op(0x0001).i8(0);
+    w.op(0x0002).i32(end);
+
+    const auto mainSize = static_cast<std::uint32_t>(w.address() - code);
+    std::memcpy(w.data.data() + missions + 8, &mainSize, sizeof(mainSize));
+    return w.data;
+}
+
+/**
+ * @return The fixture's translated code, generated by rwtests_translate
+ */
+const ScriptNativeCode& getCode();
+
+}  // namespace script_fixture
+
+#endif
@@ -0,0 +1,31 @@
+#include <script/SCMDisassembler.hpp>
+#include <script/SCMFile.hpp>
+#include <script/SCMTranslator.hpp>
+#include <script/modules/GTA3Module.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include "ScriptFixture.hpp"
+
+// Writes the translated script fixture to the given file
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: " << argv[0] << " <output>\n";
+        return EXIT_FAILURE;
+    }
+
+    auto data = script_fixture::build();
+    SCMFile file;
+    file.loadFile(data.data(), static_cast<unsigned int>(data.size()));
+
+    GTA3Module module;
+    SCMDisassembler disassembler(file, module);
+    disassembler.addFileEntryPoints();
+
+    std::ofstream out(argv[1]);
+    SCMTranslator(file).write(out, disassembler.getBlocks(),
+                              "ScriptFixture.hpp", "script_fixture");
+    return out ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,4 +1,5 @@
 #include <boost/test/unit_test.hpp>
+#include <cmath>
 #include <data/Clump.hpp>
 #include <engine/Animator.hpp>
 #include <loaders/LoaderIFP.hpp>
@@ -7,6 +8,81 @@
 
 BOOST_AUTO_TEST_SUITE(AnimationTests)
 
+namespace {
+std::vector<AnimationKeyframe> makeKeyframes(int count) {
+    std::vector<AnimationKeyframe> keyframes;
+    for (int i = 0; i < count; ++i) {
+        const auto time = static_cast<float>(i) * 0.25f;
+        keyframes.emplace_back(
+            glm::angleAxis(time * 1.3f, glm::normalize(glm::vec3(1.f, 2.f, 3.f))),
+            glm::vec3(0.f, time, 0.f), glm::vec3(1.f), time, i);
+    }
+    return keyframes;
+}
+
+float rotationDifference(const glm::quat& a, const glm::quat& b) {
+    // q and -q are the same rotation
+    return 1.f - std::abs(glm::dot(a, b));
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(test_packed_rotation) {
+    const glm::quat rotations[] = {
+        glm::quat{1.f, 0.f, 0.f, 0.f},
+        glm::quat{0.f, 0.f, 0.f, -1.f},
+        glm::angleAxis(2.5f, glm::normalize(glm::vec3(-1.f, 0.5f, 0.25f))),
+        glm::angleAxis(-0.7f, glm::normalize(glm::vec3(0.f, 1.f, -1.f))),
+    };
+    for (const auto& rotation : rotations) {
+        const auto unpacked = PackedRotation::pack(rotation).unpack();
+        BOOST_CHECK_SMALL(rotationDifference(rotation, unpacked), 1e-4f);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_interpolated_keyframe) {
+    const auto keyframes = makeKeyframes(5);
+    Animation animation;
+    auto bone = animation.addBone("bone", AnimationBone::RT0, keyframes);
+
+    BOOST_CHECK_EQUAL(bone->keyframeCount, 5u);
+    BOOST_CHECK_CLOSE(bone->duration, 1.f, 1e-4f);
+
+    for (float time = 0.1f; time < 1.f; time += 0.1f) {
+        const auto next = static_cast<size_t>(std::ceil(time / 0.25f));
+        const auto& f1 = keyframes[next - 1];
+        const auto& f2 = keyframes[next];
+        const auto alpha = (time - f1.starttime) / (f2.starttime - f1.starttime);
+
+        const auto frame = bone->getInterpolatedKeyframe(time);
+        const auto expected =
+            glm::normalize(glm::slerp(f1.rotation, f2.rotation, alpha));
+        BOOST_CHECK_SMALL(rotationDifference(frame.rotation, expected), 1e-4f);
+        BOOST_CHECK_SMALL(frame.position.y - time, 1e-4f);
+        BOOST_CHECK_EQUAL(frame.id, static_cast<int>(next));
+    }
+
+    // Past the end holds the last keyframe
+    const auto last = bone->getInterpolatedKeyframe(2.f);
+    BOOST_CHECK_EQUAL(last.id, 4);
+    BOOST_CHECK_CLOSE(last.position.y, 1.f, 1e-4f);
+}
+
+BOOST_AUTO_TEST_CASE(test_shared_tracks) {
+    const auto keyframes = makeKeyframes(10);
+    Animation animation;
+    animation.addBone("first", AnimationBone::RT0, keyframes);
+    const auto times = animation.tracks.times.size();
+
+    auto second = animation.addBone("second", AnimationBone::R00, keyframes);
+    BOOST_CHECK_EQUAL(animation.tracks.times.size(), times);
+    BOOST_CHECK_EQUAL(animation.tracks.translations.size(), 10u);
+    BOOST_CHECK_EQUAL(second->getKeyframe(3).position.y, 0.f);
+
+    BOOST_CHECK_EQUAL(animation.getKeyframeCount(), 20u);
+    BOOST_CHECK_LT(animation.tracks.getBytes(),
+                   animation.getKeyframeCount() * sizeof(AnimationKeyframe));
+}
+
 #if RW_TEST_WITH_DATA
 BOOST_AUTO_TEST_CASE(test_matrix) {
     {
@@ -19,17 +95,12 @@ BOOST_AUTO_TEST_CASE(test_matrix) {
         Animator animator(test_model);
 
         animation->duration = 1.f;
-        animation->bones["player"] = new AnimationBone{
-                "player",
-                0,
-                0,
-                1.0f,
-                AnimationBone::RT0,
-                {
-                    {glm::quat{1.0f,0.0f,0.0f,0.0f}, glm::vec3(0.f, 0.f, 0.f), glm::vec3(), 0.f, 0},
-                    {glm::quat{1.0f,0.0f,0.0f,0.0f}, glm::vec3(0.f, 1.f, 0.f), glm::vec3(), 1.0f, 1},
-                }
-            };
+        animation->addBone(
+            "player", AnimationBone::RT0,
+            {
+                {glm::quat{1.0f,0.0f,0.0f,0.0f}, glm::vec3(0.f, 0.f, 0.f), glm::vec3(), 0.f, 0},
+                {glm::quat{1.0f,0.0f,0.0f,0.0f}, glm::vec3(0.f, 1.f, 0.f), glm::vec3(), 1.0f, 1},
+            });
 
         animator.playAnimation(0, animation, 1.f, false);
 
@@ -0,0 +1,84 @@
+#include <boost/test/unit_test.hpp>
+#include <rw/arena.hpp>
+#include "test_Globals.hpp"
+
+#include <cstdint>
+
+BOOST_AUTO_TEST_SUITE(ArenaTests)
+
+BOOST_AUTO_TEST_CASE(test_alignment) {
+    LinearArena arena(1024);
+    arena.allocate(1, 1);
+    auto aligned = arena.allocate(16, 16);
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(aligned) % 16, 0u);
+    BOOST_CHECK_EQUAL(arena.getLiveAllocations(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(test_rewind) {
+    LinearArena arena(1024);
+    auto a = arena.allocate(100, 4);
+    auto b = arena.allocate(100, 4);
+    BOOST_CHECK_GE(arena.getUsedBytes(), 200u);
+
+    // Freeing the last allocation gives it back
+    arena.deallocate(b, 100);
+    BOOST_CHECK_EQUAL(arena.getUsedBytes(), 100u);
+
+    // Everything is free, so the arena starts over
+    arena.deallocate(a, 100);
+    BOOST_CHECK_EQUAL(arena.getUsedBytes(), 0u);
+    BOOST_CHECK_EQUAL(arena.allocate(100, 4), a);
+}
+
+BOOST_AUTO_TEST_CASE(test_reset_merges_blocks) {
+    LinearArena arena(1024);
+    auto a = arena.allocate(1000, 4);
+    auto b = arena.allocate(1000, 4);
+    auto c = arena.allocate(4000, 4);
+    BOOST_CHECK_EQUAL(arena.getBlockAllocations(), 3u);
+    BOOST_CHECK_GE(arena.getPeakBytes(), 6000u);
+
+    arena.deallocate(c, 4000);
+    arena.deallocate(b, 1000);
+    arena.deallocate(a, 1000);
+    arena.reset();
+    BOOST_CHECK_EQUAL(arena.getBlockAllocations(), 4u);
+    BOOST_CHECK_GE(arena.getCapacity(), 6000u);
+
+    // The next frame fits in the merged block
+    arena.allocate(1000, 4);
+    arena.allocate(1000, 4);
+    arena.allocate(4000, 4);
+    BOOST_CHECK_EQUAL(arena.getBlockAllocations(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(test_transient_vectors) {
+    auto& arena = getTransientArena(ArenaScope::Tick);
+    auto blocks = arena.getBlockAllocations();
+    {
+        TickVector<int> values;
+        for (int i = 0; i < 1000; ++i) {
+            values.push_back(i);
+        }
+        BOOST_CHECK_EQUAL(values[999], 999);
+        BOOST_CHECK_GT(arena.getLiveAllocations(), 0u);
+        BOOST_CHECK(values.get_allocator().getArena() == &arena);
+    }
+    BOOST_CHECK_EQUAL(arena.getLiveAllocations(), 0u);
+    arena.reset();
+
+    // A second pass is served without touching the heap
+    auto grown = arena.getBlockAllocations();
+    BOOST_CHECK_GE(grown, blocks);
+    {
+        TickVector<int> values;
+        for (int i = 0; i < 1000; ++i) {
+            values.push_back(i);
+        }
+    }
+    BOOST_CHECK_EQUAL(arena.getBlockAllocations(), grown);
+
+    BOOST_CHECK(&getTransientArena(ArenaScope::Frame) != &arena);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
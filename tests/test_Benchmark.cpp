@@ -0,0 +1,88 @@
+#include <boost/test/unit_test.hpp>
+#include <Benchmark.hpp>
+#include "test_Globals.hpp"
+
+#include <sstream>
+
+namespace {
+BenchmarkStats makeStats(float scale) {
+    BenchmarkStats stats;
+    for (auto i = 1; i <= 100; ++i) {
+        FrameTimings frame;
+        frame.total = static_cast<float>(i) * scale;
+        frame.update = 1.f;
+        stats.add(frame);
+    }
+    return stats;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(BenchmarkTests)
+
+BOOST_AUTO_TEST_CASE(test_track_load) {
+    std::istringstream in(
+        "08:24\n"
+        "# Rush hour\n"
+        "weather 2\n"
+        "traffic 1.5\n"
+        "seed 1234\n"
+        "0.0 0 0 0 0 0 0 1\n"
+        "0.0 100 0 0 0 0 0 1\n"
+        "0.0 100 50 0 0 0 0 1\n");
+    BenchmarkTrack track;
+    BOOST_REQUIRE(track.load(in));
+
+    BOOST_CHECK_EQUAL(track.hour, 8);
+    BOOST_CHECK_EQUAL(track.minute, 24);
+    BOOST_CHECK_EQUAL(track.weather, 2);
+    BOOST_CHECK_CLOSE(track.trafficDensity, 1.5f, 0.01f);
+    BOOST_CHECK(track.fixedSeed);
+    BOOST_CHECK_EQUAL(track.seed, 1234u);
+
+    // The camera moves at 50 units a second
+    BOOST_REQUIRE_EQUAL(track.points.size(), 3u);
+    BOOST_CHECK_CLOSE(track.points[1].time, 2.f, 0.01f);
+    BOOST_CHECK_CLOSE(track.duration, 3.f, 0.01f);
+}
+
+BOOST_AUTO_TEST_CASE(test_track_defaults) {
+    std::istringstream in("12:00\n0.0 0 0 0 0 0 0 1\n");
+    BenchmarkTrack track;
+    BOOST_REQUIRE(track.load(in));
+    BOOST_CHECK_EQUAL(track.weather, -1);
+    BOOST_CHECK_EQUAL(track.trafficDensity, 0.f);
+    BOOST_CHECK(!track.fixedSeed);
+
+    std::istringstream empty("12:00\n");
+    BOOST_CHECK(!track.load(empty));
+}
+
+BOOST_AUTO_TEST_CASE(test_percentiles) {
+    auto summary = BenchmarkStats::summarise({5.f, 1.f, 4.f, 2.f, 3.f});
+    BOOST_CHECK_CLOSE(summary.mean, 3.f, 0.01f);
+    BOOST_CHECK_EQUAL(summary.p50, 3.f);
+    BOOST_CHECK_EQUAL(summary.p95, 5.f);
+    BOOST_CHECK_EQUAL(summary.worst, 5.f);
+
+    auto stats = makeStats(1.f);
+    auto total = stats.summarise(&FrameTimings::total);
+    BOOST_CHECK_EQUAL(total.p50, 50.f);
+    BOOST_CHECK_EQUAL(total.p95, 95.f);
+    BOOST_CHECK_EQUAL(total.p99, 99.f);
+    BOOST_CHECK_EQUAL(total.worst, 100.f);
+
+    auto tree = stats.toTree();
+    BOOST_CHECK_EQUAL(tree.get<size_t>("frames"), 100u);
+    BOOST_CHECK_EQUAL(tree.get<float>("update.p99"), 1.f);
+}
+
+BOOST_AUTO_TEST_CASE(test_regressions) {
+    auto baseline = makeStats(1.f).toTree();
+
+    BOOST_CHECK(makeStats(1.04f).findRegressions(baseline, 0.05f).empty());
+    BOOST_CHECK(makeStats(0.5f).findRegressions(baseline, 0.05f).empty());
+    BOOST_CHECK_EQUAL(makeStats(1.1f).findRegressions(baseline, 0.05f).size(),
+                      3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -7,6 +7,76 @@
 
 BOOST_AUTO_TEST_SUITE(CharacterTests)
 
+namespace {
+class TestController : public CharacterController {
+public:
+    glm::vec3 getTargetPosition() override {
+        return {};
+    }
+};
+
+struct CountedActivity : public CharacterController::Activity {
+    DECL_ACTIVITY(CountedActivity)
+
+    int& alive;
+
+    CountedActivity(int& alive) : alive(alive) {
+        alive++;
+    }
+    ~CountedActivity() override {
+        alive--;
+    }
+
+    bool update(CharacterObject*, CharacterController*) override {
+        return true;
+    }
+};
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(test_activity_slot) {
+    int alive = 0;
+    {
+        CharacterController::ActivitySlot slot;
+        BOOST_CHECK_EQUAL(slot.get(), nullptr);
+
+        slot.emplace<CountedActivity>(alive);
+        BOOST_CHECK_EQUAL(alive, 1);
+        BOOST_CHECK_EQUAL(slot.get()->name(), "CountedActivity");
+
+        // Replacing the activity destroys the previous one
+        slot.emplace<CountedActivity>(alive);
+        BOOST_CHECK_EQUAL(alive, 1);
+
+        slot.reset();
+        BOOST_CHECK_EQUAL(alive, 0);
+        BOOST_CHECK_EQUAL(slot.get(), nullptr);
+
+        slot.emplace<CountedActivity>(alive);
+    }
+    BOOST_CHECK_EQUAL(alive, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_next_activity) {
+    TestController controller;
+
+    controller.setNextActivity<Activities::GoTo>(glm::vec3{1.f, 0.f, 0.f});
+    BOOST_REQUIRE(controller.getCurrentActivity() != nullptr);
+    BOOST_CHECK(controller.isCurrentActivity(Activities::GoTo::ActivityName));
+    BOOST_CHECK_EQUAL(controller.getNextActivity(), nullptr);
+
+    controller.setNextActivity<Activities::Jump>();
+    BOOST_CHECK(controller.isCurrentActivity(Activities::GoTo::ActivityName));
+    BOOST_REQUIRE(controller.getNextActivity() != nullptr);
+    BOOST_CHECK_EQUAL(controller.getNextActivity()->name(), "Jump");
+
+    // A later request replaces the pending activity
+    controller.setNextActivity<Activities::ExitVehicle>();
+    BOOST_CHECK_EQUAL(controller.getNextActivity()->name(), "ExitVehicle");
+
+    controller.skipActivity();
+    BOOST_CHECK_EQUAL(controller.getCurrentActivity(), nullptr);
+}
+
 #if RW_TEST_WITH_DATA
 BOOST_AUTO_TEST_CASE(test_create) {
     {
@@ -21,8 +91,8 @@ BOOST_AUTO_TEST_CASE(test_create) {
         BOOST_CHECK_EQUAL(controller->getCurrentActivity(), nullptr);
 
         // Check that Idle activities are instantly displaced.
-        controller->setNextActivity(
-            std::make_unique<Activities::GoTo>(glm::vec3{1000.f, 0.f, 0.f}));
+        controller->setNextActivity<Activities::GoTo>(
+            glm::vec3{1000.f, 0.f, 0.f});
 
         BOOST_CHECK_EQUAL(controller->getCurrentActivity()->name(), "GoTo");
         BOOST_CHECK_EQUAL(controller->getNextActivity(), nullptr);
@@ -40,8 +110,8 @@ BOOST_AUTO_TEST_CASE(test_activities) {
         auto controller = character->controller;
         BOOST_REQUIRE(controller != nullptr);
 
-        controller->setNextActivity(
-            std::make_unique<Activities::GoTo>(glm::vec3{10.f, 10.f, 0.f}));
+        controller->setNextActivity<Activities::GoTo>(
+            glm::vec3{10.f, 10.f, 0.f});
 
         BOOST_CHECK_EQUAL(controller->getCurrentActivity()->name(), "GoTo");
 
@@ -70,8 +140,7 @@ BOOST_AUTO_TEST_CASE(test_activities) {
         auto controller = character->controller;
         BOOST_REQUIRE(controller != nullptr);
 
-        controller->setNextActivity(
-            std::make_unique<Activities::EnterVehicle>(vehicle, 0));
+        controller->setNextActivity<Activities::EnterVehicle>(vehicle, 0);
 
         for (float t = 0.f; t < 0.5f; t += (1.f / 60.f)) {
             character->tick(1.f / 60.f);
@@ -87,8 +156,7 @@ BOOST_AUTO_TEST_CASE(test_activities) {
 
         BOOST_CHECK_EQUAL(vehicle, character->getCurrentVehicle());
 
-        controller->setNextActivity(
-            std::make_unique<Activities::ExitVehicle>());
+        controller->setNextActivity<Activities::ExitVehicle>();
 
         for (float t = 0.f; t < 9.0f; t += (1.f / 60.f)) {
             character->tick(1.f / 60.f);
@@ -98,8 +166,7 @@ BOOST_AUTO_TEST_CASE(test_activities) {
         BOOST_CHECK_EQUAL(nullptr, character->getCurrentVehicle());
 
         character->setPosition(glm::vec3(5.f, 0.f, 0.f));
-        controller->setNextActivity(
-            std::make_unique<Activities::EnterVehicle>(vehicle, 0));
+        controller->setNextActivity<Activities::EnterVehicle>(vehicle, 0);
 
         for (float t = 0.f; t < 0.5f; t += (1.f / 60.f)) {
             character->tick(1.f / 60.f);
@@ -319,6 +319,29 @@ BOOST_AUTO_TEST_CASE(test_config_valid_modified) {
     BOOST_CHECK_EQUAL(config.getGameDataPath().string(), "Liberty City");
 }
 
+BOOST_AUTO_TEST_CASE(test_config_texture_budget) {
+    // Test the default and a configured texture budget
+    auto cfg = getValidConfig();
+
+    TempFile tempFile;
+    tempFile.append(cfg);
+
+    GameConfig config;
+    config.loadFile(tempFile.path());
+    BOOST_CHECK(config.isValid());
+    BOOST_CHECK_EQUAL(config.getTextureBudget(), 256);
+
+    cfg["memory"]["texture_budget"] = "64";
+
+    TempFile tempFile2;
+    tempFile2.append(cfg);
+
+    GameConfig config2;
+    config2.loadFile(tempFile2.path());
+    BOOST_CHECK(config2.isValid());
+    BOOST_CHECK_EQUAL(config2.getTextureBudget(), 64);
+}
+
 BOOST_AUTO_TEST_CASE(test_config_save) {
     // Test saving a configuration file
     auto cfg = getValidConfig();
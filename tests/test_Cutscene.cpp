@@ -1,9 +1,15 @@
 #include <boost/test/unit_test.hpp>
 #include <data/CutsceneData.hpp>
+#include <engine/FilePrefetcher.hpp>
 #include <loaders/LoaderCutsceneDAT.hpp>
 #include <platform/FileHandle.hpp>
+#include <platform/FileIndex.hpp>
 #include "test_Globals.hpp"
 
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
 BOOST_AUTO_TEST_SUITE(CutsceneTests)
 
 #if RW_TEST_WITH_DATA
@@ -17,18 +23,111 @@ BOOST_AUTO_TEST_CASE(test_load) {
 
         loader.load(tracks, d);
 
-        BOOST_CHECK(tracks.position.find(0.f) != tracks.position.end());
-        BOOST_CHECK(tracks.position.find(64.8f) != tracks.position.end());
+        BOOST_CHECK(tracks.position.hasKeyframe(0.f));
+        BOOST_CHECK(tracks.position.hasKeyframe(64.8f));
 
-        BOOST_CHECK(tracks.zoom.find(64.8f) != tracks.zoom.end());
+        BOOST_CHECK(tracks.zoom.hasKeyframe(64.8f));
 
-        BOOST_CHECK(tracks.zoom.find(64.8f) != tracks.zoom.end());
+        BOOST_CHECK(tracks.zoom.hasKeyframe(64.8f));
 
-        BOOST_CHECK(tracks.target.find(64.8f) != tracks.target.end());
+        BOOST_CHECK(tracks.target.hasKeyframe(64.8f));
 
         BOOST_CHECK(tracks.duration == 64.8f);
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_prefetch_load_time) {
+    auto world = Global::get().e;
+    auto& prefetcher = world->data->prefetcher;
+
+    using Clock = std::chrono::steady_clock;
+    // From the script's load call to sampling the first frame
+    auto loadToFirstFrame = [&] {
+        auto start = Clock::now();
+        world->loadCutscene("intro");
+        world->startCutscene();
+        world->state->currentCutscene->tracks.getPositionAt(0.f);
+        auto time = std::chrono::duration<double, std::milli>(
+                        Clock::now() - start)
+                        .count();
+        world->clearCutscene();
+        return time;
+    };
+
+    auto loaded = loadToFirstFrame();
+
+    auto hits = prefetcher.getHitCount();
+    world->prefetchCutscene("intro");
+    prefetcher.wait();
+    BOOST_CHECK(prefetcher.isPrefetched("intro.dat"));
+    auto prefetched = loadToFirstFrame();
+
+    BOOST_TEST_MESSAGE("Cutscene load to first frame: " << loaded
+                       << "ms, prefetched: " << prefetched << "ms");
+    BOOST_CHECK_EQUAL(prefetcher.getHitCount(), hits + 2);
+}
 #endif
 
+BOOST_AUTO_TEST_CASE(test_track_sampling) {
+    CutsceneTrack<float> track;
+    track.addKeyframe(2.f, 20.f);
+    track.addKeyframe(0.f, 0.f);
+    track.addKeyframe(1.f, 10.f);
+    track.addKeyframe(1.f, 5.f);
+    BOOST_REQUIRE_EQUAL(track.size(), 3u);
+    BOOST_CHECK(track.hasKeyframe(1.f));
+    BOOST_CHECK(!track.hasKeyframe(1.5f));
+
+    BOOST_CHECK_EQUAL(track.sample(0.f), 0.f);
+    BOOST_CHECK_CLOSE(track.sample(0.5f), 2.5f, 0.001f);
+    BOOST_CHECK_CLOSE(track.sample(1.5f), 12.5f, 0.001f);
+    BOOST_CHECK_EQUAL(track.sample(3.f), 20.f);
+
+    // Seeking back restarts the cursor
+    BOOST_CHECK_CLOSE(track.sample(0.5f), 2.5f, 0.001f);
+    BOOST_CHECK_EQUAL(track.sample(2.f), 20.f);
+
+    // Before the first keyframe holds the last value
+    BOOST_CHECK_EQUAL(track.sample(-1.f), 20.f);
+
+    CutsceneTrack<float> empty;
+    BOOST_CHECK_EQUAL(empty.sample(1.f), 0.f);
+}
+
+BOOST_AUTO_TEST_CASE(test_file_prefetch) {
+    auto dir = rwfs::temp_directory_path() / "openrw_test_prefetch";
+    rwfs::create_directories(dir);
+    {
+        std::ofstream file((dir / "Test.DAT").string(), std::ios::binary);
+        file << "prefetched";
+    }
+
+    FileIndex index;
+    index.indexTree(dir);
+
+    {
+        FilePrefetcher prefetcher(index);
+        prefetcher.prefetch("test.dat");
+        prefetcher.prefetch("missing.dat");
+        prefetcher.wait();
+        BOOST_CHECK(prefetcher.isPrefetched("TEST.DAT"));
+
+        auto file = prefetcher.take("test.dat");
+        BOOST_REQUIRE(file.data != nullptr);
+        BOOST_REQUIRE_EQUAL(file.length, 10u);
+        BOOST_CHECK(std::memcmp(file.data.get(), "prefetched", 10) == 0);
+        BOOST_CHECK_EQUAL(prefetcher.getHitCount(), 1u);
+
+        // Each prefetch is only handed out once
+        BOOST_CHECK(prefetcher.take("test.dat").data == nullptr);
+        BOOST_CHECK(prefetcher.take("missing.dat").data == nullptr);
+        BOOST_CHECK_EQUAL(prefetcher.getHitCount(), 1u);
+
+        // Left for the destructor to clean up
+        prefetcher.prefetch("test.dat");
+    }
+
+    rwfs::remove_all(dir);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
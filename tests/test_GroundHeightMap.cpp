@@ -0,0 +1,86 @@
+#include <boost/test/unit_test.hpp>
+#include <data/CollisionModel.hpp>
+#include <engine/GroundHeightMap.hpp>
+
+namespace {
+void addQuad(GroundHeightMap& map, const glm::vec2& min, const glm::vec2& max,
+             float z0, float z1) {
+    glm::vec3 a(min.x, min.y, z0), b(max.x, min.y, z1), c(max.x, max.y, z1),
+        d(min.x, max.y, z0);
+    map.addTriangle(a, b, c);
+    map.addTriangle(a, c, d);
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(GroundHeightMapTests)
+
+BOOST_AUTO_TEST_CASE(test_flat_ground) {
+    GroundHeightMap map;
+    float height = 0.f;
+    BOOST_CHECK(!map.getGroundHeight({0.f, 0.f, 100.f}, height));
+
+    addQuad(map, {-100.f, -100.f}, {100.f, 100.f}, 5.f, 5.f);
+    BOOST_CHECK_EQUAL(map.getTileCount(), 16);
+
+    BOOST_REQUIRE(map.getGroundHeight({0.f, 0.f, 100.f}, height));
+    BOOST_CHECK_CLOSE(height, 5.f, 1.f);
+    BOOST_REQUIRE(map.getGroundHeight({-33.3f, 71.1f, 100.f}, height));
+    BOOST_CHECK_CLOSE(height, 5.f, 1.f);
+
+    // Below the ground
+    BOOST_CHECK(!map.getGroundHeight({0.f, 0.f, 0.f}, height));
+    // Outside of it
+    BOOST_CHECK(!map.getGroundHeight({150.f, 0.f, 100.f}, height));
+}
+
+BOOST_AUTO_TEST_CASE(test_slope) {
+    GroundHeightMap map;
+    addQuad(map, {0.f, 0.f}, {20.f, 20.f}, 0.f, 10.f);
+
+    float height = 0.f;
+    BOOST_REQUIRE(map.getGroundHeight({5.f, 10.f, 100.f}, height));
+    BOOST_CHECK_CLOSE(height, 2.5f, 5.f);
+    BOOST_REQUIRE(map.getGroundHeight({11.f, 10.f, 100.f}, height));
+    BOOST_CHECK_CLOSE(height, 5.5f, 5.f);
+}
+
+BOOST_AUTO_TEST_CASE(test_levels) {
+    GroundHeightMap map;
+    addQuad(map, {-50.f, -50.f}, {50.f, 50.f}, 0.f, 0.f);
+    // A bridge over the ground
+    addQuad(map, {-50.f, -10.f}, {50.f, 10.f}, 12.f, 12.f);
+    // A wall is not ground
+    map.addTriangle({-5.f, 0.f, 0.f}, {5.f, 0.f, 0.f}, {5.f, 0.f, 50.f});
+    // Neither is the underside of the bridge
+    map.addTriangle({-50.f, -10.f, 11.f}, {50.f, 10.f, 11.f},
+                    {50.f, -10.f, 11.f});
+
+    float height = 0.f;
+    BOOST_REQUIRE(map.getGroundHeight({0.f, 0.f, 100.f}, height));
+    BOOST_CHECK_CLOSE(height, 12.f, 1.f);
+    BOOST_REQUIRE(map.getGroundHeight({0.f, 0.f, 2.f}, height));
+    BOOST_CHECK_SMALL(height, 0.2f);
+    BOOST_REQUIRE(map.getGroundHeight({0.f, 0.f, 10.5f}, height));
+    BOOST_CHECK_SMALL(height, 0.2f);
+    BOOST_REQUIRE(map.getGroundHeight({0.f, 30.f, 100.f}, height));
+    BOOST_CHECK_SMALL(height, 0.2f);
+}
+
+BOOST_AUTO_TEST_CASE(test_collision_model) {
+    CollisionModel col;
+    CollisionModel::Box box;
+    box.min = {-10.f, -10.f, -1.f};
+    box.max = {10.f, 10.f, 1.f};
+    col.boxes.push_back(box);
+
+    GroundHeightMap map;
+    map.addCollision(col, {100.f, 100.f, 20.f},
+                     glm::angleAxis(0.5f, glm::vec3(0.f, 0.f, 1.f)));
+
+    float height = 0.f;
+    BOOST_REQUIRE(map.getGroundHeight({100.f, 100.f, 100.f}, height));
+    BOOST_CHECK_CLOSE(height, 21.f, 1.f);
+    BOOST_CHECK(!map.getGroundHeight({80.f, 80.f, 100.f}, height));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,5 +1,7 @@
 #include <GameInput.hpp>
 #include <boost/test/unit_test.hpp>
+#include <engine/InputLog.hpp>
+#include <rw/filesystem.hpp>
 
 BOOST_AUTO_TEST_SUITE(InputTests)
 
@@ -33,4 +35,38 @@ BOOST_AUTO_TEST_CASE(TestStateUpdate) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_input_log_replay) {
+    InputLog log;
+    for (int t = 0; t < 10; ++t) {
+        GameInputState state;
+        state.levels[GameInputState::GoForward] = t / 10.f;
+        state.levels[GameInputState::Jump] = (t % 2) ? 1.f : 0.f;
+        log.record(state);
+    }
+    BOOST_REQUIRE_EQUAL(log.getTickCount(), 10);
+
+    auto path = rwfs::temp_directory_path() /
+                rwfs::unique_path("openrw_test_%%%%%%%%%%%%%%%%");
+    BOOST_REQUIRE(log.save(path.string()));
+
+    InputLog replay;
+    BOOST_REQUIRE(replay.load(path.string()));
+    rwfs::remove(path);
+
+    BOOST_REQUIRE_EQUAL(replay.getTickCount(), log.getTickCount());
+    for (size_t t = 0; t < replay.getTickCount(); ++t) {
+        for (int c = 0; c < GameInputState::_MaxControls; ++c) {
+            BOOST_CHECK_EQUAL(replay.getInput(t).levels[c],
+                              log.getInput(t).levels[c]);
+        }
+    }
+
+    // Past the end of the log nothing is pressed
+    BOOST_CHECK(!replay.getInput(10).pressed(GameInputState::Jump));
+    BOOST_CHECK_EQUAL(replay.getInput(10)[GameInputState::GoForward], 0.f);
+
+    InputLog missing;
+    BOOST_CHECK(!missing.load((path / "missing").string()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,69 @@
+#include <boost/test/unit_test.hpp>
+#include <engine/InstanceGrid.hpp>
+#include <objects/InstanceObject.hpp>
+#include "test_Globals.hpp"
+
+BOOST_AUTO_TEST_SUITE(InstanceGridTests)
+
+BOOST_AUTO_TEST_CASE(test_box_query) {
+    const auto size = InstanceGrid::kCellSize;
+    InstanceObject a(nullptr, {10.f, 10.f, 0.f}, {}, glm::vec3(1.f),
+                     nullptr, nullptr);
+    InstanceObject b(nullptr, {size + 5.f, 10.f, 0.f}, {}, glm::vec3(1.f),
+                     nullptr, nullptr);
+    InstanceObject c(nullptr, {-5.f, -5.f, 0.f}, {}, glm::vec3(1.f), nullptr,
+                     nullptr);
+    InstanceObject far(nullptr, {500.f, 500.f, 0.f}, {}, glm::vec3(1.f),
+                       nullptr, nullptr);
+    a.setGameObjectID(3);
+    b.setGameObjectID(1);
+    c.setGameObjectID(2);
+    far.setGameObjectID(4);
+
+    InstanceGrid grid;
+    grid.insert(&a);
+    grid.insert(&b);
+    grid.insert(&c);
+    grid.insert(&far);
+    BOOST_CHECK_EQUAL(grid.getInstanceCount(), 4);
+
+    // Spans four cells, results come back in ID order
+    auto found = grid.query({-10.f, -10.f}, {size + 10.f, 20.f});
+    BOOST_REQUIRE_EQUAL(found.size(), 3);
+    BOOST_CHECK_EQUAL(found[0], &b);
+    BOOST_CHECK_EQUAL(found[1], &c);
+    BOOST_CHECK_EQUAL(found[2], &a);
+
+    // Cells overlapping the box may hold instances outside of it
+    found = grid.query({0.f, 0.f}, {10.f, 10.f});
+    BOOST_REQUIRE_EQUAL(found.size(), 1);
+    BOOST_CHECK_EQUAL(found[0], &a);
+
+    BOOST_CHECK(grid.query({100.f, 100.f}, {200.f, 200.f}).empty());
+
+    grid.remove(&c);
+    BOOST_CHECK_EQUAL(grid.getInstanceCount(), 3);
+    BOOST_CHECK_EQUAL(grid.query({-10.f, -10.f}, {0.f, 0.f}).size(), 0);
+
+    // Removing an instance that isn't in the grid does nothing
+    grid.remove(&c);
+    BOOST_CHECK_EQUAL(grid.getInstanceCount(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_moved_instance) {
+    InstanceObject a(nullptr, {10.f, 10.f, 0.f}, {}, glm::vec3(1.f),
+                     nullptr, nullptr);
+
+    InstanceGrid grid;
+    grid.insert(&a);
+
+    // Found around where it was inserted, if it's still inside the box
+    a.setPosition({12.f, 12.f, 0.f});
+    BOOST_CHECK_EQUAL(grid.query({11.f, 11.f}, {13.f, 13.f}).size(), 1);
+
+    a.setPosition({1000.f, 1000.f, 0.f});
+    grid.remove(&a);
+    BOOST_CHECK_EQUAL(grid.getInstanceCount(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
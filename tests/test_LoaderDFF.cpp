@@ -1,8 +1,15 @@
 #include <boost/test/unit_test.hpp>
 #include <data/Clump.hpp>
+#include <loaders/LoaderDFF.hpp>
+#include <loaders/LoaderIMG.hpp>
+#include <loaders/RWBinaryStream.hpp>
 #include <platform/FileHandle.hpp>
 #include "test_Globals.hpp"
 
+#include <chrono>
+#include <cstring>
+#include <vector>
+
 BOOST_AUTO_TEST_SUITE(LoaderDFFTests)
 
 #if RW_TEST_WITH_DATA
@@ -26,8 +33,105 @@ BOOST_AUTO_TEST_CASE(test_load_dff) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_load_all_dff) {
+    LoaderIMG archive;
+    BOOST_REQUIRE(archive.load(Global::getGamePath() + "/models/gta3"));
+
+    // Read everything up front so only decoding is timed
+    std::vector<FileContentsInfo> files;
+    for (auto i = 0u; i < archive.getAssetCount(); ++i) {
+        const auto& asset = archive.getAssetInfoByIndex(i);
+        std::string name = asset.name;
+        if (name.size() < 4 ||
+            name.compare(name.size() - 4, 4, ".dff") != 0) {
+            continue;
+        }
+        auto data = archive.loadToMemory(name);
+        BOOST_REQUIRE(data);
+        files.emplace_back(std::move(data), asset.size * 2048);
+    }
+    BOOST_REQUIRE(!files.empty());
+
+    LoaderDFF loader;
+    size_t geometries = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& file : files) {
+        auto clump = loader.loadFromMemory(file);
+        BOOST_REQUIRE(clump);
+        geometries += clump->getAtomics().size();
+    }
+    auto elapsed = std::chrono::duration<double, std::milli>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+
+    BOOST_TEST_MESSAGE("Loaded " << files.size() << " DFFs (" << geometries
+                                 << " atomics) in " << elapsed << "ms");
+}
+
 #endif
 
+BOOST_AUTO_TEST_CASE(test_decode_vertices) {
+    // A quad and a separate triangle, with enough triangles to cover both
+    // the four-wide and the scalar normal paths
+    const std::vector<glm::vec3> positions{
+        {0.f, 0.f, 0.f}, {1.f, 0.f, 0.f}, {1.f, 1.f, 0.f}, {0.f, 1.f, 0.f},
+        {0.f, 0.f, 1.f}, {0.f, 2.f, 3.f}, {4.f, 0.f, 1.f}};
+    const std::vector<RW::BSGeometryTriangle> triangles{
+        {0, 1, 0, 2}, {0, 2, 0, 3}, {4, 5, 0, 6},
+        {6, 4, 0, 5}, {1, 3, 0, 2}};
+    const std::vector<glm::vec2> texcoords{
+        {0.f, 0.f}, {1.f, 0.f}, {1.f, 1.f}, {0.f, 1.f},
+        {.5f, 0.f}, {0.f, .5f}, {.5f, .5f}};
+
+    // Unaligned copies, as found in the middle of a stream
+    std::vector<char> data(1 + sizeof(glm::vec3) * positions.size() +
+                           sizeof(RW::BSGeometryTriangle) * triangles.size() +
+                           sizeof(glm::vec2) * texcoords.size());
+    char* cursor = data.data() + 1;
+    DFFVertexStreams streams;
+    streams.numVerts = positions.size();
+    streams.numTris = triangles.size();
+    streams.positions = cursor;
+    std::memcpy(cursor, positions.data(),
+                sizeof(glm::vec3) * positions.size());
+    cursor += sizeof(glm::vec3) * positions.size();
+    streams.triangles = cursor;
+    std::memcpy(cursor, triangles.data(),
+                sizeof(RW::BSGeometryTriangle) * triangles.size());
+    cursor += sizeof(RW::BSGeometryTriangle) * triangles.size();
+    streams.texcoords = cursor;
+    std::memcpy(cursor, texcoords.data(),
+                sizeof(glm::vec2) * texcoords.size());
+
+    std::vector<GeometryVertex> vertices(positions.size());
+    LoaderDFF::decodeVertices(streams, vertices.data());
+
+    // Reference: the face normal of the last triangle using each vertex
+    std::vector<glm::vec3> expected(positions.size());
+    for (const auto& t : triangles) {
+        auto normal = glm::normalize(
+            glm::cross(positions[t.third] - positions[t.first],
+                       positions[t.second] - positions[t.first]));
+        expected[t.first] = expected[t.second] = expected[t.third] = normal;
+    }
+
+    for (size_t v = 0; v < vertices.size(); ++v) {
+        BOOST_CHECK_EQUAL(vertices[v].position, positions[v]);
+        BOOST_CHECK_SMALL(glm::distance(vertices[v].normal, expected[v]),
+                          1e-6f);
+        BOOST_CHECK(vertices[v].texcoord == texcoords[v]);
+        BOOST_CHECK(vertices[v].colour == glm::u8vec4(255));
+    }
+
+    // Normals from the file are used as-is
+    const std::vector<glm::vec3> normals(positions.size(), {0.f, 0.f, 1.f});
+    streams.normals = reinterpret_cast<const char*>(normals.data());
+    LoaderDFF::decodeVertices(streams, vertices.data());
+    for (const auto& vertex : vertices) {
+        BOOST_CHECK_EQUAL(vertex.normal, glm::vec3(0.f, 0.f, 1.f));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_clump_clone) {
     {
         auto frame1 = std::make_shared<ModelFrame>(0);
@@ -0,0 +1,72 @@
+#include <boost/test/unit_test.hpp>
+#include <loaders/LoaderSDT.hpp>
+#include "test_Globals.hpp"
+
+#include <cstring>
+#include <fstream>
+
+namespace {
+struct TestArchive {
+    rwfs::path sdt = rwfs::temp_directory_path() / "openrw_test_sfx.SDT";
+    rwfs::path raw = rwfs::temp_directory_path() / "openrw_test_sfx.RAW";
+
+    TestArchive() {
+        std::ofstream rawFile(raw.string(), std::ios::binary);
+        for (auto i = 0; i < 48; ++i) {
+            rawFile.put(static_cast<char>(i));
+        }
+
+        // Two 16 byte files, and one running past the end of the archive
+        const LoaderSDTFile files[] = {
+            {0, 16, 22050, 0, 0xFFFFFFFF},
+            {16, 16, 11025, 0, 0xFFFFFFFF},
+            {40, 16, 11025, 0, 0xFFFFFFFF},
+        };
+        std::ofstream sdtFile(sdt.string(), std::ios::binary);
+        sdtFile.write(reinterpret_cast<const char*>(files), sizeof(files));
+    }
+
+    ~TestArchive() {
+        rwfs::remove(sdt);
+        rwfs::remove(raw);
+    }
+};
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(LoaderSDTTests)
+
+BOOST_AUTO_TEST_CASE(test_mapped_assets) {
+    TestArchive archive;
+    LoaderSDT loader;
+    BOOST_REQUIRE(loader.load(archive.sdt, archive.raw));
+    BOOST_REQUIRE_EQUAL(loader.getAssetCount(), 3u);
+
+    auto data = loader.getAssetData(1);
+    BOOST_REQUIRE(data != nullptr);
+    for (auto i = 0; i < 16; ++i) {
+        BOOST_CHECK_EQUAL(data[i], static_cast<char>(16 + i));
+    }
+
+    BOOST_CHECK(loader.getAssetData(2) == nullptr);
+    BOOST_CHECK(loader.getAssetData(3) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(test_load_to_memory) {
+    TestArchive archive;
+    LoaderSDT loader;
+    BOOST_REQUIRE(loader.load(archive.sdt, archive.raw));
+
+    auto raw = loader.loadToMemory(1, false);
+    BOOST_REQUIRE(raw != nullptr);
+    BOOST_CHECK(std::memcmp(raw.get(), loader.getAssetData(1), 16) == 0);
+
+    auto wave = loader.loadToMemory(0, true);
+    BOOST_REQUIRE(wave != nullptr);
+    auto header = reinterpret_cast<const WaveHeader*>(wave.get());
+    BOOST_CHECK_EQUAL(header->fmt.sampleRate, 22050u);
+    BOOST_CHECK_EQUAL(header->data.size, 16u);
+    BOOST_CHECK(std::memcmp(wave.get() + sizeof(WaveHeader),
+                            loader.getAssetData(0), 16) == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,6 +1,9 @@
 #include <boost/test/unit_test.hpp>
 #include <core/Logger.hpp>
 
+#include <thread>
+#include <vector>
+
 class CallbackReceiver : public Logger::MessageReceiver {
 public:
     std::function<void(const Logger::LogMessage&)> func;
@@ -33,4 +36,61 @@ BOOST_AUTO_TEST_CASE(test_receiver) {
     BOOST_CHECK_EQUAL(lastMessage.message, "Test");
 }
 
+BOOST_AUTO_TEST_CASE(test_severity_filter) {
+    Logger log;
+
+    int received = 0;
+    CallbackReceiver receiver([&](const Logger::LogMessage&) { received++; });
+    log.addReceiver(&receiver);
+
+    log.setMinimumSeverity(Logger::Warning);
+    log.setMinimumSeverity("Verbose", Logger::Verbose);
+
+    bool formatted = false;
+    log.info("Tests", [&] {
+        formatted = true;
+        return std::string("Test");
+    });
+    BOOST_CHECK(!formatted);
+    BOOST_CHECK_EQUAL(received, 0);
+
+    log.warning("Tests", "Test");
+    log.verbose("Verbose", "Test");
+    BOOST_CHECK_EQUAL(received, 2);
+    BOOST_CHECK(!log.isEnabled("Tests", Logger::Info));
+    BOOST_CHECK(log.isEnabled("Verbose", Logger::Verbose));
+}
+
+BOOST_AUTO_TEST_CASE(test_writer_thread) {
+    constexpr int kThreads = 4;
+    constexpr int kMessages = 1000;
+
+    Logger log;
+    std::vector<int> received(kThreads);
+    CallbackReceiver receiver([&](const Logger::LogMessage& m) {
+        received[m.component[0] - 'a']++;
+    });
+    log.addReceiver(&receiver);
+    log.startWriterThread();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&log, t] {
+            std::string component(1, static_cast<char>('a' + t));
+            for (int i = 0; i < kMessages; ++i) {
+                log.info(component, "Test");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    log.flush();
+    for (int t = 0; t < kThreads; ++t) {
+        BOOST_CHECK_EQUAL(received[t], kMessages);
+    }
+    log.stopWriterThread();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,77 @@
+#include <boost/test/unit_test.hpp>
+#include <rw/memorystats.hpp>
+#include "test_Globals.hpp"
+
+#include <sstream>
+#include <utility>
+
+BOOST_AUTO_TEST_SUITE(MemoryStatsTests)
+
+BOOST_AUTO_TEST_CASE(test_tracked_lifetime) {
+    auto& stats = MemoryStats::get();
+    auto before = stats.getUsage(MemoryTag::Collision);
+    {
+        TrackedMemory<MemoryTag::Collision> a;
+        a.set(1000);
+        auto usage = stats.getUsage(MemoryTag::Collision);
+        BOOST_CHECK_EQUAL(usage.bytes, before.bytes + 1000);
+        BOOST_CHECK_EQUAL(usage.allocations, before.allocations + 1);
+        BOOST_CHECK_GE(usage.peakBytes, usage.bytes);
+
+        // Resizing replaces the old value
+        a.set(400);
+        usage = stats.getUsage(MemoryTag::Collision);
+        BOOST_CHECK_EQUAL(usage.bytes, before.bytes + 400);
+        BOOST_CHECK_EQUAL(usage.allocations, before.allocations + 1);
+
+        // Copies count again, moves don't
+        auto b = a;
+        auto c = std::move(a);
+        BOOST_CHECK_EQUAL(a.get(), 0u);
+        BOOST_CHECK_EQUAL(c.get(), 400u);
+        usage = stats.getUsage(MemoryTag::Collision);
+        BOOST_CHECK_EQUAL(usage.bytes, before.bytes + 800);
+        BOOST_CHECK_EQUAL(usage.allocations, before.allocations + 2);
+    }
+    auto after = stats.getUsage(MemoryTag::Collision);
+    BOOST_CHECK_EQUAL(after.bytes, before.bytes);
+    BOOST_CHECK_EQUAL(after.allocations, before.allocations);
+}
+
+BOOST_AUTO_TEST_CASE(test_tags_are_separate) {
+    auto& stats = MemoryStats::get();
+    auto sound = stats.getUsage(MemoryTag::Sound).bytes;
+    auto total = stats.getTotalBytes();
+
+    TrackedMemory<MemoryTag::Script> script;
+    script.set(256);
+    BOOST_CHECK_EQUAL(stats.getUsage(MemoryTag::Sound).bytes, sound);
+    BOOST_CHECK_EQUAL(stats.getTotalBytes(), total + 256);
+}
+
+BOOST_AUTO_TEST_CASE(test_scope) {
+    BOOST_CHECK(MemoryScope::current() == MemoryTag::Other);
+    {
+        MemoryScope textures(MemoryTag::Textures);
+        BOOST_CHECK(MemoryScope::current() == MemoryTag::Textures);
+        {
+            MemoryScope clumps(MemoryTag::Clumps);
+            BOOST_CHECK(MemoryScope::current() == MemoryTag::Clumps);
+        }
+        BOOST_CHECK(MemoryScope::current() == MemoryTag::Textures);
+    }
+    BOOST_CHECK(MemoryScope::current() == MemoryTag::Other);
+}
+
+BOOST_AUTO_TEST_CASE(test_dump) {
+    std::stringstream ss;
+    MemoryStats::get().dump(ss);
+    auto text = ss.str();
+    for (size_t i = 0; i < MemoryStats::kTagCount; ++i) {
+        auto name = MemoryStats::getTagName(static_cast<MemoryTag>(i));
+        BOOST_CHECK(text.find(name) != std::string::npos);
+    }
+    BOOST_CHECK(text.find("Total") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,83 @@
+#include <boost/test/unit_test.hpp>
+#include <engine/GameData.hpp>
+#include <engine/GameWorld.hpp>
+#include <engine/ModelResidency.hpp>
+#include <objects/InstanceObject.hpp>
+#include "test_Globals.hpp"
+
+BOOST_AUTO_TEST_SUITE(ModelResidencyTests)
+
+BOOST_AUTO_TEST_CASE(test_evict_unreferenced) {
+    ModelInfoTable models;
+    for (ModelID id = 1; id <= 4; ++id) {
+        models[id] = std::make_unique<SimpleModelInfo>();
+    }
+
+    ModelResidency residency;
+    for (ModelID id = 1; id <= 4; ++id) {
+        residency.addModel(id, 100);
+    }
+    BOOST_CHECK_EQUAL(residency.getResidentCount(), 4);
+    BOOST_CHECK_EQUAL(residency.getBytes(), 400);
+    BOOST_CHECK_EQUAL(residency.getUnreferencedCount(models), 4);
+
+    // No budget, nothing is evicted
+    BOOST_CHECK(residency.evict(models, 0).empty());
+
+    models[1]->addReference();
+    residency.pin(2);
+    residency.use(3);
+    BOOST_CHECK_EQUAL(residency.getUnreferencedCount(models), 3);
+
+    residency.setBudget(200);
+    auto evicted = residency.evict(models, 0);
+    BOOST_REQUIRE_EQUAL(evicted.size(), 2);
+    BOOST_CHECK_EQUAL(evicted[0], 4);
+    BOOST_CHECK_EQUAL(evicted[1], 3);
+    BOOST_CHECK_EQUAL(residency.getResidentCount(), 2);
+    BOOST_CHECK(residency.isResident(1));
+    BOOST_CHECK(residency.isResident(2));
+}
+
+BOOST_AUTO_TEST_CASE(test_evict_keeps_requested) {
+    ModelInfoTable models;
+    models[1] = std::make_unique<SimpleModelInfo>();
+
+    ModelResidency residency;
+    residency.setBudget(50);
+    residency.addModel(1, 100);
+
+    BOOST_CHECK(residency.evict(models, 1).empty());
+    BOOST_CHECK_EQUAL(residency.evict(models, 0).size(), 1);
+    BOOST_CHECK_EQUAL(residency.getBytes(), 0);
+}
+
+#if RW_TEST_WITH_DATA
+BOOST_AUTO_TEST_CASE(test_instance_references) {
+    auto& d = Global::get().d;
+    auto& e = Global::get().e;
+
+    auto info = d->findModelInfo<SimpleModelInfo>(2202);
+    BOOST_REQUIRE(info);
+    auto inst = e->createInstance(2202, {});
+
+    BOOST_CHECK(d->modelResidency.isResident(2202));
+    BOOST_CHECK_EQUAL(info->getReferenceCount(), 1);
+
+    e->destroyObject(inst);
+    BOOST_CHECK_EQUAL(info->getReferenceCount(), 0);
+
+    // Loading another model over the budget unloads the unused one
+    auto budget = d->modelResidency.getBudget();
+    d->modelResidency.setBudget(1);
+    auto other = e->createInstance(1337, {});
+    BOOST_CHECK(!d->modelResidency.isResident(2202));
+    BOOST_CHECK(!info->isLoaded());
+    BOOST_CHECK(d->modelResidency.isResident(1337));
+
+    d->modelResidency.setBudget(budget);
+    e->destroyObject(other);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+#include <boost/test/unit_test.hpp>
+#include <btBulletDynamicsCommon.h>
+#include <dynamics/PhysicsQueries.hpp>
+#include <objects/InstanceObject.hpp>
+#include "test_Globals.hpp"
+
+namespace {
+struct QueryWorld {
+    btDefaultCollisionConfiguration config;
+    btCollisionDispatcher dispatcher{&config};
+    btDbvtBroadphase broadphase;
+    btSequentialImpulseConstraintSolver solver;
+    btDiscreteDynamicsWorld world{&dispatcher, &broadphase, &solver, &config};
+
+    btBoxShape shape{btVector3(1.f, 1.f, 1.f)};
+    btDefaultMotionState motion{
+        btTransform(btQuaternion::getIdentity(), btVector3(0.f, 0.f, 0.f))};
+    btRigidBody box{0.f, &motion, &shape};
+
+    InstanceObject object{nullptr, {}, {1.f, 0.f, 0.f, 0.f}, glm::vec3(1.f),
+                          nullptr, nullptr};
+
+    QueryWorld() {
+        box.setUserPointer(&object);
+        world.addRigidBody(&box);
+    }
+
+    ~QueryWorld() {
+        world.removeRigidBody(&box);
+    }
+};
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(PhysicsQueriesTests)
+
+BOOST_AUTO_TEST_CASE(test_cast_ray) {
+    QueryWorld w;
+    PhysicsQueries queries(&w.world);
+
+    auto hit = queries.castRay({0.f, 0.f, 10.f}, {0.f, 0.f, -10.f});
+    BOOST_CHECK(hit.hit);
+    BOOST_CHECK_CLOSE(hit.position.z, 1.f, 0.1f);
+    BOOST_CHECK_CLOSE(hit.normal.z, 1.f, 0.1f);
+    BOOST_CHECK_EQUAL(hit.object, &w.object);
+
+    auto miss = queries.castRay({5.f, 0.f, 10.f}, {5.f, 0.f, -10.f});
+    BOOST_CHECK(!miss.hit);
+    BOOST_CHECK(miss.object == nullptr);
+
+    auto ignored = queries.castRay({0.f, 0.f, 10.f}, {0.f, 0.f, -10.f},
+                                   PhysicsQueries::DefaultFilter, &w.box);
+    BOOST_CHECK(!ignored.hit);
+}
+
+BOOST_AUTO_TEST_CASE(test_overlap_sphere) {
+    QueryWorld w;
+    PhysicsQueries queries(&w.world);
+
+    auto near = queries.overlapSphere({2.5f, 0.f, 0.f}, 2.f);
+    BOOST_REQUIRE_EQUAL(near.objects.size(), 1);
+    BOOST_CHECK_EQUAL(near.objects[0], &w.object);
+
+    // Inside the bounding box of the sphere, but not the sphere itself
+    auto corner = queries.overlapSphere({3.f, 3.f, 3.f}, 2.5f);
+    BOOST_CHECK(corner.objects.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_batch_handles) {
+    QueryWorld w;
+    PhysicsQueries queries(&w.world);
+
+    auto ray = queries.queueRay({0.f, 0.f, 10.f}, {0.f, 0.f, -10.f});
+    auto sphere = queries.queueSphere({0.f, 0.f, 0.f}, 1.f);
+    BOOST_CHECK_EQUAL(queries.getQueuedCount(), 2);
+
+    // Nothing is available before the batch runs
+    BOOST_CHECK(queries.getRayResult(ray) == nullptr);
+    BOOST_CHECK(queries.getSphereResult(sphere) == nullptr);
+
+    queries.execute();
+    BOOST_CHECK_EQUAL(queries.getQueuedCount(), 0);
+    BOOST_REQUIRE(queries.getRayResult(ray) != nullptr);
+    BOOST_CHECK(queries.getRayResult(ray)->hit);
+    BOOST_REQUIRE(queries.getSphereResult(sphere) != nullptr);
+    BOOST_CHECK_EQUAL(queries.getSphereResult(sphere)->objects.size(), 1);
+
+    // Results only last until the next batch
+    queries.execute();
+    BOOST_CHECK(queries.getRayResult(ray) == nullptr);
+    BOOST_CHECK(queries.getSphereResult(sphere) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
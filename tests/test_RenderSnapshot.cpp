@@ -0,0 +1,131 @@
+#include <boost/test/unit_test.hpp>
+#include <engine/GameWorld.hpp>
+#include <objects/InstanceObject.hpp>
+#include <objects/VehicleObject.hpp>
+#include <render/RenderSnapshot.hpp>
+#include "test_Globals.hpp"
+
+#include <cmath>
+
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace {
+bool isIdentity(const glm::mat4& m) {
+    for (auto c = 0; c < 4; ++c) {
+        for (auto r = 0; r < 4; ++r) {
+            if (m[c][r] != (c == r ? 1.f : 0.f)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(RenderSnapshotTests)
+
+BOOST_AUTO_TEST_CASE(test_interpolation) {
+    InstanceObject moving(nullptr, {0.f, 0.f, 0.f}, {}, glm::vec3(1.f),
+                          nullptr, nullptr);
+    InstanceObject still(nullptr, {5.f, 5.f, 0.f}, {}, glm::vec3(1.f),
+                         nullptr, nullptr);
+    moving.setGameObjectID(1);
+    still.setGameObjectID(2);
+
+    // One tick: moves 10 units along x, turning a quarter around z
+    moving._updateLastTransform();
+    still._updateLastTransform();
+    moving.position = {10.f, 0.f, 0.f};
+    moving.rotation =
+        glm::angleAxis(glm::half_pi<float>(), glm::vec3(0.f, 0.f, 1.f));
+
+    RenderSnapshot snapshot;
+    snapshot.capture({&moving, &still});
+    BOOST_CHECK_EQUAL(snapshot.getObjectCount(), 1);
+    BOOST_CHECK(snapshot.find(&still) == nullptr);
+    BOOST_REQUIRE(snapshot.find(&moving) != nullptr);
+
+    // Applied on top of the current transform
+    const auto current = glm::translate(glm::mat4(1.f), moving.position) *
+                         glm::mat4_cast(moving.rotation);
+
+    auto quarter = snapshot.getInterpolation(&moving, 0.25f) * current;
+    BOOST_CHECK_CLOSE(quarter[3].x, 2.5f, 0.01f);
+    BOOST_CHECK_SMALL(quarter[3].y, 0.0001f);
+    // A quarter of the way through the turn
+    const auto axis = glm::vec3(quarter * glm::vec4(1.f, 0.f, 0.f, 0.f));
+    BOOST_CHECK_CLOSE(axis.x, std::cos(glm::quarter_pi<float>() / 2.f),
+                      0.01f);
+
+    auto start = snapshot.getInterpolation(&moving, 0.f) * current;
+    BOOST_CHECK_SMALL(start[3].x, 0.0001f);
+
+    BOOST_CHECK(isIdentity(snapshot.getInterpolation(&moving, 1.f)));
+    BOOST_CHECK(isIdentity(snapshot.getInterpolation(&still, 0.5f)));
+
+    snapshot.clear();
+    BOOST_CHECK(isIdentity(snapshot.getInterpolation(&moving, 0.5f)));
+}
+
+BOOST_AUTO_TEST_CASE(test_recapture) {
+    InstanceObject first(nullptr, {0.f, 0.f, 0.f}, {}, glm::vec3(1.f),
+                         nullptr, nullptr);
+    InstanceObject second(nullptr, {0.f, 0.f, 0.f}, {}, glm::vec3(1.f),
+                          nullptr, nullptr);
+    first.setGameObjectID(1);
+    second.setGameObjectID(3);
+
+    first._updateLastTransform();
+    second._updateLastTransform();
+    first.position = {1.f, 0.f, 0.f};
+    second.position = {2.f, 0.f, 0.f};
+
+    RenderSnapshot snapshot;
+    snapshot.capture({&first, &second});
+    BOOST_CHECK_EQUAL(snapshot.getObjectCount(), 2);
+
+    // The next tick only the second object moves
+    first._updateLastTransform();
+    second._updateLastTransform();
+    second.position = {3.f, 0.f, 0.f};
+
+    snapshot.capture({&first, &second});
+    BOOST_CHECK_EQUAL(snapshot.getObjectCount(), 1);
+    BOOST_CHECK(snapshot.find(&first) == nullptr);
+    auto state = snapshot.find(&second);
+    BOOST_REQUIRE(state != nullptr);
+    BOOST_CHECK_EQUAL(state->lastPosition.x, 2.f);
+    BOOST_CHECK_EQUAL(state->position.x, 3.f);
+
+    // Another object in a slot isn't mistaken for the one captured there
+    InstanceObject other(nullptr, {0.f, 0.f, 0.f}, {}, glm::vec3(1.f),
+                         nullptr, nullptr);
+    other.setGameObjectID(3);
+    BOOST_CHECK(snapshot.find(&other) == nullptr);
+}
+
+#if RW_TEST_WITH_DATA
+BOOST_AUTO_TEST_CASE(test_physics_objects) {
+    auto world = Global::get().e;
+    auto vehicle = world->createVehicle(90u, glm::vec3(0.f, 0.f, 100.f));
+    BOOST_REQUIRE(vehicle != nullptr);
+
+    // Only moved by the physics step, as in RWGame::step
+    for (int i = 0; i < 5; ++i) {
+        world->updateLastTransforms();
+        world->dynamicsWorld->stepSimulation(1.f / 30.f, 2, 1.f / 60.f);
+    }
+
+    RenderSnapshot snapshot;
+    snapshot.capture(world->allObjects);
+    auto state = snapshot.find(vehicle);
+    BOOST_REQUIRE(state != nullptr);
+    BOOST_CHECK_LT(state->position.z, state->lastPosition.z);
+
+    world->destroyObject(vehicle);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,6 +1,18 @@
 #include <boost/test/unit_test.hpp>
+#include <script/SCMDisassembler.hpp>
 #include <script/SCMFile.hpp>
 #include <script/ScriptMachine.hpp>
+#include <script/ScriptNative.hpp>
+#include <script/ScriptProfiler.hpp>
+#include <script/modules/GTA3Module.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <sstream>
+
+#include "ScriptFixture.hpp"
+#include "test_Globals.hpp"
 
 SCMByte data[] = {0x02, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
                   0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -8,6 +20,18 @@ SCMByte data[] = {0x02, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
                   0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
                   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
+// Header without models or missions, followed by a small loop:
+// 002c: 0004 $0 = 5
+// 0033: 0001 wait 0
+// 0037: 0002 goto 002c
+SCMByte loopData[] = {
+    0x02, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x01, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00,
+    0x00, 0x04, 0x05, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x2C, 0x00,
+    0x00, 0x00};
+
 BOOST_AUTO_TEST_SUITE(ScriptMachineTests)
 
 BOOST_AUTO_TEST_CASE(scmfile_test) {
@@ -19,4 +43,222 @@ BOOST_AUTO_TEST_CASE(scmfile_test) {
     BOOST_CHECK_EQUAL(f.getCodeSection(), 0x28);
 }
 
+BOOST_AUTO_TEST_CASE(test_disassemble_blocks) {
+    SCMFile f;
+    f.loadFile(loopData, sizeof(loopData));
+    BOOST_REQUIRE_EQUAL(f.getCodeSection(), 0x2C);
+
+    GTA3Module module;
+    SCMDisassembler disassembler(f, module);
+
+    SCMInstruction set;
+    BOOST_REQUIRE(disassembler.decode(0x2C, set));
+    BOOST_CHECK_EQUAL(set.opcode, 0x0004);
+    BOOST_CHECK_EQUAL(set.next, 0x33);
+    BOOST_REQUIRE_EQUAL(set.operands.size(), 2);
+    BOOST_CHECK_EQUAL(set.operands[0].type, TGlobal);
+    BOOST_CHECK_EQUAL(set.operands[1].integer, 5);
+
+    disassembler.addFileEntryPoints();
+    auto blocks = disassembler.getBlocks();
+    BOOST_CHECK(disassembler.getInvalidAddresses().empty());
+
+    // Three header jumps, the loop body up to the wait, and the back edge
+    BOOST_REQUIRE_EQUAL(blocks.size(), 5);
+    BOOST_CHECK_EQUAL(blocks[3].address, 0x2C);
+    BOOST_CHECK_EQUAL(blocks[3].instructions.size(), 2);
+    BOOST_CHECK_EQUAL(blocks[4].address, 0x37);
+    BOOST_CHECK_EQUAL(blocks[4].instructions.back().opcode, 0x0002);
+}
+
+BOOST_AUTO_TEST_CASE(test_native_checksum) {
+    SCMFile f;
+    f.loadFile(loopData, sizeof(loopData));
+
+    const SCMNativeBlockEntry entries[] = {{0x2C, nullptr}};
+    ScriptNativeCode matching(ScriptNativeCode::computeChecksum(f), entries);
+    ScriptNativeCode stale(ScriptNativeCode::computeChecksum(f) + 1, entries);
+
+    BOOST_CHECK(matching.matches(f));
+    BOOST_CHECK(!stale.matches(f));
+    BOOST_CHECK_EQUAL(matching.getBlockCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_profiler_record) {
+    ScriptProfiler profiler;
+
+    SCMThread thread{};
+    std::strncpy(thread.name, "MAIN", 16);
+    profiler.record(thread, 0x0010, 0x0001, 100);
+    profiler.record(thread, 0x0020, 0x0001, 300);
+
+    thread.baseAddress = 0x0100;
+    thread.stackDepth = 1;
+    thread.calls[0] = 0x0123;
+    std::strncpy(thread.name, "INTRO", 16);
+    profiler.record(thread, 0x0150, 0x0004, 50);
+
+    BOOST_CHECK_EQUAL(profiler.getTotal().count, 3);
+    BOOST_CHECK_EQUAL(profiler.getTotal().time, 450);
+    BOOST_CHECK_EQUAL(profiler.getOpcodes().at(0x0001).count, 2);
+    BOOST_CHECK_EQUAL(profiler.getOpcodes().at(0x0001).time, 400);
+    BOOST_CHECK_EQUAL(profiler.getThreads().at("MAIN").total.count, 2);
+    BOOST_CHECK_EQUAL(profiler.getThreads().at("INTRO").total.time, 50);
+    BOOST_CHECK_EQUAL(profiler.getRanges().at(0x0000).count, 2);
+    BOOST_CHECK_EQUAL(profiler.getRanges().at(0x0100).count, 1);
+
+    std::stringstream folded;
+    profiler.dumpFolded(folded);
+    BOOST_CHECK_NE(folded.str().find("INTRO;gosub_000123;op_0004 50"),
+                   std::string::npos);
+    BOOST_CHECK_NE(folded.str().find("MAIN;op_0001 400"), std::string::npos);
+
+    profiler.reset();
+    BOOST_CHECK_EQUAL(profiler.getTotal().count, 0);
+    BOOST_CHECK(profiler.getThreads().empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_profiler_sampling) {
+    ScriptProfiler profiler(ScriptProfiler::Mode::Sample, 4);
+
+    SCMThread thread{};
+    std::strncpy(thread.name, "MAIN", 16);
+
+    int timed = 0;
+    for (int i = 0; i < 16; ++i) {
+        bool sample = profiler.beginInstruction();
+        timed += sample ? 1 : 0;
+        profiler.record(thread, 0, 0x0001, sample ? 10 : 0);
+    }
+
+    BOOST_CHECK_EQUAL(timed, 4);
+    BOOST_CHECK_EQUAL(profiler.getTotal().count, 16);
+    // Each sample stands in for sampleInterval instructions
+    BOOST_CHECK_EQUAL(profiler.getTotal().time, 160);
+}
+
+BOOST_AUTO_TEST_CASE(test_native_fixture_matches_interpreter) {
+    auto data = script_fixture::build();
+    SCMFile file;
+    file.loadFile(data.data(), static_cast<unsigned int>(data.size()));
+
+    const auto& native = script_fixture::getCode();
+    BOOST_REQUIRE(native.matches(file));
+
+    GTA3Module module;
+    auto runScript = [&](const ScriptNativeCode* code) {
+        GameState state;
+        ScriptMachine machine(&state, &file, &module);
+        machine.setNativeCode(code);
+        machine.setRandomSeed(1337);
+        machine.startThread(0);
+
+        for (int i = 0; i < 30; ++i) {
+            machine.execute(1.f / 30.f);
+        }
+        return machine.getGlobalData();
+    };
+
+    auto interpreted = runScript(nullptr);
+    auto translated = runScript(&native);
+
+    BOOST_REQUIRE_EQUAL(interpreted.size(), translated.size());
+    for (auto i = 0u; i < interpreted.size(); i += SCM_VARIABLE_SIZE) {
+        BOOST_CHECK_MESSAGE(
+            std::equal(interpreted.begin() + i,
+                       interpreted.begin() + i + SCM_VARIABLE_SIZE,
+                       translated.begin() + i),
+            "Global " << i << " differs");
+    }
+
+    // The loop ran to completion
+    ScriptInt counter;
+    std::memcpy(&counter, translated.data(), sizeof(counter));
+    BOOST_CHECK_EQUAL(counter, script_fixture::kIterations);
+}
+
+#if RW_TEST_WITH_DATA
+BOOST_AUTO_TEST_CASE(test_profile_main_scm) {
+    std::unique_ptr<SCMFile> file(Global::get().d->loadSCM("main.scm"));
+    BOOST_REQUIRE(file != nullptr);
+
+    GTA3Module module;
+    GameState state;
+    state.world = Global::get().e;
+
+    ScriptMachine machine(&state, file.get(), &module);
+    state.script = &machine;
+
+    ScriptProfiler profiler;
+    machine.setProfiler(&profiler);
+    machine.startThread(0);
+
+    // Run ten simulated seconds of the main script
+    const float step = 1.f / 30.f;
+    for (int i = 0; i < 300; ++i) {
+        machine.execute(step);
+    }
+
+    BOOST_CHECK_GT(profiler.getTotal().count, 0);
+    BOOST_CHECK(!profiler.getOpcodes().empty());
+    BOOST_CHECK(!profiler.getThreads().empty());
+
+    std::stringstream flat;
+    profiler.dumpFlat(flat);
+    BOOST_CHECK(!flat.str().empty());
+
+    std::stringstream folded;
+    profiler.dumpFolded(folded);
+    BOOST_CHECK(!folded.str().empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_native_matches_interpreter) {
+    GTA3Module module;
+    if (!module.getNativeCode()) {
+        BOOST_TEST_MESSAGE("Built without SCRIPT_NATIVE_SOURCE, skipping");
+        return;
+    }
+
+    std::unique_ptr<SCMFile> file(Global::get().d->loadSCM("main.scm"));
+    BOOST_REQUIRE(file != nullptr);
+
+    // Each VM gets its own world so created objects get the same handles
+    auto runScript = [&](bool native) {
+        GameWorld world(&Global::get().log, Global::get().d);
+        GameState state;
+        state.world = &world;
+        world.state = &state;
+
+        ScriptMachine machine(&state, file.get(), &module);
+        state.script = &machine;
+        if (!native) {
+            machine.setNativeCode(nullptr);
+        } else {
+            BOOST_REQUIRE(machine.getNativeCode() != nullptr);
+        }
+        machine.setRandomSeed(1337);
+        world.randomEngine.seed(1337);
+        machine.startThread(0);
+
+        for (int i = 0; i < 300; ++i) {
+            machine.execute(1.f / 30.f);
+        }
+        return machine.getGlobalData();
+    };
+
+    auto interpreted = runScript(false);
+    auto translated = runScript(true);
+    Global::get().d->engine = Global::get().e;
+
+    BOOST_REQUIRE_EQUAL(interpreted.size(), translated.size());
+    for (auto i = 0u; i < interpreted.size(); i += SCM_VARIABLE_SIZE) {
+        BOOST_CHECK_MESSAGE(
+            std::equal(interpreted.begin() + i,
+                       interpreted.begin() + i + SCM_VARIABLE_SIZE,
+                       translated.begin() + i),
+            "Global " << i << " differs");
+    }
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,52 @@
+#include <boost/test/unit_test.hpp>
+#include <audio/SoundManager.hpp>
+#include "test_Globals.hpp"
+
+#include <set>
+
+BOOST_AUTO_TEST_SUITE(SoundManagerTests)
+
+#if RW_TEST_WITH_DATA
+BOOST_AUTO_TEST_CASE(test_sfx_cache) {
+    auto& sound = Global::get().e->sound;
+
+    auto cached = sound.getSfxCacheSize();
+    auto a = sound.createSfxInstance(3);
+    auto b = sound.createSfxInstance(3);
+    BOOST_CHECK_EQUAL(sound.getSfxCacheSize(), cached + 1);
+
+    // Neither was played, so the same voice is handed out again
+    BOOST_CHECK_EQUAL(a, b);
+    BOOST_CHECK(sound.getSoundRef(a).isLoaded);
+}
+
+BOOST_AUTO_TEST_CASE(test_voice_stealing) {
+    auto& sound = Global::get().e->sound;
+
+    // Fill the pool, each voice farther away than the last
+    std::set<size_t> playing;
+    size_t farthest = 0;
+    size_t secondFarthest = 0;
+    for (auto i = 0u; i < SoundManager::kMaxVoices; ++i) {
+        auto last = i + 1 == SoundManager::kMaxVoices;
+        auto id = sound.createSfxInstance(3, last ? 1 : 0);
+        sound.playSfx(id, glm::vec3(10.f * i, 0.f, 0.f), true);
+        playing.insert(id);
+        secondFarthest = farthest;
+        farthest = id;
+    }
+    BOOST_REQUIRE_EQUAL(playing.size(), SoundManager::kMaxVoices);
+    BOOST_CHECK_EQUAL(sound.getVoiceCount(), SoundManager::kMaxVoices);
+
+    // The farthest voice has a higher priority
+    auto stolen = sound.createSfxInstance(3);
+    BOOST_CHECK_EQUAL(stolen, secondFarthest);
+    BOOST_CHECK_EQUAL(sound.getVoiceCount(), SoundManager::kMaxVoices);
+
+    for (auto id : playing) {
+        sound.getSoundRef(id).stop();
+    }
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,146 @@
+#include <boost/test/unit_test.hpp>
+#include <audio/AudioDecoder.hpp>
+#include <audio/SoundStream.hpp>
+#include "test_Globals.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <thread>
+
+#if RW_TEST_WITH_DATA
+namespace {
+constexpr uint32_t kSampleRate = 22050;
+constexpr uint32_t kSeconds = 30;
+
+/// Decoded size of the test file, it's upmixed to stereo
+constexpr size_t kDecodedSamples =
+    kSampleRate * kSeconds * AudioDecoder::kChannels;
+
+template <class T>
+void write(std::ofstream& out, T value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/// Writes a mono 16 bit wav file with a sine tone
+rwfs::path createWave() {
+    auto path = rwfs::temp_directory_path() / "openrw_test_stream.wav";
+    std::ofstream out(path.string(), std::ios::binary);
+
+    const uint32_t dataSize = kSampleRate * kSeconds * sizeof(int16_t);
+    out.write("RIFF", 4);
+    write<uint32_t>(out, 36 + dataSize);
+    out.write("WAVEfmt ", 8);
+    write<uint32_t>(out, 16);
+    write<uint16_t>(out, 1);  // PCM
+    write<uint16_t>(out, 1);  // Mono
+    write<uint32_t>(out, kSampleRate);
+    write<uint32_t>(out, kSampleRate * sizeof(int16_t));
+    write<uint16_t>(out, sizeof(int16_t));
+    write<uint16_t>(out, 16);
+    out.write("data", 4);
+    write<uint32_t>(out, dataSize);
+
+    for (auto i = 0u; i < kSampleRate * kSeconds; ++i) {
+        auto t = static_cast<float>(i) / kSampleRate;
+        write<int16_t>(out, static_cast<int16_t>(
+                                std::sin(t * 440.f * 6.2831853f) * 8000.f));
+    }
+
+    return path;
+}
+}  // namespace
+#endif
+
+BOOST_AUTO_TEST_SUITE(SoundStreamTests)
+
+#if RW_TEST_WITH_DATA
+BOOST_AUTO_TEST_CASE(test_decoder_chunks) {
+    // Sound manager sets up ffmpeg
+    Global::get();
+    auto path = createWave();
+
+    AudioDecoder decoder;
+    BOOST_REQUIRE(decoder.open(path));
+    BOOST_CHECK_EQUAL(decoder.getSampleRate(), kSampleRate);
+
+    std::vector<int16_t> data;
+    size_t total = 0;
+    size_t count = 0;
+    while ((count = decoder.decode(data, 4096)) > 0) {
+        BOOST_CHECK_LE(count, 4096u);
+        total += count;
+        data.clear();
+    }
+    BOOST_CHECK_EQUAL(total, kDecodedSamples);
+
+    rwfs::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_decoder_seek) {
+    Global::get();
+    auto path = createWave();
+
+    AudioDecoder decoder;
+    BOOST_REQUIRE(decoder.open(path));
+    BOOST_REQUIRE(decoder.seek(20.f));
+
+    std::vector<int16_t> data;
+    while (decoder.decode(data, 4096) > 0) {
+    }
+
+    // Seeking lands on the packet at or before the time
+    const size_t tenSeconds = kSampleRate * 10 * AudioDecoder::kChannels;
+    BOOST_CHECK_GE(data.size(), tenSeconds);
+    BOOST_CHECK_LT(data.size(), tenSeconds + tenSeconds / 20);
+
+    rwfs::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_stream_first_buffer) {
+    Global::get();
+    auto path = createWave();
+
+    using Clock = std::chrono::steady_clock;
+    SoundStream stream;
+
+    auto start = Clock::now();
+    BOOST_REQUIRE(stream.open(path));
+    while (!stream.isReady() &&
+           Clock::now() - start < std::chrono::seconds(1)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    auto firstBuffer = Clock::now() - start;
+
+    BOOST_REQUIRE(stream.isReady());
+    BOOST_CHECK_LT(std::chrono::duration_cast<std::chrono::milliseconds>(
+                       firstBuffer)
+                       .count(),
+                   100);
+
+    stream.play();
+    BOOST_CHECK(stream.isPlaying());
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    // The ring and the decode buffer, never the whole file
+    const auto bufferSamples =
+        static_cast<size_t>(kSampleRate * SoundStream::kBufferSeconds);
+    const auto bufferBytes =
+        bufferSamples * AudioDecoder::kChannels * sizeof(int16_t);
+    BOOST_CHECK_GT(stream.getPeakBufferedBytes(), 0u);
+    BOOST_CHECK_LE(stream.getPeakBufferedBytes(),
+                   bufferBytes * (SoundStream::kBufferCount + 1));
+    BOOST_CHECK_LT(stream.getPeakBufferedBytes(),
+                   kDecodedSamples * sizeof(int16_t) / 10);
+
+    stream.pause();
+    BOOST_CHECK(stream.isPaused());
+    stream.stop();
+    BOOST_CHECK(stream.isStopped());
+
+    stream.close();
+    rwfs::remove(path);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
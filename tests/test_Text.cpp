@@ -3,10 +3,28 @@
 #include <fonts/GameTexts.hpp>
 #include <loaders/LoaderGXT.hpp>
 #include <platform/FileHandle.hpp>
+#include <render/TextRenderer.hpp>
 #include "test_Globals.hpp"
 
 #define T(x) GameStringUtil::fromString(x, FONT_PRICEDOWN)
 
+namespace {
+TextRenderer::FontMetaData makeFont() {
+    std::array<std::uint8_t, 193> widths;
+    widths.fill(8);
+    return {"font", widths, {256, 256}, {16, 16}, 0};
+}
+
+TextRenderer::TextInfo makeText(const std::string& text) {
+    TextRenderer::TextInfo ti;
+    ti.font = FONT_PRICEDOWN;
+    ti.text = T(text);
+    ti.size = 32.f;
+    ti.baseColour = glm::u8vec3(255, 255, 255);
+    return ti;
+}
+}  // namespace
+
 BOOST_AUTO_TEST_SUITE(TextTests)
 
 #if RW_TEST_WITH_DATA
@@ -143,4 +161,61 @@ BOOST_AUTO_TEST_CASE(format_remove) {
     BOOST_CHECK_EQUAL(1, st.getText<ScreenTextType::Big>().size());
 }
 
+BOOST_AUTO_TEST_CASE(layout_glyphs) {
+    auto font = makeFont();
+    auto layout =
+        TextRenderer::layoutText(makeText("AB\nC"), font, false);
+
+    // One quad per glyph
+    BOOST_REQUIRE_EQUAL(layout.vertices.size(), 18u);
+    BOOST_CHECK_EQUAL(layout.extents.x, 32.f);
+    BOOST_CHECK_EQUAL(layout.extents.y, 64.f);
+
+    // The second glyph is placed after the first, the third on a new line
+    BOOST_CHECK_EQUAL(layout.vertices[8].position.x, 16.f);
+    BOOST_CHECK_EQUAL(layout.vertices[14].position.x, 0.f);
+    BOOST_CHECK_EQUAL(layout.vertices[14].position.y, 32.f);
+}
+
+BOOST_AUTO_TEST_CASE(layout_markup_colour) {
+    auto font = makeFont();
+    auto ti = makeText("~l~A");
+
+    auto layout = TextRenderer::layoutText(ti, font, false);
+    BOOST_REQUIRE_EQUAL(layout.vertices.size(), 6u);
+    BOOST_CHECK_EQUAL(layout.vertices[0].colour.r, 0.f);
+
+    layout = TextRenderer::layoutText(ti, font, true);
+    BOOST_REQUIRE_EQUAL(layout.vertices.size(), 6u);
+    BOOST_CHECK_GT(layout.vertices[0].colour.r, 0.99f);
+}
+
+BOOST_AUTO_TEST_CASE(layout_cache) {
+    auto font = makeFont();
+    auto ti = makeText("$100");
+    TextRenderer::LayoutCache cache;
+    const size_t maxLayouts = TextRenderer::LayoutCache::kMaxLayouts;
+
+    const auto& first = cache.get(ti, font, false);
+    const auto& second = cache.get(ti, font, false);
+    BOOST_CHECK_EQUAL(&first, &second);
+    BOOST_CHECK_EQUAL(cache.size(), 1u);
+
+    ti.size = 16.f;
+    cache.get(ti, font, false);
+    cache.get(ti, font, true);
+    BOOST_CHECK_EQUAL(cache.size(), 3u);
+
+    for (auto i = cache.size(); i < maxLayouts; ++i) {
+        ti.text = T(std::to_string(i));
+        cache.get(ti, font, false);
+    }
+    BOOST_CHECK_EQUAL(cache.size(), maxLayouts);
+
+    // Growing past the limit starts again
+    ti.text = T("new");
+    cache.get(ti, font, false);
+    BOOST_CHECK_EQUAL(cache.size(), 1u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
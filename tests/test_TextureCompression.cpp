@@ -0,0 +1,180 @@
+#include <boost/test/unit_test.hpp>
+#include <gl/TextureCompression.hpp>
+#include <loaders/TextureCache.hpp>
+#include "test_Globals.hpp"
+
+#include <cstdlib>
+#include <fstream>
+
+namespace {
+using TextureCompression::Format;
+using TextureCompression::Level;
+
+Level makeImage(int width, int height, bool alpha) {
+    Level image(static_cast<size_t>(width * height * 4));
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            auto pixel = &image[static_cast<size_t>((y * width + x) * 4)];
+            pixel[0] = static_cast<uint8_t>(x * 255 / (width - 1));
+            pixel[1] = static_cast<uint8_t>(64 + y * 64 / (height - 1));
+            pixel[2] = static_cast<uint8_t>(128);
+            pixel[3] = alpha ? pixel[0] : static_cast<uint8_t>(255);
+        }
+    }
+    return image;
+}
+
+/// Mean absolute difference of one channel, or all colour channels
+double meanError(const Level& a, const Level& b, int channel = -1) {
+    double total = 0.;
+    size_t count = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        auto c = static_cast<int>(i % 4);
+        if ((channel < 0 && c < 3) || c == channel) {
+            total += std::abs(a[i] - b[i]);
+            count++;
+        }
+    }
+    return total / static_cast<double>(count);
+}
+
+TextureImage makeTextureImage() {
+    TextureImage image;
+    image.name = "gradient";
+    image.width = 16;
+    image.height = 8;
+    image.transparent = true;
+    image.filterflags = 0x1106;
+    image.wrapU = 1;
+    image.wrapV = 3;
+    image.levels.push_back(makeImage(image.width, image.height, true));
+    TextureLoader::compress(image);
+    return image;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TextureCompressionTests)
+
+BOOST_AUTO_TEST_CASE(test_level_size) {
+    BOOST_CHECK_EQUAL(TextureCompression::getLevelSize(Format::RGBA8, 3, 2),
+                      24u);
+    BOOST_CHECK_EQUAL(TextureCompression::getLevelSize(Format::DXT1, 4, 4),
+                      8u);
+    BOOST_CHECK_EQUAL(TextureCompression::getLevelSize(Format::DXT1, 5, 5),
+                      32u);
+    BOOST_CHECK_EQUAL(TextureCompression::getLevelSize(Format::DXT1, 1, 1),
+                      8u);
+    BOOST_CHECK_EQUAL(TextureCompression::getLevelSize(Format::DXT5, 8, 8),
+                      64u);
+}
+
+BOOST_AUTO_TEST_CASE(test_choose_format) {
+    auto opaque = makeImage(8, 8, false);
+    auto alpha = makeImage(8, 8, true);
+    BOOST_CHECK(TextureCompression::chooseFormat(opaque.data(), 8, 8) ==
+                Format::DXT1);
+    BOOST_CHECK(TextureCompression::chooseFormat(alpha.data(), 8, 8) ==
+                Format::DXT5);
+}
+
+BOOST_AUTO_TEST_CASE(test_solid_colour) {
+    // Exactly representable in 565
+    Level image(8 * 8 * 4);
+    for (size_t i = 0; i < image.size(); i += 4) {
+        image[i + 0] = 255;
+        image[i + 1] = 0;
+        image[i + 2] = 255;
+        image[i + 3] = 255;
+    }
+
+    auto blocks = TextureCompression::compress(Format::DXT1, image.data(), 8, 8);
+    BOOST_REQUIRE_EQUAL(blocks.size(), 32u);
+    auto decoded =
+        TextureCompression::decompress(Format::DXT1, blocks.data(), 8, 8);
+    BOOST_CHECK(decoded == image);
+}
+
+BOOST_AUTO_TEST_CASE(test_gradient_error) {
+    auto image = makeImage(16, 16, false);
+    auto blocks =
+        TextureCompression::compress(Format::DXT1, image.data(), 16, 16);
+    auto decoded =
+        TextureCompression::decompress(Format::DXT1, blocks.data(), 16, 16);
+    BOOST_REQUIRE_EQUAL(decoded.size(), image.size());
+    BOOST_CHECK_LT(meanError(image, decoded), 8.);
+}
+
+BOOST_AUTO_TEST_CASE(test_alpha_error) {
+    auto image = makeImage(16, 16, true);
+    auto blocks =
+        TextureCompression::compress(Format::DXT5, image.data(), 16, 16);
+    BOOST_REQUIRE_EQUAL(blocks.size(), 256u);
+    auto decoded =
+        TextureCompression::decompress(Format::DXT5, blocks.data(), 16, 16);
+    BOOST_CHECK_LT(meanError(image, decoded, 3), 4.);
+    BOOST_CHECK_LT(meanError(image, decoded), 8.);
+}
+
+BOOST_AUTO_TEST_CASE(test_mip_chain) {
+    auto image = makeImage(37, 21, false);
+    auto levels = TextureCompression::buildMipChain(image.data(), 37, 21);
+    BOOST_REQUIRE_EQUAL(levels.size(), 6u);
+    BOOST_CHECK(levels[0] == image);
+    BOOST_CHECK_EQUAL(levels[1].size(), 18u * 10u * 4u);
+    BOOST_CHECK_EQUAL(levels[5].size(), 4u);
+
+    const Level square = {0,   0, 0, 255, 100, 0, 0, 255,
+                          200, 0, 0, 255, 40,  0, 0, 255};
+    auto averaged = TextureCompression::buildMipChain(square.data(), 2, 2);
+    BOOST_REQUIRE_EQUAL(averaged.size(), 2u);
+    BOOST_CHECK_EQUAL(averaged[1][0], 85);
+    BOOST_CHECK_EQUAL(averaged[1][3], 255);
+}
+
+BOOST_AUTO_TEST_CASE(test_compress_image) {
+    auto image = makeTextureImage();
+    BOOST_CHECK(image.format == Format::DXT5);
+    BOOST_REQUIRE_EQUAL(image.levels.size(), 5u);
+    BOOST_CHECK_EQUAL(image.levels[0].size(), 128u);
+    BOOST_CHECK_EQUAL(image.levels[4].size(), 16u);
+}
+
+BOOST_AUTO_TEST_CASE(test_cache_round_trip) {
+    auto path = rwfs::temp_directory_path() / "openrw_test_texture.rwtc";
+    auto image = makeTextureImage();
+    const uint32_t checksum = 0x1234;
+    BOOST_REQUIRE(TextureCache::write(path, checksum, {image}));
+
+    std::vector<TextureImage> images;
+    BOOST_REQUIRE(TextureCache::read(path, checksum, images));
+    BOOST_REQUIRE_EQUAL(images.size(), 1u);
+    const auto& read = images[0];
+    BOOST_CHECK_EQUAL(read.name, image.name);
+    BOOST_CHECK(read.format == image.format);
+    BOOST_CHECK_EQUAL(read.width, image.width);
+    BOOST_CHECK_EQUAL(read.height, image.height);
+    BOOST_CHECK_EQUAL(read.transparent, image.transparent);
+    BOOST_CHECK_EQUAL(read.filterflags, image.filterflags);
+    BOOST_CHECK_EQUAL(read.wrapU, image.wrapU);
+    BOOST_CHECK_EQUAL(read.wrapV, image.wrapV);
+    BOOST_CHECK(read.levels == image.levels);
+
+    // Stale when the TXD has changed
+    images.clear();
+    BOOST_CHECK(!TextureCache::read(path, checksum + 1, images));
+    BOOST_CHECK(images.empty());
+
+    // Truncated files are rejected
+    auto size = rwfs::file_size(path);
+    rwfs::resize_file(path, size - 1);
+    BOOST_CHECK(!TextureCache::read(path, checksum, images));
+
+    rwfs::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_checksum) {
+    BOOST_CHECK_EQUAL(TextureCache::computeChecksum("", 0), 0x811c9dc5u);
+    BOOST_CHECK_EQUAL(TextureCache::computeChecksum("a", 1), 0xe40c292cu);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
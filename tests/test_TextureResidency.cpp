@@ -0,0 +1,73 @@
+#include <boost/test/unit_test.hpp>
+#include <engine/TextureResidency.hpp>
+#include "test_Globals.hpp"
+
+namespace {
+TextureArchive makeArchive(int size) {
+    // Deleting texture 0 is ignored by GL, it only needs a context
+    Global::get();
+    TextureArchive archive;
+    archive["texture"] = TextureData::create(0, glm::ivec2(size), false);
+    return archive;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TextureResidencyTests)
+
+BOOST_AUTO_TEST_CASE(test_estimate_gpu_bytes) {
+    TextureData texture(0, glm::ivec2(64, 64), false);
+    // 64x64 down to 1x1, 4 bytes per pixel
+    BOOST_CHECK_EQUAL(TextureResidency::estimateGPUBytes(texture), 21844);
+
+    TextureData strip(0, glm::ivec2(4, 1), false);
+    BOOST_CHECK_EQUAL(TextureResidency::estimateGPUBytes(strip), 28);
+}
+
+BOOST_AUTO_TEST_CASE(test_evict_lru) {
+    auto archive = makeArchive(64);
+    auto slotBytes = TextureResidency::estimateGPUBytes(*archive["texture"]);
+
+    TextureResidency residency;
+    residency.addSlot("a", archive, 100);
+    residency.addSlot("b", archive, 100);
+    residency.addSlot("c", archive, 100);
+    BOOST_CHECK_EQUAL(residency.getGPUBytes(), slotBytes * 3);
+
+    // No budget, nothing is evicted
+    BOOST_CHECK(residency.evict().empty());
+
+    residency.setBudget(slotBytes * 2);
+    residency.use("a");
+    auto evicted = residency.evict();
+    BOOST_REQUIRE_EQUAL(evicted.size(), 1);
+    BOOST_CHECK_EQUAL(evicted[0], "b");
+    BOOST_CHECK(!residency.isResident("b"));
+    BOOST_CHECK_EQUAL(residency.getGPUBytes(), slotBytes * 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_evict_keeps_referenced) {
+    auto archive = makeArchive(64);
+    auto slotBytes = TextureResidency::estimateGPUBytes(*archive["texture"]);
+
+    TextureResidency residency;
+    residency.setBudget(slotBytes);
+    residency.addSlot("hud", archive, 0);
+    residency.pin("hud");
+    residency.addSlot("car", archive, 0);
+    residency.addReference("car");
+    residency.addReference("car");
+
+    BOOST_CHECK(residency.evict().empty());
+
+    residency.removeReference("car");
+    BOOST_CHECK(residency.evict().empty());
+    BOOST_CHECK_EQUAL(residency.getSlots().at("car").references, 1);
+
+    residency.removeReference("car");
+    auto evicted = residency.evict();
+    BOOST_REQUIRE_EQUAL(evicted.size(), 1);
+    BOOST_CHECK_EQUAL(evicted[0], "car");
+    BOOST_CHECK(residency.isResident("hud"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
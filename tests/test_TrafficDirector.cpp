@@ -1,10 +1,14 @@
 #include <boost/test/unit_test.hpp>
 #include "test_Globals.hpp"
 
+#include <chrono>
+
 #include <ai/AIGraph.hpp>
+#include <ai/CharacterController.hpp>
 #include <ai/TrafficDirector.hpp>
 #include <objects/CharacterObject.hpp>
 #include <objects/InstanceObject.hpp>
+#include <objects/VehicleObject.hpp>
 #include <render/ViewCamera.hpp>
 
 bool operator!=(const AIGraphNode* lhs, const glm::vec3& rhs) {
@@ -164,6 +168,71 @@ BOOST_AUTO_TEST_CASE(test_create_traffic) {
 
     // Global::get().e->destroyObject(created[0]);
 }
+
+BOOST_AUTO_TEST_CASE(test_recycle_traffic) {
+    auto world = Global::get().e;
+    auto vehicle = world->createVehicle(90u, glm::vec3(10.f, 0.f, 0.f));
+    auto driver = world->createPedestrian(1, vehicle->getPosition());
+    BOOST_REQUIRE(vehicle && driver);
+    driver->setCurrentVehicle(vehicle, 0);
+    vehicle->setOccupant(0, driver);
+    driver->controller->setGoal(CharacterController::TrafficDriver);
+    vehicle->setHealth(500.f);
+
+    auto vehicles = world->getDormantVehicleCount();
+    auto peds = world->getDormantPedestrianCount();
+    world->recycleObject(vehicle);
+    world->recycleObject(driver);
+    BOOST_CHECK_EQUAL(world->getDormantVehicleCount(), vehicles + 1);
+    BOOST_CHECK_EQUAL(world->getDormantPedestrianCount(), peds + 1);
+    BOOST_CHECK(world->vehiclePool.find(vehicle->getGameObjectID()) !=
+                vehicle);
+
+    auto respawned = world->createVehicle(90u, glm::vec3(0.f, 10.f, 0.f));
+    BOOST_CHECK_EQUAL(respawned, vehicle);
+    BOOST_CHECK_EQUAL(respawned->getHealth(), 1000.f);
+    BOOST_CHECK(respawned->getDriver() == nullptr);
+    BOOST_CHECK_EQUAL(respawned->getPosition().y, 10.f);
+
+    auto ped = world->createPedestrian(1, glm::vec3(0.f, 20.f, 0.f));
+    BOOST_CHECK_EQUAL(ped, driver);
+    BOOST_CHECK(ped->getCurrentVehicle() == nullptr);
+    BOOST_CHECK(ped->controller->getGoal() == CharacterController::None);
+    BOOST_CHECK(ped->controller->getCurrentActivity() == nullptr);
+
+    world->destroyObject(ped);
+    world->destroyObject(respawned);
+}
+
+BOOST_AUTO_TEST_CASE(test_traffic_spawn_latency) {
+    constexpr int kCycles = 50;
+    auto world = Global::get().e;
+    using Clock = std::chrono::steady_clock;
+
+    auto measure = [&](bool recycle) {
+        auto start = Clock::now();
+        for (int i = 0; i < kCycles; ++i) {
+            auto vehicle = world->createVehicle(90u, glm::vec3(10.f, 0.f, 0.f));
+            auto ped = world->createPedestrian(1, glm::vec3(0.f, 10.f, 0.f));
+            if (recycle) {
+                world->recycleObject(vehicle);
+                world->recycleObject(ped);
+            } else {
+                world->destroyObject(vehicle);
+                world->destroyObject(ped);
+            }
+        }
+        std::chrono::duration<double, std::micro> time = Clock::now() - start;
+        return time.count() / kCycles;
+    };
+
+    auto created = measure(false);
+    auto recycled = measure(true);
+    BOOST_TEST_MESSAGE("Vehicle and pedestrian spawn: "
+                       << created << "us created, " << recycled
+                       << "us recycled");
+    BOOST_CHECK_GT(world->getDormantVehicleCount(), 0);
+}
 #endif
 
 BOOST_AUTO_TEST_SUITE_END()
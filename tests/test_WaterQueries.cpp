@@ -0,0 +1,105 @@
+#include <boost/test/unit_test.hpp>
+#include <engine/WaterQueries.hpp>
+#include "test_Globals.hpp"
+
+#include <cmath>
+
+namespace {
+struct TestTable {
+    float heights[NO_WATER_INDEX]{};
+    std::uint8_t cells[WATER_HQ_DATA_SIZE * WATER_HQ_DATA_SIZE];
+
+    TestTable() {
+        std::fill(std::begin(cells), std::end(cells),
+                  static_cast<std::uint8_t>(NO_WATER_INDEX));
+        heights[3] = 6.f;
+        // Water in the cell containing the world origin only
+        cells[64 * WATER_HQ_DATA_SIZE + 64] = 3;
+    }
+};
+
+float referenceWave(const glm::vec2& position, float time) {
+    return (1 + std::sin(time + (position.x + position.y) * WATER_SCALE)) *
+           WATER_HEIGHT;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(WaterQueriesTests)
+
+BOOST_AUTO_TEST_CASE(test_sample) {
+    TestTable table;
+    WaterQueries water;
+    water.setTable(table.heights, table.cells);
+
+    auto result = water.sample({10.f, 20.f, 4.f}, 2.f);
+    BOOST_REQUIRE(result.water);
+    BOOST_CHECK_CLOSE(result.waveHeight, referenceWave({10.f, 20.f}, 2.f),
+                      0.01f);
+    BOOST_CHECK_CLOSE(result.height, 6.f + result.waveHeight, 0.001f);
+    BOOST_CHECK_CLOSE(result.depth, result.height - 4.f, 0.001f);
+
+    // The neighbouring cell is dry, but in the same coarse block
+    BOOST_CHECK(water.isNearWater({40.f, 10.f}));
+    BOOST_CHECK(!water.sample({40.f, 10.f, 0.f}, 2.f).water);
+
+    BOOST_CHECK(!water.isNearWater({1000.f, 1000.f}));
+    BOOST_CHECK(!water.sample({1000.f, 1000.f, 0.f}, 2.f).water);
+
+    // Outside of the table
+    BOOST_CHECK_EQUAL(water.getHeightIndex({5000.f, 0.f}), NO_WATER_INDEX);
+    BOOST_CHECK(!water.sample({5000.f, 0.f, 0.f}, 2.f).water);
+}
+
+BOOST_AUTO_TEST_CASE(test_wave_accuracy) {
+    for (auto time : {0.f, 1.f, 100.f, 2000.f}) {
+        for (auto x = -2000.f; x <= 2000.f; x += 37.f) {
+            const glm::vec2 position(x, x * 0.5f);
+            BOOST_CHECK_SMALL(WaterQueries::getWaveHeight(position, time) -
+                                  referenceWave(position, time),
+                              1e-3f);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_batch) {
+    TestTable table;
+    WaterQueries water;
+    water.setTable(table.heights, table.cells);
+
+    const glm::vec3 wet(10.f, 20.f, 8.f);
+    const glm::vec3 dry(1000.f, 1000.f, 0.f);
+    auto a = water.queue(wet);
+    auto b = water.queue(dry);
+    BOOST_CHECK_EQUAL(water.getQueuedCount(), 2);
+
+    // Not executed yet
+    BOOST_CHECK(water.getResult(a) == nullptr);
+
+    water.execute(3.f);
+    BOOST_CHECK_EQUAL(water.getQueuedCount(), 0);
+
+    auto result = water.getResult(a);
+    BOOST_REQUIRE(result != nullptr);
+    auto expected = water.sample(wet, 3.f);
+    BOOST_CHECK(result->water);
+    BOOST_CHECK_EQUAL(result->height, expected.height);
+    BOOST_CHECK_EQUAL(result->depth, expected.depth);
+    BOOST_CHECK_LT(result->depth, 0.f);
+
+    // The second point is reached through the first's handle too
+    BOOST_REQUIRE(water.getResult(a, 1) != nullptr);
+    BOOST_CHECK(!water.getResult(a, 1)->water);
+    BOOST_CHECK(!water.getResult(b)->water);
+    BOOST_CHECK(water.getResult(a, 2) == nullptr);
+
+    // Moved points are sampled again
+    auto moved = water.getResultOrSample(b, 0, wet, 3.f);
+    BOOST_CHECK(moved.water);
+
+    // Results only last until the next batch
+    water.execute(4.f);
+    BOOST_CHECK(water.getResult(a) == nullptr);
+    BOOST_CHECK(water.getResultOrSample(a, 0, wet, 4.f).water);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
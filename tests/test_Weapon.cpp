@@ -2,6 +2,7 @@
 #include <data/WeaponData.hpp>
 #include <objects/CharacterObject.hpp>
 #include <objects/ProjectileObject.hpp>
+#include <objects/VehicleObject.hpp>
 #include "test_Globals.hpp"
 
 BOOST_AUTO_TEST_SUITE(WeaponTests)
@@ -23,6 +24,57 @@ BOOST_AUTO_TEST_CASE(TestWeaponScan) {
 
         Global::get().e->destroyObject(character);
     }
+    {
+        auto character = Global::get().e->createPedestrian(1, {0.f, 0.f, 0.f});
+        BOOST_REQUIRE(character != nullptr);
+
+        // Out of range
+        WeaponScan miss(10.f, {0.f, 10.f, 0.f}, 2.f);
+        Global::get().e->doWeaponScan(miss);
+        BOOST_CHECK_EQUAL(character->getCurrentState().health, 100.f);
+
+        WeaponScan scan(10.f, {0.f, 1.f, 0.f}, 2.f);
+        Global::get().e->doWeaponScan(scan);
+        BOOST_CHECK(character->getCurrentState().health < 100.f);
+
+        Global::get().e->destroyObject(character);
+    }
+    {
+        // Queued scans are applied with the other physics queries
+        auto character = Global::get().e->createPedestrian(1, {0.f, 0.f, 0.f});
+        BOOST_REQUIRE(character != nullptr);
+
+        Global::get().e->queueWeaponScan(
+            WeaponScan(10.f, {0.f, 0.f, 10.f}, {0.f, 0.f, -10.f}));
+        BOOST_CHECK_EQUAL(character->getCurrentState().health, 100.f);
+
+        Global::get().e->processPhysicsQueries();
+        BOOST_CHECK(character->getCurrentState().health < 100.f);
+
+        Global::get().e->destroyObject(character);
+    }
+    {
+        auto vehicle = Global::get().e->createVehicle(90u, {0.f, 0.f, 0.f});
+        BOOST_REQUIRE(vehicle != nullptr);
+
+        // The bounds reach into the sphere, but the origin is outside it
+        WeaponScan edge(10.f, {0.f, 3.f, 0.f}, 1.5f);
+        Global::get().e->doWeaponScan(edge);
+        BOOST_CHECK_EQUAL(vehicle->health, 1000.f);
+
+        // Passengers have no body but are still caught in the blast
+        auto character = Global::get().e->createPedestrian(1, {0.f, 0.f, 0.f});
+        BOOST_REQUIRE(character != nullptr);
+        BOOST_REQUIRE(character->enterVehicle(vehicle, 0));
+
+        WeaponScan scan(10.f, {0.f, 0.f, 1.f}, 3.f);
+        Global::get().e->doWeaponScan(scan);
+        BOOST_CHECK(character->getCurrentState().health < 100.f);
+
+        character->enterVehicle(nullptr, 0);
+        Global::get().e->destroyObject(character);
+        Global::get().e->destroyObject(vehicle);
+    }
 }
 
 BOOST_AUTO_TEST_CASE(TestProjectile) {